@@ -77,6 +77,9 @@ void z_arm64_flush_local_fpu(void)
 
 		/* save current owner's content */
 		z_arm64_fpu_save(&owner->arch.saved_fp_context);
+#ifdef CONFIG_FPU_SHARING_STATS
+		owner->float_stats.saves++;
+#endif
 		/* make sure content made it to memory before releasing */
 		dsb();
 		/* release ownership */
@@ -233,6 +236,9 @@ void z_arm64_fpu_trap(z_arch_esf_t *esf)
 
 	if (owner) {
 		z_arm64_fpu_save(&owner->arch.saved_fp_context);
+#ifdef CONFIG_FPU_SHARING_STATS
+		owner->float_stats.saves++;
+#endif
 		dsb();
 		_current_cpu->arch.fpu_owner = NULL;
 		DBG("save", owner);
@@ -262,6 +268,9 @@ void z_arm64_fpu_trap(z_arch_esf_t *esf)
 
 	/* restore our content */
 	z_arm64_fpu_restore(&_current->arch.saved_fp_context);
+#ifdef CONFIG_FPU_SHARING_STATS
+	_current->float_stats.loads++;
+#endif
 	DBG("restore", _current);
 }
 
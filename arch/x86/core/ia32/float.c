@@ -32,15 +32,24 @@
  * there is no risk that they will be altered, or when there is no need to
  * preserve their contents.
  *
+ * The switch itself is deferred until a thread actually executes a floating
+ * point instruction. z_swap() only clears CR0[TS] for the thread that owns
+ * the live floating point registers, so that any other thread traps on its
+ * first floating point instruction and the "device not available" exception
+ * handler saves the owner's context and loads that of the current thread.
+ * Threads that are given the CPU but do no floating point work in that time
+ * slice therefore cost nothing.
+ *
  * WARNING
  * The use of floating point instructions by ISRs is not supported by the
  * kernel.
  *
  * INTERNAL
- * The kernel sets CR0[TS] to 0 only for threads that require FP register
- * sharing. All other threads have CR0[TS] set to 1 so that an attempt
+ * The kernel sets CR0[TS] to 0 only for the thread that owns the floating
+ * point registers. All other threads have CR0[TS] set to 1 so that an attempt
  * to perform an FP operation will cause an exception, allowing the kernel
- * to enable FP register sharing on its behalf.
+ * to switch the floating point context, or to enable FP register sharing on
+ * behalf of threads that do not use it yet.
  */
 
 #include <zephyr/kernel.h>
@@ -101,6 +110,34 @@ static inline void z_do_fp_and_sse_regs_save(void *preemp_float_reg)
 			 : "memory");
 }
 
+/**
+ * @brief Restore non-integer context information
+ *
+ * This routine loads the x87/MMX thread info saved by z_do_fp_regs_save()
+ * into the system's "live" non-integer context.
+ */
+static inline void z_do_fp_regs_restore(void *preemp_float_reg)
+{
+	__asm__ volatile("frstor (%0);\n\t"
+			 :
+			 : "r"(preemp_float_reg)
+			 : "memory");
+}
+
+/**
+ * @brief Restore non-integer context information
+ *
+ * This routine loads the x87/MMX/SSEx thread info saved by
+ * z_do_fp_and_sse_regs_save() into the system's "live" non-integer context.
+ */
+static inline void z_do_fp_and_sse_regs_restore(void *preemp_float_reg)
+{
+	__asm__ volatile("fxrstor (%0);\n\t"
+			 :
+			 : "r"(preemp_float_reg)
+			 : "memory");
+}
+
 /**
  * @brief Initialize floating point register context information.
  *
@@ -130,6 +167,11 @@ static inline void z_do_sse_regs_init(void)
  */
 static void FpCtxSave(struct k_thread *thread)
 {
+	thread->arch.flags |= X86_THREAD_FLAG_FP_SAVED;
+#ifdef CONFIG_FPU_SHARING_STATS
+	thread->float_stats.saves++;
+#endif
+
 #ifdef CONFIG_X86_SSE
 	if ((thread->base.user_options & K_SSE_REGS) != 0) {
 		z_do_fp_and_sse_regs_save(&thread->arch.preempFloatReg);
@@ -147,6 +189,8 @@ static void FpCtxSave(struct k_thread *thread)
  */
 static inline void FpCtxInit(struct k_thread *thread)
 {
+	thread->arch.flags &= ~X86_THREAD_FLAG_FP_SAVED;
+
 	z_do_fp_regs_init();
 #ifdef CONFIG_X86_SSE
 	if ((thread->base.user_options & K_SSE_REGS) != 0) {
@@ -155,6 +199,36 @@ static inline void FpCtxInit(struct k_thread *thread)
 #endif
 }
 
+/*
+ * Load a thread's floating point context information.
+ *
+ * This routine loads the floating point context last saved by FpCtxSave()
+ * into the system's "live" floating point context. If the thread was not
+ * preempted since it last used the floating point registers, nothing was
+ * saved and a virgin FP context is created instead.
+ */
+static void FpCtxLoad(struct k_thread *thread)
+{
+#ifdef CONFIG_FPU_SHARING_STATS
+	thread->float_stats.loads++;
+#endif
+
+	if ((thread->arch.flags & X86_THREAD_FLAG_FP_SAVED) == 0) {
+		FpCtxInit(thread);
+		return;
+	}
+
+	thread->arch.flags &= ~X86_THREAD_FLAG_FP_SAVED;
+
+#ifdef CONFIG_X86_SSE
+	if ((thread->base.user_options & K_SSE_REGS) != 0) {
+		z_do_fp_and_sse_regs_restore(&thread->arch.preempFloatReg);
+		return;
+	}
+#endif
+	z_do_fp_regs_restore(&thread->arch.preempFloatReg);
+}
+
 /*
  * Enable preservation of floating point context information.
  *
@@ -219,9 +293,9 @@ void z_float_enable(struct k_thread *thread, unsigned int options)
 		 * of the FPU to them (unless we need it ourselves).
 		 */
 
-		if ((_current->base.user_options & _FP_USER_MASK) == 0) {
+		if (fp_owner != _current) {
 			/*
-			 * We are not FP-capable, so mark FPU as owned by the
+			 * We do not own the FPU, so mark FPU as owned by the
 			 * thread we've just enabled FP support for, then
 			 * disable our own FP access by setting CR0[TS] back
 			 * to its original state.
@@ -231,15 +305,14 @@ void z_float_enable(struct k_thread *thread, unsigned int options)
 			z_FpAccessDisable();
 		} else {
 			/*
-			 * We are FP-capable (and thus had FPU ownership on
-			 * entry), so save the new FP context in their TCS,
-			 * leave FPU ownership with self, and leave CR0[TS]
+			 * We own the FPU, so save the new FP context in their
+			 * TCS, leave FPU ownership with self, and leave CR0[TS]
 			 * unset.
 			 *
-			 * The saved FP context is needed in case the thread
-			 * we enabled FP support for is currently pre-empted,
-			 * since z_swap() uses it to restore FP context when
-			 * the thread re-activates.
+			 * The saved FP context is loaded by the "device not
+			 * available" exception handler on the first floating
+			 * point instruction of the thread we enabled FP
+			 * support for.
 			 *
 			 * Saving the FP context reinits the FPU, and thus
 			 * our own FP context, but that's OK since it didn't
@@ -296,11 +369,16 @@ int z_float_disable(struct k_thread *thread)
  * (vector = 7).
  *
  * The processor will generate this exception if any x87 FPU, MMX, or SSEx
- * instruction is executed while CR0[TS]=1. The handler then enables the
- * current thread to use all supported floating point registers.
+ * instruction is executed while CR0[TS]=1. If the current thread uses the
+ * floating point registers, it does not own them yet, so the handler switches
+ * the floating point context. Otherwise, the handler enables the current
+ * thread to use all supported floating point registers.
  */
 void _FpNotAvailableExcHandler(z_arch_esf_t *pEsf)
 {
+	unsigned int imask;
+	struct k_thread *fp_owner;
+
 	ARG_UNUSED(pEsf);
 
 	/*
@@ -309,9 +387,42 @@ void _FpNotAvailableExcHandler(z_arch_esf_t *pEsf)
 	 * error checking to ensure the exception was not generated in an ISR.)
 	 */
 
-	/* Enable highest level of FP capability configured into the kernel */
+	if ((_current->base.user_options & _FP_USER_MASK) == 0) {
+		/*
+		 * Enable highest level of FP capability configured into the
+		 * kernel
+		 */
+
+		k_float_enable(_current, _FP_USER_MASK);
+		return;
+	}
 
-	k_float_enable(_current, _FP_USER_MASK);
+	/* Ensure a preemptive context switch does not occur */
+
+	imask = irq_lock();
+
+	__asm__ volatile("clts\n\t");
+
+	/*
+	 * Save the owner's floating point context, but only if it was
+	 * preempted (otherwise the registers are 'volatile' and need not be
+	 * preserved), then load the current thread's one and claim ownership
+	 * of the FPU, which leaves CR0[TS] clear whenever z_swap() switches
+	 * back to this thread.
+	 */
+
+	fp_owner = _kernel.current_fp;
+	if (fp_owner != _current) {
+		if ((fp_owner != NULL) &&
+		    ((fp_owner->arch.flags & X86_THREAD_FLAG_ALL) != 0)) {
+			FpCtxSave(fp_owner);
+		}
+
+		FpCtxLoad(_current);
+		_kernel.current_fp = _current;
+	}
+
+	irq_unlock(imask);
 }
 _EXCEPTION_CONNECT_NOCODE(_FpNotAvailableExcHandler,
 		IV_DEVICE_NOT_AVAILABLE, 0);
@@ -2107,7 +2107,15 @@ void arch_mem_page_in(void *addr, uintptr_t phys)
 __pinned_func
 void arch_mem_scratch(uintptr_t phys)
 {
-	page_map_set(z_x86_page_tables_get(), Z_SCRATCH_PAGE,
+	arch_mem_scratch_n(0, phys);
+}
+
+__pinned_func
+void arch_mem_scratch_n(size_t n, uintptr_t phys)
+{
+	__ASSERT_NO_MSG(n < Z_SCRATCH_PAGES);
+
+	page_map_set(z_x86_page_tables_get(), Z_SCRATCH_PAGE_N(n),
 		     phys | MMU_P | MMU_RW | MMU_XD, NULL, MASK_ALL,
 		     OPTION_FLUSH);
 }
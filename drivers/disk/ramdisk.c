@@ -47,6 +47,10 @@ static int disk_ram_access_read(struct disk_info *disk, uint8_t *buff,
 		return -EIO;
 	}
 
+	if (CONFIG_DISK_RAM_REQUEST_LATENCY_US > 0) {
+		k_busy_wait(CONFIG_DISK_RAM_REQUEST_LATENCY_US);
+	}
+
 	memcpy(buff, lba_to_address(sector), count * RAMDISK_SECTOR_SIZE);
 
 	return 0;
@@ -63,6 +67,10 @@ static int disk_ram_access_write(struct disk_info *disk, const uint8_t *buff,
 		return -EIO;
 	}
 
+	if (CONFIG_DISK_RAM_REQUEST_LATENCY_US > 0) {
+		k_busy_wait(CONFIG_DISK_RAM_REQUEST_LATENCY_US);
+	}
+
 	memcpy(lba_to_address(sector), buff, count * RAMDISK_SECTOR_SIZE);
 
 	return 0;
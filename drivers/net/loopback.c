@@ -40,6 +40,11 @@ static void loopback_init(struct net_if *iface)
 	net_if_set_link_addr(iface, "\x00\x00\x5e\x00\x53\xff", 6,
 			     NET_LINK_DUMMY);
 
+	if (IS_ENABLED(CONFIG_NET_LOOPBACK_SKIP_CHECKSUM)) {
+		net_if_flag_set(iface, NET_IF_TX_CHKSUM_OFFLOAD);
+		net_if_flag_set(iface, NET_IF_RX_CHKSUM_OFFLOAD);
+	}
+
 	if (IS_ENABLED(CONFIG_NET_IPV4)) {
 		struct in_addr ipv4_loopback = INADDR_LOOPBACK_INIT;
 
@@ -46,6 +46,8 @@
 #define X86_THREAD_FLAG_INT 0x01
 #define X86_THREAD_FLAG_EXC 0x02
 #define X86_THREAD_FLAG_ALL (X86_THREAD_FLAG_INT | X86_THREAD_FLAG_EXC)
+/* preempFloatReg holds the thread's floating point context, see float.c */
+#define X86_THREAD_FLAG_FP_SAVED 0x04
 
 #ifndef _ASMLANGUAGE
 #include <stdint.h>
@@ -74,6 +74,12 @@ struct disk_info {
 	const struct disk_operations *ops;
 	/** Device associated to this disk */
 	const struct device *dev;
+#if defined(CONFIG_DISK_CACHE) || defined(__DOXYGEN__)
+	/** Sector size used by the disk cache, 0 if the disk is not cached */
+	uint32_t cache_sector_size;
+	/** Number of sectors of the disk, as seen by the disk cache */
+	uint32_t cache_sector_count;
+#endif
 };
 
 /**
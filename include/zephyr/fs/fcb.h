@@ -58,6 +58,23 @@ struct fcb_entry {
 	uint16_t fe_data_len; /**< Size of data area in fcb entry*/
 };
 
+#if defined(CONFIG_FCB_ENTRY_INDEX) || defined(__DOXYGEN__)
+/**
+ * @brief FCB index entry structure. This data structure describes an element
+ * as kept in the RAM index of the FCB.
+ */
+struct fcb_index_entry {
+	uint32_t fi_elem_off;
+	/**< Offset from the start of the sector to beginning of element. */
+
+	uint16_t fi_data_len; /**< Size of data area in fcb entry */
+
+	uint8_t fi_sector; /**< Index of the sector within fcb->f_sectors */
+
+	uint8_t fi_valid; /**< Element has been finished with a valid CRC */
+};
+#endif
+
 /**
  * @brief Helper macro for calculating the data offset related to
  * the fcb flash_area start offset.
@@ -129,6 +146,25 @@ struct fcb {
 	/**< The value flash takes when it is erased. This is read from
 	 * flash parameters and initialized upon call to fcb_init.
 	 */
+
+#if defined(CONFIG_FCB_ENTRY_INDEX) || defined(__DOXYGEN__)
+	struct fcb_index_entry f_index[CONFIG_FCB_ENTRY_INDEX_SIZE];
+	/**< Elements from the oldest to the newest, ring buffer starting at
+	 * f_index_head, internal state
+	 */
+
+	uint16_t f_index_head; /**< internal state */
+
+	uint16_t f_index_cnt; /**< internal state */
+
+	uint16_t f_index_hint;
+	/**< Position of the element last returned by fcb_getnext(),
+	 * internal state
+	 */
+
+	bool f_index_ok;
+	/**< Index holds all elements and can be used, internal state */
+#endif
 };
 
 /**
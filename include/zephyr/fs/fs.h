@@ -13,6 +13,10 @@
 #include <zephyr/sys/dlist.h>
 #include <zephyr/fs/fs_interface.h>
 
+#if defined(CONFIG_FILE_SYSTEM_ASYNC)
+#include <zephyr/kernel.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -87,6 +91,10 @@ enum {
  * @param mountp_len Length of Mount point string
  * @param fs Pointer to File system interface of the mount point
  * @param flags Mount flags
+ * @param async_work Work item processing asynchronous requests
+ * @param async_queue Queue of pending asynchronous requests
+ * @param async_lock Lock protecting @p async_queue
+ * @param async_worker Work queue executing the asynchronous requests
  */
 struct fs_mount_t {
 	sys_dnode_t node;
@@ -98,6 +106,12 @@ struct fs_mount_t {
 	size_t mountp_len;
 	const struct fs_file_system_t *fs;
 	uint8_t flags;
+#if defined(CONFIG_FILE_SYSTEM_ASYNC)
+	struct k_work async_work;
+	sys_slist_t async_queue;
+	struct k_spinlock async_lock;
+	struct fs_async_worker *async_worker;
+#endif
 };
 
 /**
@@ -444,6 +458,153 @@ int fs_truncate(struct fs_file_t *zfp, off_t length);
  */
 int fs_sync(struct fs_file_t *zfp);
 
+#if defined(CONFIG_FILE_SYSTEM_ASYNC) || defined(__DOXYGEN__)
+
+/** Asynchronous file operations */
+enum fs_async_op {
+	/** Read from the current file position */
+	FS_ASYNC_READ = 0,
+	/** Write at the current file position */
+	FS_ASYNC_WRITE,
+	/** Flush cached data of the file */
+	FS_ASYNC_SYNC,
+};
+
+/** Flush cached data of the file once the write has completed */
+#define FS_ASYNC_FLAG_SYNC BIT(0)
+
+struct fs_async_req;
+
+/**
+ * @brief Asynchronous request completion callback
+ *
+ * Invoked from the file system work queue thread once the request has
+ * completed; the request may be reused or resubmitted from the callback.
+ *
+ * @param req Completed request, with the result in fs_async_req.result
+ */
+typedef void (*fs_async_cb_t)(struct fs_async_req *req);
+
+/**
+ * @brief Asynchronous file request
+ *
+ * The object is owned by the file system core from submission until
+ * completion is reported and must not be modified in between, neither
+ * may the data buffer it refers to.
+ *
+ * @param node Entry for the mount point request queue
+ * @param zfp File the request operates on
+ * @param buf Data buffer of read and write requests
+ * @param size Size of @p buf in bytes
+ * @param cb Optional completion callback
+ * @param signal Optional signal raised with @p result on completion
+ * @param result Number of bytes transferred, 0 for sync requests, or a
+ *	  negative errno code on error; valid once completion is reported
+ * @param op Requested operation
+ * @param flags Request flags (FS_ASYNC_FLAG_*)
+ */
+struct fs_async_req {
+	sys_snode_t node;
+	struct fs_file_t *zfp;
+	void *buf;
+	size_t size;
+	fs_async_cb_t cb;
+#if defined(CONFIG_POLL) || defined(__DOXYGEN__)
+	struct k_poll_signal *signal;
+#endif
+	ssize_t result;
+	uint8_t op;
+	uint8_t flags;
+};
+
+/**
+ * @brief Initialize fs_async_req object
+ *
+ * @param req Pointer to the request object to initialize
+ * @param cb Completion callback, may be NULL
+ * @param signal Completion signal, may be NULL; ignored unless CONFIG_POLL
+ *	  is enabled
+ */
+static inline void fs_async_req_init(struct fs_async_req *req,
+				     fs_async_cb_t cb,
+				     struct k_poll_signal *signal)
+{
+	*req = (struct fs_async_req){ .cb = cb };
+#if defined(CONFIG_POLL)
+	req->signal = signal;
+#else
+	ARG_UNUSED(signal);
+#endif
+}
+
+/**
+ * @brief Queue a read from a file
+ *
+ * Requests are executed in submission order for all files of a mount
+ * point, by the file system work queue. Mixing asynchronous and
+ * synchronous operations on the same file requires the caller to wait
+ * for pending requests first, e.g. with fs_async_flush().
+ *
+ * @param zfp Pointer to the file object
+ * @param ptr Pointer to the data buffer, valid until completion
+ * @param size Number of bytes to be read
+ * @param req Pointer to the request object
+ *
+ * @retval 0 when the request has been queued;
+ * @retval -EBADF when invoked on zfp that represents unopened/closed file;
+ * @retval -ENOTSUP when not implemented by underlying file system driver.
+ */
+int fs_read_async(struct fs_file_t *zfp, void *ptr, size_t size,
+		  struct fs_async_req *req);
+
+/**
+ * @brief Queue a write to a file
+ *
+ * Consecutive small writes to the same file may be merged into a single
+ * file system write, see CONFIG_FILE_SYSTEM_ASYNC_MERGE_SIZE; each request
+ * still completes with its own result. With @ref FS_ASYNC_FLAG_SYNC the
+ * file is flushed after the write; merged writes share a single flush.
+ *
+ * @param zfp Pointer to the file object
+ * @param ptr Pointer to the data buffer, valid until completion
+ * @param size Number of bytes to be written
+ * @param flags Request flags (FS_ASYNC_FLAG_*)
+ * @param req Pointer to the request object
+ *
+ * @retval 0 when the request has been queued;
+ * @retval -EBADF when invoked on zfp that represents unopened/closed file;
+ * @retval -ENOTSUP when not implemented by underlying file system driver.
+ */
+int fs_write_async(struct fs_file_t *zfp, const void *ptr, size_t size,
+		   uint8_t flags, struct fs_async_req *req);
+
+/**
+ * @brief Queue a flush of cached write data of a file
+ *
+ * @param zfp Pointer to the file object
+ * @param req Pointer to the request object
+ *
+ * @retval 0 when the request has been queued;
+ * @retval -EBADF when invoked on zfp that represents unopened/closed file;
+ * @retval -ENOTSUP when not implemented by underlying file system driver.
+ */
+int fs_sync_async(struct fs_file_t *zfp, struct fs_async_req *req);
+
+/**
+ * @brief Wait for completion of all queued requests of a mount point
+ *
+ * Waits for all requests queued on the mount point of @p zfp, for any
+ * file, before the call. Must not be invoked from a completion callback.
+ *
+ * @param zfp Pointer to the file object
+ *
+ * @retval 0 on success;
+ * @retval -EBADF when invoked on zfp that represents unopened/closed file.
+ */
+int fs_async_flush(struct fs_file_t *zfp);
+
+#endif /* CONFIG_FILE_SYSTEM_ASYNC */
+
 /**
  * @brief Directory create
  *
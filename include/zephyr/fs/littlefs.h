@@ -17,6 +17,8 @@
 extern "C" {
 #endif
 
+struct fs_mount_t;
+
 /** @brief Filesystem info structure for LittleFS mount */
 struct fs_littlefs {
 	/* Defaulted in driver, customizable before mount. */
@@ -37,6 +39,20 @@ struct fs_littlefs {
 	struct lfs lfs;
 	void *backend;
 	struct k_mutex mutex;
+
+#if defined(CONFIG_FS_LITTLEFS_BACKGROUND_MOUNT) || defined(__DOXYGEN__)
+	/* State of a mount completed on the background mount work queue. */
+	struct fs_mount_t *mountp;
+	struct k_work mount_work;
+	struct k_condvar mount_cv;
+	bool mount_pending;
+	int mount_rc;
+#endif
+
+#if defined(CONFIG_FS_LITTLEFS_STATVFS_CACHE) || defined(__DOXYGEN__)
+	/* Blocks in use as of the last traversal, negative if stale. */
+	lfs_ssize_t used_blocks;
+#endif
 };
 
 /** @brief Define a littlefs configuration with customized size
@@ -932,6 +932,180 @@ void k_thread_time_slice_set(struct k_thread *th, int32_t slice_ticks,
 
 /** @} */
 
+#ifdef CONFIG_TIMEOUT_SLACK
+/**
+ * @brief Set the timer slack of a thread
+ *
+ * The timeouts of @a thread, such as the ones of k_sleep() or of a
+ * blocking call with a timeout, may expire up to @a slack late, so that
+ * they expire together with other timeouts and the system wakes up from
+ * idle less often. Threads are created with no slack.
+ *
+ * The slack applies from the next timeout of the thread.
+ *
+ * @note You should enable @kconfig{CONFIG_TIMEOUT_SLACK} in your project
+ * configuration.
+ *
+ * @param thread Thread to set the timer slack of
+ * @param slack Maximum deferral of the thread timeouts, K_NO_WAIT for none
+ */
+__syscall void k_thread_timer_slack_set(k_tid_t thread, k_timeout_t slack);
+#endif
+
+/**
+ * @defgroup thread_pool_apis Thread Pool APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * Thread pool structure
+ * @ingroup thread_pool_apis
+ */
+struct k_thread_pool {
+	struct k_spinlock lock;
+	/** Thread objects, each at the start of an element of the array */
+	char *threads;
+	/** Size of an element of the thread object array */
+	size_t thread_size;
+	/** Stack objects */
+	k_thread_stack_t *stacks;
+	/** Size of an element of the stack object array */
+	size_t stack_len;
+	/** Size of a stack, as passed to k_thread_create() */
+	size_t stack_size;
+	/** Number of threads in the pool */
+	uint32_t count;
+	/** Number of slots never used so far */
+	uint32_t next;
+	/** Number of slots in the free list */
+	uint32_t num_free;
+	/** Free list of slots, most recently freed last */
+	uint32_t *free;
+	/** State of each slot */
+	uint8_t *flags;
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+#define Z_THREAD_POOL_DEFINE(name, _threads, _stacks) \
+	BUILD_ASSERT(ARRAY_SIZE(_threads) == ARRAY_SIZE(_stacks)); \
+	static uint32_t _k_thread_pool_free_##name[ARRAY_SIZE(_threads)]; \
+	static uint8_t _k_thread_pool_flags_##name[ARRAY_SIZE(_threads)]; \
+	STRUCT_SECTION_ITERABLE(k_thread_pool, name) = { \
+		.threads = (char *)(_threads), \
+		.thread_size = sizeof((_threads)[0]), \
+		.stacks = (k_thread_stack_t *)(_stacks), \
+		.stack_len = sizeof((_stacks)[0]), \
+		.stack_size = K_THREAD_STACK_SIZEOF((_stacks)[0]), \
+		.count = ARRAY_SIZE(_threads), \
+		.free = _k_thread_pool_free_##name, \
+		.flags = _k_thread_pool_flags_##name, \
+	}
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @brief Statically define and initialize a thread pool.
+ *
+ * The thread pool holds @a count thread objects, each with a stack of
+ * @a stack_size bytes. It can be accessed outside the module where it is
+ * defined using:
+ *
+ * @code extern struct k_thread_pool <name>; @endcode
+ *
+ * @param name Name of the thread pool.
+ * @param count Number of threads in the pool.
+ * @param stack_size Size of the stack of each thread, in bytes.
+ */
+#define K_THREAD_POOL_DEFINE(name, count, stack_size) \
+	static struct k_thread _k_thread_pool_threads_##name[count]; \
+	static K_THREAD_STACK_ARRAY_DEFINE(_k_thread_pool_stacks_##name, \
+					   count, stack_size); \
+	Z_THREAD_POOL_DEFINE(name, _k_thread_pool_threads_##name, \
+			     _k_thread_pool_stacks_##name)
+
+/**
+ * @brief Spawn a thread from a thread pool.
+ *
+ * This routine creates a thread like k_thread_create(), using a thread
+ * object and a stack taken from @a pool in constant time. They go back to
+ * the pool once the thread exits, and the most recently freed ones are
+ * used first.
+ *
+ * Once the thread has exited, its thread object may be used by the next
+ * thread spawned from @a pool, so the thread ID only designates the
+ * spawned thread until then. It may be passed to k_thread_join() only if
+ * no thread can be spawned from @a pool between the exit of the thread
+ * and the call, e.g. when the caller is the only one spawning threads
+ * from @a pool. Otherwise, the completion of the thread must be signaled
+ * by other means, such as a semaphore given by the thread before it
+ * returns.
+ *
+ * @param pool Thread pool.
+ * @param entry Thread entry function.
+ * @param p1 1st entry point parameter.
+ * @param p2 2nd entry point parameter.
+ * @param p3 3rd entry point parameter.
+ * @param prio Thread priority.
+ * @param options Thread options.
+ * @param delay Scheduling delay, or K_NO_WAIT (for no delay).
+ *
+ * @return ID of new thread, or NULL if all the threads of @a pool are in
+ *         use.
+ */
+k_tid_t k_thread_pool_spawn(struct k_thread_pool *pool,
+			    k_thread_entry_t entry,
+			    void *p1, void *p2, void *p3,
+			    int prio, uint32_t options, k_timeout_t delay);
+
+/**
+ * @brief Allocate a thread object and a stack from a thread pool.
+ *
+ * This routine takes a thread object from @a pool for the caller to create
+ * a thread on, with the stack returned by k_thread_pool_stack_get() or any
+ * other one. The thread object stays allocated until it is freed with
+ * k_thread_pool_free(), which lets the caller keep per-thread state
+ * stored alongside the thread object after the thread exits.
+ *
+ * @param pool Thread pool.
+ *
+ * @return Thread object, or NULL if all the threads of @a pool are in use.
+ */
+struct k_thread *k_thread_pool_alloc(struct k_thread_pool *pool);
+
+/**
+ * @brief Get the stack of a thread allocated from a thread pool.
+ *
+ * @param pool Thread pool.
+ * @param thread Thread object allocated from @a pool.
+ * @param size Filled in with the size of the stack, to pass to
+ *             k_thread_create().
+ *
+ * @return Stack object.
+ */
+k_thread_stack_t *k_thread_pool_stack_get(struct k_thread_pool *pool,
+					  struct k_thread *thread,
+					  size_t *size);
+
+/**
+ * @brief Free a thread object allocated from a thread pool.
+ *
+ * This routine gives a thread object allocated with k_thread_pool_alloc()
+ * back to @a pool. If a thread created on it has not exited yet, the thread
+ * object and its stack go back to the pool when it does, so a thread may
+ * free its own thread object.
+ *
+ * @param pool Thread pool.
+ * @param thread Thread object allocated from @a pool.
+ */
+void k_thread_pool_free(struct k_thread_pool *pool, struct k_thread *thread);
+
+/** @} */
+
 /**
  * @addtogroup isr_apis
  * @{
@@ -1574,6 +1748,27 @@ static inline void *z_impl_k_timer_user_data_get(const struct k_timer *timer)
 	return timer->user_data;
 }
 
+#ifdef CONFIG_TIMEOUT_SLACK
+/**
+ * @brief Set the slack of a timer.
+ *
+ * This routine allows the kernel to defer the expiry of @a timer by up to
+ * @a slack, so that it expires together with other timeouts due within
+ * that window and the system wakes up from idle less often. Each expiry
+ * of a periodic timer may be deferred, but the period is still counted
+ * from the original expiry, so the deferral does not accumulate.
+ *
+ * The slack applies from the next time the timer is started.
+ *
+ * @note You should enable @kconfig{CONFIG_TIMEOUT_SLACK} in your project
+ * configuration.
+ *
+ * @param timer Address of timer.
+ * @param slack Maximum deferral of the timer expiry, K_NO_WAIT for none.
+ */
+__syscall void k_timer_slack_set(struct k_timer *timer, k_timeout_t slack);
+#endif
+
 /** @} */
 
 /**
@@ -2881,6 +3076,258 @@ __syscall int k_condvar_wait(struct k_condvar *condvar, struct k_mutex *mutex,
  * @}
  */
 
+/**
+ * @defgroup rwlock_apis Reader-Writer Lock APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * Reader-writer lock structure
+ * @ingroup rwlock_apis
+ */
+struct k_rwlock {
+	/** Threads waiting to read */
+	_wait_q_t readers_q;
+	/** Threads waiting to write */
+	_wait_q_t writers_q;
+	/** Thread holding the lock for writing */
+	struct k_thread *writer;
+	/** Number of threads holding the lock for reading */
+	uint32_t readers;
+	/** Original priority of the writer */
+	int writer_orig_prio;
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+#define Z_RWLOCK_INITIALIZER(obj) \
+	{ \
+	.readers_q = Z_WAIT_Q_INIT(&obj.readers_q), \
+	.writers_q = Z_WAIT_Q_INIT(&obj.writers_q), \
+	.writer = NULL, \
+	.readers = 0, \
+	.writer_orig_prio = K_LOWEST_APPLICATION_THREAD_PRIO, \
+	}
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @brief Statically define and initialize a reader-writer lock.
+ *
+ * The lock can be accessed outside the module where it is defined using:
+ *
+ * @code extern struct k_rwlock <name>; @endcode
+ *
+ * @param name Name of the reader-writer lock.
+ */
+#define K_RWLOCK_DEFINE(name) \
+	STRUCT_SECTION_ITERABLE(k_rwlock, name) = \
+		Z_RWLOCK_INITIALIZER(name)
+
+/**
+ * @brief Initialize a reader-writer lock.
+ *
+ * This routine initializes a reader-writer lock, prior to its first use.
+ * Upon completion, the lock is not held.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ *
+ * @retval 0 Reader-writer lock initialized.
+ */
+__syscall int k_rwlock_init(struct k_rwlock *rwlock);
+
+/**
+ * @brief Lock a reader-writer lock for reading.
+ *
+ * This routine locks @a rwlock for reading. Any number of threads may hold
+ * the lock for reading at the same time. If the lock is held for writing, or
+ * if a thread is waiting to write, the calling thread waits until the lock
+ * is released by the writers or until a timeout occurs. Because waiting
+ * writers take precedence, a thread must not lock @a rwlock for reading
+ * again while it already holds it for reading.
+ *
+ * While waiting, the calling thread raises the priority of the thread
+ * holding the lock for writing, if any. Threads holding the lock for
+ * reading are not tracked, so their priority is not raised.
+ *
+ * Reader-writer locks may not be locked in ISRs.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ * @param timeout Waiting period to lock the reader-writer lock,
+ *                or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @retval 0 Lock held for reading.
+ * @retval -EBUSY Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_rwlock_rdlock(struct k_rwlock *rwlock, k_timeout_t timeout);
+
+/**
+ * @brief Lock a reader-writer lock for writing.
+ *
+ * This routine locks @a rwlock for writing, giving the calling thread
+ * exclusive access. If the lock is held, the calling thread waits until it
+ * is released or until a timeout occurs. When the lock is released by its
+ * writer, waiting writers are served before waiting readers.
+ *
+ * While waiting, the calling thread raises the priority of the thread
+ * holding the lock for writing, if any.
+ *
+ * Reader-writer locks may not be locked in ISRs.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ * @param timeout Waiting period to lock the reader-writer lock,
+ *                or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @retval 0 Lock held for writing.
+ * @retval -EBUSY Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EDEADLK The calling thread already holds the lock for writing.
+ */
+__syscall int k_rwlock_wrlock(struct k_rwlock *rwlock, k_timeout_t timeout);
+
+/**
+ * @brief Unlock a reader-writer lock held for reading.
+ *
+ * This routine releases @a rwlock, which the calling thread must hold for
+ * reading. When the last reader releases the lock, it is handed over to the
+ * highest priority waiting writer, if any.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ *
+ * @retval 0 Lock released.
+ * @retval -EINVAL The lock is not held for reading.
+ */
+__syscall int k_rwlock_rdunlock(struct k_rwlock *rwlock);
+
+/**
+ * @brief Unlock a reader-writer lock held for writing.
+ *
+ * This routine releases @a rwlock, which the calling thread must hold for
+ * writing, and restores the priority of the calling thread. The lock is
+ * handed over to the highest priority waiting writer if there is one, or
+ * else to all the waiting readers.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ *
+ * @retval 0 Lock released.
+ * @retval -EPERM The calling thread does not hold the lock for writing.
+ * @retval -EINVAL The lock is not held for writing.
+ */
+__syscall int k_rwlock_wrunlock(struct k_rwlock *rwlock);
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup rcu_apis RCU APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+#ifdef CONFIG_SMP
+void z_rcu_read_lock(void);
+void z_rcu_read_unlock(void);
+#endif
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @brief Enter an RCU read-side critical section.
+ *
+ * Data published with k_rcu_assign_pointer() and read with
+ * k_rcu_dereference() inside the critical section is not reclaimed until
+ * the section is left with k_rcu_read_unlock(). Read-side critical
+ * sections may be nested, and may be used in ISRs.
+ *
+ * The scheduler is locked for the duration of the critical section, which
+ * must not block. On SMP, the current CPU also records that it is inside
+ * a critical section.
+ */
+static inline void k_rcu_read_lock(void)
+{
+#ifdef CONFIG_SMP
+	z_rcu_read_lock();
+#else
+	if (!k_is_in_isr()) {
+		k_sched_lock();
+	}
+#endif
+}
+
+/**
+ * @brief Leave an RCU read-side critical section.
+ *
+ * This routine ends a critical section started with k_rcu_read_lock().
+ * Pointers read inside the critical section must not be used afterwards.
+ */
+static inline void k_rcu_read_unlock(void)
+{
+#ifdef CONFIG_SMP
+	z_rcu_read_unlock();
+#else
+	if (!k_is_in_isr()) {
+		k_sched_unlock();
+	}
+#endif
+}
+
+/**
+ * @brief Wait for an RCU grace period.
+ *
+ * This routine returns once every read-side critical section that was in
+ * progress when it was called has been left. Data that was unpublished
+ * before the call can then be reclaimed, as no reader can still be using
+ * it.
+ *
+ * On a uniprocessor system this routine returns immediately, as readers
+ * cannot be preempted. It may not be called in ISRs or inside a read-side
+ * critical section.
+ */
+void k_rcu_synchronize(void);
+
+/**
+ * @brief Publish an RCU protected pointer.
+ *
+ * Stores @a v into @a p, ordered after the initialization of the data it
+ * points to, so that readers using k_rcu_dereference() see initialized
+ * data.
+ *
+ * @param p RCU protected pointer.
+ * @param v New value of the pointer.
+ */
+#define k_rcu_assign_pointer(p, v) \
+	__atomic_store_n(&(p), (v), __ATOMIC_RELEASE)
+
+/**
+ * @brief Read an RCU protected pointer.
+ *
+ * Loads @a p inside a read-side critical section. The data the pointer
+ * refers to remains valid until k_rcu_read_unlock() is called.
+ *
+ * @param p RCU protected pointer.
+ *
+ * @return Value of the pointer.
+ */
+#define k_rcu_dereference(p) \
+	__atomic_load_n(&(p), __ATOMIC_CONSUME)
+
+/**
+ * @}
+ */
+
 /**
  * @cond INTERNAL_HIDDEN
  */
@@ -3339,6 +3786,24 @@ k_work_delayable_from_work(struct k_work *work);
  */
 int k_work_delayable_busy_get(const struct k_work_delayable *dwork);
 
+#ifdef CONFIG_TIMEOUT_SLACK
+/** @brief Set the slack of a delayable work item.
+ *
+ * Allow the kernel to submit @p dwork up to @p slack after its delay
+ * elapses, so that it expires together with other timeouts and the system
+ * wakes up from idle less often.
+ *
+ * The slack applies from the next time the work item is scheduled.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param dwork pointer to the delayable work item.
+ * @param slack maximum deferral of the submission, K_NO_WAIT for none.
+ */
+void k_work_delayable_slack_set(struct k_work_delayable *dwork,
+				k_timeout_t slack);
+#endif
+
 /** @brief Test whether a delayed work item is currently pending.
  *
  * Wrapper to determine whether a delayed work item is in a non-idle state.
@@ -4353,6 +4818,8 @@ struct k_msgq {
 
 
 #define K_MSGQ_FLAG_ALLOC	BIT(0)
+#define K_MSGQ_FLAG_PUT_CLAIM	BIT(1)
+#define K_MSGQ_FLAG_GET_CLAIM	BIT(2)
 
 /**
  * @brief Message Queue Attributes
@@ -4508,6 +4975,102 @@ __syscall int k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout);
  */
 __syscall int k_msgq_peek(struct k_msgq *msgq, void *data);
 
+/**
+ * @brief Claim a free message slot of a message queue.
+ *
+ * This routine gives the caller direct access to the slot of the queue's
+ * ring buffer that the next message is written to, so that the message can
+ * be built in place instead of being copied in by k_msgq_put(). The message
+ * is sent by calling k_msgq_put_commit(), which also releases the claim.
+ *
+ * Only one put claim can be held at a time. While it is held, or while a
+ * thread is waiting for one, k_msgq_put() and other put claims fail with
+ * -EBUSY; threads that were already waiting to send are served first.
+ *
+ * @note The slot is in kernel memory, so this API is only available to
+ * supervisor threads.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Address of a pointer set to the claimed slot, which is
+ *             @a msg_size bytes long.
+ * @param timeout Non-negative waiting period for a free slot,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Slot claimed.
+ * @retval -EBUSY Another put claim is held or waited for.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_msgq_put_claim(struct k_msgq *msgq, void **data, k_timeout_t timeout);
+
+/**
+ * @brief Send the message built in a claimed slot.
+ *
+ * This routine releases the claim made by k_msgq_put_claim(). Unless
+ * @a discard is set, the message in the slot is sent exactly as if it had
+ * been passed to k_msgq_put(): it is handed to a waiting thread if there is
+ * one, otherwise it is added to the queue.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param discard Release the slot without sending anything.
+ *
+ * @retval 0 Claim released.
+ * @retval -EINVAL No put claim is held.
+ */
+int k_msgq_put_commit(struct k_msgq *msgq, bool discard);
+
+/**
+ * @brief Claim the first message of a message queue.
+ *
+ * This routine gives the caller direct access to the message at the head
+ * of the queue's ring buffer, so that it can be processed in place instead
+ * of being copied out by k_msgq_get(). The message stays in the queue until
+ * k_msgq_get_finish() is called.
+ *
+ * Only one get claim can be held at a time. While it is held, or while a
+ * thread is waiting for one, k_msgq_get() and other get claims fail with
+ * -EBUSY; threads that were already waiting to receive are served first.
+ * k_msgq_purge() invalidates a held get claim, which must then not be
+ * finished.
+ *
+ * @note The message is in kernel memory, so this API is only available to
+ * supervisor threads.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Address of a pointer set to the claimed message.
+ * @param timeout Non-negative waiting period for a message,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Message claimed.
+ * @retval -EBUSY Another get claim is held or waited for.
+ * @retval -ENOMSG Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_msgq_get_claim(struct k_msgq *msgq, void **data, k_timeout_t timeout);
+
+/**
+ * @brief Release a claimed message.
+ *
+ * This routine releases the claim made by k_msgq_get_claim(). Unless
+ * @a keep is set the message is removed from the queue, and its slot given
+ * to a thread waiting to send if there is one.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param keep Leave the message at the head of the queue.
+ *
+ * @retval 0 Claim released.
+ * @retval -EINVAL No get claim is held.
+ */
+int k_msgq_get_finish(struct k_msgq *msgq, bool keep);
+
 /**
  * @brief Purge a message queue.
  *
@@ -4737,6 +5300,8 @@ struct k_pipe {
 	size_t         bytes_used;      /**< # bytes used in buffer */
 	size_t         read_index;      /**< Where in buffer to read from */
 	size_t         write_index;     /**< Where in buffer to write */
+	size_t         put_claimed;     /**< # bytes claimed for writing */
+	size_t         get_claimed;     /**< # bytes claimed for reading */
 	struct k_spinlock lock;		/**< Synchronization lock */
 
 	struct {
@@ -4761,6 +5326,8 @@ struct k_pipe {
 	.bytes_used = 0,                                            \
 	.read_index = 0,                                            \
 	.write_index = 0,                                           \
+	.put_claimed = 0,                                           \
+	.get_claimed = 0,                                           \
 	.lock = {},                                                 \
 	.wait_q = {                                                 \
 		.readers = Z_WAIT_Q_INIT(&obj.wait_q.readers),       \
@@ -4880,6 +5447,101 @@ __syscall int k_pipe_get(struct k_pipe *pipe, void *data,
 			 size_t bytes_to_read, size_t *bytes_read,
 			 size_t min_xfer, k_timeout_t timeout);
 
+/**
+ * @brief Claim free space in a pipe's buffer.
+ *
+ * This routine gives the caller direct access to up to @a size bytes of
+ * contiguous free space in the pipe's buffer, so that data can be written
+ * there in place instead of being copied in by k_pipe_put(). The data is
+ * made available to readers by k_pipe_put_commit(), which also releases the
+ * claim. Less space than requested is claimed when the buffer is short of
+ * it or wraps around; a new claim can be made for the rest after the commit.
+ *
+ * Only one put claim can be held at a time. While it is held, k_pipe_put()
+ * and other put claims fail with -EBUSY.
+ *
+ * @note The space is in the pipe's buffer, so this API is only available to
+ * supervisor threads and requires a buffered pipe.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Address of a pointer set to the claimed space.
+ * @param size Address of the number of bytes to claim, which is updated to
+ *             the number of bytes claimed (at least one).
+ * @param timeout Waiting period for free space,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Space claimed.
+ * @retval -EINVAL Unbuffered pipe or zero @a size.
+ * @retval -EBUSY Another put claim is held.
+ * @retval -EIO Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_pipe_put_claim(struct k_pipe *pipe, void **data, size_t *size,
+		     k_timeout_t timeout);
+
+/**
+ * @brief Write the data stored in claimed space to a pipe.
+ *
+ * This routine releases the claim made by k_pipe_put_claim(), adding its
+ * first @a size bytes to the pipe's data. Threads waiting to read are given
+ * the new data.
+ *
+ * @param pipe Address of the pipe.
+ * @param size Number of bytes written, at most the number claimed; zero
+ *             releases the claim without writing anything.
+ *
+ * @retval 0 Claim released.
+ * @retval -EINVAL No put claim is held or @a size is too large.
+ */
+int k_pipe_put_commit(struct k_pipe *pipe, size_t size);
+
+/**
+ * @brief Claim data in a pipe's buffer.
+ *
+ * This routine gives the caller direct access to up to @a size bytes of
+ * contiguous data at the head of the pipe's buffer, so that it can be
+ * processed in place instead of being copied out by k_pipe_get(). The data
+ * stays in the pipe until k_pipe_get_finish() is called.
+ *
+ * Only one get claim can be held at a time. While it is held, k_pipe_get()
+ * and other get claims fail with -EBUSY. Flushing the pipe drops a held get
+ * claim, which must then not be finished.
+ *
+ * @note The data is in the pipe's buffer, so this API is only available to
+ * supervisor threads and requires a buffered pipe.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Address of a pointer set to the claimed data.
+ * @param size Address of the number of bytes to claim, which is updated to
+ *             the number of bytes claimed (at least one).
+ * @param timeout Waiting period for data,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Data claimed.
+ * @retval -EINVAL Unbuffered pipe or zero @a size.
+ * @retval -EBUSY Another get claim is held.
+ * @retval -EIO Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_pipe_get_claim(struct k_pipe *pipe, void **data, size_t *size,
+		     k_timeout_t timeout);
+
+/**
+ * @brief Consume claimed data from a pipe.
+ *
+ * This routine releases the claim made by k_pipe_get_claim(), removing its
+ * first @a size bytes from the pipe. Threads waiting to write are given the
+ * freed space.
+ *
+ * @param pipe Address of the pipe.
+ * @param size Number of bytes consumed, at most the number claimed; zero
+ *             leaves all of the data in the pipe.
+ *
+ * @retval 0 Claim released.
+ * @retval -EINVAL No get claim is held or @a size is too large.
+ */
+int k_pipe_get_finish(struct k_pipe *pipe, size_t size);
+
 /**
  * @brief Query the number of bytes that may be read from @a pipe.
  *
@@ -5873,6 +6535,39 @@ __syscall int k_float_disable(struct k_thread *thread);
  */
 __syscall int k_float_enable(struct k_thread *thread, unsigned int options);
 
+#ifdef CONFIG_FPU_SHARING_STATS
+/**
+ * @brief Get the floating point context switch statistics of a thread
+ *
+ * The statistics count how many times the thread's floating point context
+ * was loaded into and saved from the FPU registers. Threads that never
+ * execute floating point instructions keep both counters at zero, as the
+ * floating point context is only switched when it is used.
+ *
+ * @param thread ID of thread.
+ * @param stats Pointer to struct to copy statistics into.
+ */
+static inline void k_float_stats_get(struct k_thread *thread,
+				     struct k_float_stats *stats)
+{
+	*stats = thread->float_stats;
+}
+#endif /* CONFIG_FPU_SHARING_STATS */
+
+#ifdef CONFIG_IDLE_STATS
+/**
+ * @brief Get the idle statistics of a CPU
+ *
+ * The time a CPU spends idle is the execution time of its idle thread,
+ * as reported in k_thread_runtime_stats_t::idle_cycles.
+ *
+ * @param cpu Index of the CPU
+ * @param stats Pointer to struct to copy statistics into.
+ * @return -EINVAL if invalid CPU index or null pointer, otherwise 0
+ */
+int k_idle_stats_get(int cpu, struct k_idle_stats *stats);
+#endif /* CONFIG_IDLE_STATS */
+
 /**
  * @brief Get the runtime statistics of a thread
  *
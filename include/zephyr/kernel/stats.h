@@ -24,4 +24,13 @@ struct k_cycle_stats {
 	bool      track_usage;  /* true if gathering usage stats */
 };
 
+/*
+ * [k_idle_stats] counts the wakeups of a CPU from idle.
+ */
+
+struct k_idle_stats {
+	uint32_t  wakeups;       /* # of times the CPU woke up from idle */
+	uint32_t  timer_wakeups; /* # of those caused by the system timer */
+};
+
 #endif
@@ -219,6 +219,16 @@ typedef struct k_thread_runtime_stats {
 #endif
 }  k_thread_runtime_stats_t;
 
+#ifdef CONFIG_FPU_SHARING_STATS
+/** Floating point context switch statistics of a thread */
+struct k_float_stats {
+	/** Number of times the FP context was loaded into the FPU */
+	uint32_t loads;
+	/** Number of times the FP context was saved from the FPU */
+	uint32_t saves;
+};
+#endif /* CONFIG_FPU_SHARING_STATS */
+
 struct z_poller {
 	bool is_polling;
 	uint8_t mode;
@@ -320,6 +330,11 @@ struct k_thread {
 	struct k_mem_paging_stats_t paging_stats;
 #endif
 
+#ifdef CONFIG_FPU_SHARING_STATS
+	/** Floating point context switch statistics */
+	struct k_float_stats float_stats;
+#endif
+
 	/** arch-specifics: must always be at the end */
 	struct _thread_arch arch;
 };
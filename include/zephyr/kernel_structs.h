@@ -149,6 +149,10 @@ struct _cpu {
 #endif
 #endif
 
+#ifdef CONFIG_IDLE_STATS
+	struct k_idle_stats idle_stats;
+#endif
+
 	/* Per CPU architecture specifics */
 	struct _cpu_arch arch;
 };
@@ -250,6 +254,10 @@ struct _timeout {
 #else
 	int32_t dticks;
 #endif
+#ifdef CONFIG_TIMEOUT_SLACK
+	/* Ticks by which the expiry may be deferred to coalesce wakeups */
+	int32_t slack;
+#endif
 };
 
 typedef void (*k_thread_timeslice_fn_t)(struct k_thread *thread, void *data);
@@ -219,6 +219,43 @@ struct coap_resource {
 	int age;
 };
 
+/**
+ * @brief Index over an array of CoAP resources.
+ *
+ * Lets a server find the resource matching a request from a hash of its
+ * URI path, instead of comparing the path with the one of every resource.
+ * Use COAP_RESOURCE_INDEX_DEFINE() to define an index and its storage.
+ */
+struct coap_resource_index {
+	/** Indexed resources, terminated by a resource with a NULL path */
+	struct coap_resource *resources;
+	/** Hash buckets, with the index + 1 of their first resource */
+	uint16_t *buckets;
+	/** Index + 1 of the next resource in the same list, per resource */
+	uint16_t *next;
+	/** Index + 1 of the first resource with wildcards in its path */
+	uint16_t wildcards;
+	uint16_t num_buckets;
+	uint16_t max_resources;
+};
+
+/**
+ * @brief Statically define a CoAP resource index.
+ *
+ * @param _name Name of the index.
+ * @param _max_resources Maximum number of resources that can be indexed.
+ * @param _num_buckets Number of hash buckets, e.g. the number of resources.
+ */
+#define COAP_RESOURCE_INDEX_DEFINE(_name, _max_resources, _num_buckets)	\
+	static uint16_t _name##_buckets[_num_buckets];			\
+	static uint16_t _name##_next[_max_resources];			\
+	static struct coap_resource_index _name = {			\
+		.buckets = _name##_buckets,				\
+		.next = _name##_next,					\
+		.num_buckets = (_num_buckets),				\
+		.max_resources = (_max_resources),			\
+	}
+
 /**
  * @brief Represents a remote device that is observing a local resource.
  */
@@ -522,6 +559,62 @@ int coap_handle_request(struct coap_packet *cpkt,
 			uint8_t opt_num,
 			struct sockaddr *addr, socklen_t addr_len);
 
+/**
+ * @brief Build an index over an array of resources.
+ *
+ * The index has to be built again if the array of resources or the path
+ * of a resource changes.
+ *
+ * @param index Index defined with COAP_RESOURCE_INDEX_DEFINE()
+ * @param resources Array of resources, terminated by a resource with a
+ *        NULL path
+ *
+ * @return 0 in case of success, -ENOMEM if there are more resources than
+ * the index can hold.
+ */
+int coap_resource_index_init(struct coap_resource_index *index,
+			     struct coap_resource *resources);
+
+/**
+ * @brief Find the resource that matches the URI path of a request.
+ *
+ * Returns the same resource as the one whose method coap_handle_request()
+ * would call for the request.
+ *
+ * @param index Index of the resources
+ * @param cpkt Packet received
+ * @param options Parsed options from coap_packet_parse()
+ * @param opt_num Number of options
+ *
+ * @return The matching resource, or NULL if there is none.
+ */
+struct coap_resource *coap_resource_index_find(
+	const struct coap_resource_index *index,
+	const struct coap_packet *cpkt,
+	struct coap_option *options, uint8_t opt_num);
+
+/**
+ * @brief When a request is received, call the appropriate methods of
+ * the matching resource, found through an index.
+ *
+ * Same as coap_handle_request(), with a lookup time that does not depend
+ * on the number of resources.
+ *
+ * @param cpkt Packet received
+ * @param index Index of the known resources
+ * @param options Parsed options from coap_packet_parse()
+ * @param opt_num Number of options
+ * @param addr Peer address
+ * @param addr_len Peer address length
+ *
+ * @return 0 in case of success or negative in case of error.
+ */
+int coap_handle_request_index(struct coap_packet *cpkt,
+			      const struct coap_resource_index *index,
+			      struct coap_option *options,
+			      uint8_t opt_num,
+			      struct sockaddr *addr, socklen_t addr_len);
+
 /**
  * Represents the size of each block that will be transferred using
  * block-wise transfers [RFC7959]:
@@ -725,6 +818,25 @@ struct coap_observer *coap_find_observer_by_addr(
 	struct coap_observer *observers, size_t len,
 	const struct sockaddr *addr);
 
+/**
+ * @brief Returns the observer of a resource that matches address @a addr
+ * and token @a token.
+ *
+ * Only the observers registered on @a resource are looked at, e.g. to
+ * find the observer to remove when a deregistration request is received.
+ *
+ * @param resource Resource being observed
+ * @param addr Address of the endpoint observing the resource
+ * @param token Token of the observation, or NULL to match any token
+ * @param tkl Length of the token
+ *
+ * @return A pointer to a observer if a match is found, NULL
+ * otherwise.
+ */
+struct coap_observer *coap_resource_find_observer(
+	struct coap_resource *resource, const struct sockaddr *addr,
+	const uint8_t *token, uint8_t tkl);
+
 /**
  * @brief Returns the next available observer representation.
  *
@@ -240,6 +240,14 @@ struct dns_resolve_context {
 		 * cannot be used to find correct pending query.
 		 */
 		uint16_t query_hash;
+
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+		/** Pending query for the same name and type that this query
+		 * was coalesced with, or NULL if this query was sent itself.
+		 * The results of that query are passed to both callbacks.
+		 */
+		struct dns_pending_query *leader;
+#endif
 	} queries[CONFIG_DNS_NUM_CONCUR_QUERIES];
 
 	/** Is this context in use */
@@ -446,6 +454,43 @@ static inline int dns_cancel_addr_info(uint16_t dns_id)
 	return dns_resolve_cancel(dns_resolve_get_default(), dns_id);
 }
 
+/**
+ * DNS answer cache statistics.
+ */
+struct dns_resolve_cache_stats {
+	/** Lookups answered from the cache */
+	uint32_t hits;
+
+	/** Lookups answered with a cached negative answer */
+	uint32_t negative_hits;
+
+	/** Lookups not answered from the cache */
+	uint32_t misses;
+
+	/** Missed lookups coalesced with an identical pending query */
+	uint32_t coalesced;
+
+	/** Number of valid entries in the cache */
+	uint32_t entries;
+};
+
+/**
+ * @brief Get DNS answer cache statistics.
+ *
+ * @details The answers of DNS queries are cached for their time to live
+ * when @kconfig{CONFIG_DNS_RESOLVER_CACHE} is set.
+ *
+ * @param stats Pointer to struct to copy statistics into.
+ *
+ * @return 0 if ok, <0 if error.
+ */
+int dns_resolve_cache_stats_get(struct dns_resolve_cache_stats *stats);
+
+/**
+ * @brief Remove all answers from the DNS answer cache.
+ */
+void dns_resolve_cache_flush(void);
+
 /**
  * @}
  */
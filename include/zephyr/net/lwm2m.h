@@ -82,6 +82,27 @@ struct lwm2m_obj_path {
 	uint8_t  level;  /* 0/1/2/3/4 (4 = resource instance) */
 };
 
+/**
+ * @brief Path of a resource or resource instance.
+ *
+ * LWM2M_OBJ(3303, 0, 5700) is the path of resource 3303/0/5700, and
+ * LWM2M_OBJ(3303, 0, 5700, 1) the path of its instance 1. Used with the
+ * lwm2m_set_*() and lwm2m_get_*() functions, e.g.
+ * lwm2m_set_float(&LWM2M_OBJ(3303, 0, 5700), &value), to access a resource
+ * without parsing a path string.
+ */
+#define LWM2M_OBJ(...) \
+	Z_LWM2M_OBJ_GET(__VA_ARGS__, Z_LWM2M_OBJ4, Z_LWM2M_OBJ3)(__VA_ARGS__)
+
+#define Z_LWM2M_OBJ_GET(_1, _2, _3, _4, NAME, ...) NAME
+#define Z_LWM2M_OBJ3(_obj, _inst, _res)					\
+	((struct lwm2m_obj_path){ .obj_id = (_obj), .obj_inst_id = (_inst),	\
+				  .res_id = (_res), .level = 3 })
+#define Z_LWM2M_OBJ4(_obj, _inst, _res, _res_inst)			\
+	((struct lwm2m_obj_path){ .obj_id = (_obj), .obj_inst_id = (_inst),	\
+				  .res_id = (_res), .res_inst_id = (_res_inst),	\
+				  .level = 4 })
+
 /**
  * @brief Observe callback events
  */
@@ -878,6 +899,269 @@ int lwm2m_engine_get_float(const char *pathstr, double *buf);
  */
 int lwm2m_engine_get_objlnk(const char *pathstr, struct lwm2m_objlnk *buf);
 
+/**
+ * @brief Set resource (instance) value (opaque buffer) from a path structure
+ *
+ * @param[in] path LwM2M path, e.g. &LWM2M_OBJ(obj, obj-inst, res)
+ * @param[in] data_ptr Data buffer
+ * @param[in] data_len Length of buffer
+ *
+ * @return 0 for success or negative in case of error.
+ */
+int lwm2m_set_opaque(const struct lwm2m_obj_path *path, char *data_ptr, uint16_t data_len);
+
+/**
+ * @brief Set resource (instance) value (string) from a path structure
+ *
+ * @param[in] path LwM2M path, e.g. &LWM2M_OBJ(obj, obj-inst, res)
+ * @param[in] data_ptr NULL terminated char buffer
+ *
+ * @return 0 for success or negative in case of error.
+ */
+int lwm2m_set_string(const struct lwm2m_obj_path *path, char *data_ptr);
+
+/**
+ * @brief Set resource (instance) value (u8) from a path structure
+ *
+ * @param[in] path LwM2M path, e.g. &LWM2M_OBJ(obj, obj-inst, res)
+ * @param[in] value u8 value
+ *
+ * @return 0 for success or negative in case of error.
+ */
+int lwm2m_set_u8(const struct lwm2m_obj_path *path, uint8_t value);
+
+/**
+ * @brief Set resource (instance) value (u16) from a path structure
+ *
+ * @param[in] path LwM2M path, e.g. &LWM2M_OBJ(obj, obj-inst, res)
+ * @param[in] value u16 value
+ *
+ * @return 0 for success or negative in case of error.
+ */
+int lwm2m_set_u16(const struct lwm2m_obj_path *path, uint16_t value);
+
+/**
+ * @brief Set resource (instance) value (u32) from a path structure
+ *
+ * @param[in] path LwM2M path, e.g. &LWM2M_OBJ(obj, obj-inst, res)
+ * @param[in] value u32 value
+ *
+ * @return 0 for success or negative in case of error.
+ */
+int lwm2m_set_u32(const struct lwm2m_obj_path *path, uint32_t value);
+
+/**
+ * @brief Set resource (instance) value (u64) from a path structure
+ *
+ * @param[in] path LwM2M path, e.g. &LWM2M_OBJ(obj, obj-inst, res)
+ * @param[in] value u64 value
+ *
+ * @return 0 for success or negative in case of error.
+ */
+int lwm2m_set_u64(const struct lwm2m_obj_path *path, uint64_t value);
+
+/**
+ * @brief Set resource (instance) value (s8) from a path structure
+ *
+ * @param[in] path LwM2M path, e.g. &LWM2M_OBJ(obj, obj-inst, res)
+ * @param[in] value s8 value
+ *
+ * @return 0 for success or negative in case of error.
+ */
+int lwm2m_set_s8(const struct lwm2m_obj_path *path, int8_t value);
+
+/**
+ * @brief Set resource (instance) value (s16) from a path structure
+ *
+ * @param[in] path LwM2M path, e.g. &LWM2M_OBJ(obj, obj-inst, res)
+ * @param[in] value s16 value
+ *
+ * @return 0 for success or negative in case of error.
+ */
+int lwm2m_set_s16(const struct lwm2m_obj_path *path, int16_t value);
+
+/**
+ * @brief Set resource (instance) value (s32) from a path structure
+ *
+ * @param[in] path LwM2M path, e.g. &LWM2M_OBJ(obj, obj-inst, res)
+ * @param[in] value s32 value
+ *
+ * @return 0 for success or negative in case of error.
+ */
+int lwm2m_set_s32(const struct lwm2m_obj_path *path, int32_t value);
+
+/**
+ * @brief Set resource (instance) value (s64) from a path structure
+ *
+ * @param[in] path LwM2M path, e.g. &LWM2M_OBJ(obj, obj-inst, res)
+ * @param[in] value s64 value
+ *
+ * @return 0 for success or negative in case of error.
+ */
+int lwm2m_set_s64(const struct lwm2m_obj_path *path, int64_t value);
+
+/**
+ * @brief Set resource (instance) value (bool) from a path structure
+ *
+ * @param[in] path LwM2M path, e.g. &LWM2M_OBJ(obj, obj-inst, res)
+ * @param[in] value bool value
+ *
+ * @return 0 for success or negative in case of error.
+ */
+int lwm2m_set_bool(const struct lwm2m_obj_path *path, bool value);
+
+/**
+ * @brief Set resource (instance) value (double) from a path structure
+ *
+ * @param[in] path LwM2M path, e.g. &LWM2M_OBJ(obj, obj-inst, res)
+ * @param[in] value double value
+ *
+ * @return 0 for success or negative in case of error.
+ */
+int lwm2m_set_float(const struct lwm2m_obj_path *path, double *value);
+
+/**
+ * @brief Set resource (instance) value (ObjLnk) from a path structure
+ *
+ * @param[in] path LwM2M path, e.g. &LWM2M_OBJ(obj, obj-inst, res)
+ * @param[in] value pointer to the lwm2m_objlnk structure
+ *
+ * @return 0 for success or negative in case of error.
+ */
+int lwm2m_set_objlnk(const struct lwm2m_obj_path *path, struct lwm2m_objlnk *value);
+
+/**
+ * @brief Get resource (instance) value (opaque buffer) from a path structure
+ *
+ * @param[in] path LwM2M path, e.g. &LWM2M_OBJ(obj, obj-inst, res)
+ * @param[out] buf Data buffer to copy data into
+ * @param[in] buflen Length of buffer
+ *
+ * @return 0 for success or negative in case of error.
+ */
+int lwm2m_get_opaque(const struct lwm2m_obj_path *path, void *buf, uint16_t buflen);
+
+/**
+ * @brief Get resource (instance) value (string) from a path structure
+ *
+ * @param[in] path LwM2M path, e.g. &LWM2M_OBJ(obj, obj-inst, res)
+ * @param[out] str String buffer to copy data into
+ * @param[in] strlen Length of buffer
+ *
+ * @return 0 for success or negative in case of error.
+ */
+int lwm2m_get_string(const struct lwm2m_obj_path *path, void *str, uint16_t strlen);
+
+/**
+ * @brief Get resource (instance) value (u8) from a path structure
+ *
+ * @param[in] path LwM2M path, e.g. &LWM2M_OBJ(obj, obj-inst, res)
+ * @param[out] value u8 buffer to copy data into
+ *
+ * @return 0 for success or negative in case of error.
+ */
+int lwm2m_get_u8(const struct lwm2m_obj_path *path, uint8_t *value);
+
+/**
+ * @brief Get resource (instance) value (u16) from a path structure
+ *
+ * @param[in] path LwM2M path, e.g. &LWM2M_OBJ(obj, obj-inst, res)
+ * @param[out] value u16 buffer to copy data into
+ *
+ * @return 0 for success or negative in case of error.
+ */
+int lwm2m_get_u16(const struct lwm2m_obj_path *path, uint16_t *value);
+
+/**
+ * @brief Get resource (instance) value (u32) from a path structure
+ *
+ * @param[in] path LwM2M path, e.g. &LWM2M_OBJ(obj, obj-inst, res)
+ * @param[out] value u32 buffer to copy data into
+ *
+ * @return 0 for success or negative in case of error.
+ */
+int lwm2m_get_u32(const struct lwm2m_obj_path *path, uint32_t *value);
+
+/**
+ * @brief Get resource (instance) value (u64) from a path structure
+ *
+ * @param[in] path LwM2M path, e.g. &LWM2M_OBJ(obj, obj-inst, res)
+ * @param[out] value u64 buffer to copy data into
+ *
+ * @return 0 for success or negative in case of error.
+ */
+int lwm2m_get_u64(const struct lwm2m_obj_path *path, uint64_t *value);
+
+/**
+ * @brief Get resource (instance) value (s8) from a path structure
+ *
+ * @param[in] path LwM2M path, e.g. &LWM2M_OBJ(obj, obj-inst, res)
+ * @param[out] value s8 buffer to copy data into
+ *
+ * @return 0 for success or negative in case of error.
+ */
+int lwm2m_get_s8(const struct lwm2m_obj_path *path, int8_t *value);
+
+/**
+ * @brief Get resource (instance) value (s16) from a path structure
+ *
+ * @param[in] path LwM2M path, e.g. &LWM2M_OBJ(obj, obj-inst, res)
+ * @param[out] value s16 buffer to copy data into
+ *
+ * @return 0 for success or negative in case of error.
+ */
+int lwm2m_get_s16(const struct lwm2m_obj_path *path, int16_t *value);
+
+/**
+ * @brief Get resource (instance) value (s32) from a path structure
+ *
+ * @param[in] path LwM2M path, e.g. &LWM2M_OBJ(obj, obj-inst, res)
+ * @param[out] value s32 buffer to copy data into
+ *
+ * @return 0 for success or negative in case of error.
+ */
+int lwm2m_get_s32(const struct lwm2m_obj_path *path, int32_t *value);
+
+/**
+ * @brief Get resource (instance) value (s64) from a path structure
+ *
+ * @param[in] path LwM2M path, e.g. &LWM2M_OBJ(obj, obj-inst, res)
+ * @param[out] value s64 buffer to copy data into
+ *
+ * @return 0 for success or negative in case of error.
+ */
+int lwm2m_get_s64(const struct lwm2m_obj_path *path, int64_t *value);
+
+/**
+ * @brief Get resource (instance) value (bool) from a path structure
+ *
+ * @param[in] path LwM2M path, e.g. &LWM2M_OBJ(obj, obj-inst, res)
+ * @param[out] value bool buffer to copy data into
+ *
+ * @return 0 for success or negative in case of error.
+ */
+int lwm2m_get_bool(const struct lwm2m_obj_path *path, bool *value);
+
+/**
+ * @brief Get resource (instance) value (double) from a path structure
+ *
+ * @param[in] path LwM2M path, e.g. &LWM2M_OBJ(obj, obj-inst, res)
+ * @param[out] buf double buffer to copy data into
+ *
+ * @return 0 for success or negative in case of error.
+ */
+int lwm2m_get_float(const struct lwm2m_obj_path *path, double *buf);
+
+/**
+ * @brief Get resource (instance) value (ObjLnk) from a path structure
+ *
+ * @param[in] path LwM2M path, e.g. &LWM2M_OBJ(obj, obj-inst, res)
+ * @param[out] buf lwm2m_objlnk buffer to copy data into
+ *
+ * @return 0 for success or negative in case of error.
+ */
+int lwm2m_get_objlnk(const struct lwm2m_obj_path *path, struct lwm2m_objlnk *buf);
+
 
 /**
  * @brief Set resource (instance) read callback
@@ -79,6 +79,13 @@ enum mqtt_evt_type {
 
 	/** Ping Response from server. */
 	MQTT_EVT_PINGRESP,
+
+	/** Publish message queued with @ref mqtt_publish_async has been
+	 *  written to the transport, or dropped if the event result is
+	 *  negative. The topic and payload buffers of the message are no
+	 *  longer referenced by the client.
+	 */
+	MQTT_EVT_PUBLISH_SENT,
 };
 
 /** @brief MQTT version protocol level. */
@@ -388,6 +395,35 @@ enum mqtt_transport_type {
 	MQTT_TRANSPORT_NUM
 };
 
+#if defined(CONFIG_MQTT_PUBLISH_QUEUE)
+/** @brief Queued message awaiting its acknowledgment. */
+struct mqtt_publish_inflight {
+	/** Message id of the message. */
+	uint16_t message_id;
+
+	/** QoS of the message, telling whether PUBACK or PUBCOMP ends it. */
+	uint8_t qos;
+};
+
+/** @brief Outgoing publish queue of a client. */
+struct mqtt_publish_queue {
+	/** Queued messages. Topics and payloads are owned by the caller. */
+	struct mqtt_publish_param msgs[CONFIG_MQTT_PUBLISH_QUEUE_SIZE];
+
+	/** QoS 1 and 2 messages awaiting PUBACK or PUBCOMP. */
+	struct mqtt_publish_inflight inflight[CONFIG_MQTT_PUBLISH_INFLIGHT_MAX];
+
+	/** Index of the oldest queued message. */
+	uint8_t head;
+
+	/** Number of queued messages. */
+	uint8_t count;
+
+	/** Number of messages awaiting acknowledgment. */
+	uint8_t inflight_count;
+};
+#endif /* CONFIG_MQTT_PUBLISH_QUEUE */
+
 /** @brief MQTT transport specific data. */
 struct mqtt_transport {
 	/** Transport type selection for client instance.
@@ -537,6 +573,11 @@ struct mqtt_client {
 	 *  Default is CONFIG_MQTT_CLEAN_SESSION.
 	 */
 	uint8_t clean_session : 1;
+
+#if defined(CONFIG_MQTT_PUBLISH_QUEUE)
+	/** Outgoing publish queue, see @ref mqtt_publish_async. */
+	struct mqtt_publish_queue publish_queue;
+#endif /* CONFIG_MQTT_PUBLISH_QUEUE */
 };
 
 /**
@@ -601,6 +642,42 @@ int mqtt_connect(struct mqtt_client *client);
 int mqtt_publish(struct mqtt_client *client,
 		 const struct mqtt_publish_param *param);
 
+#if defined(CONFIG_MQTT_PUBLISH_QUEUE)
+/**
+ * @brief API to queue a message for publishing.
+ *
+ * The message is written to the transport as soon as the messages queued
+ * before it are, and, for QoS 1 and 2, as soon as fewer than
+ * @kconfig{CONFIG_MQTT_PUBLISH_INFLIGHT_MAX} queued messages await their
+ * PUBACK or PUBCOMP. The messages which can be sent together are written
+ * with a single transport write, with the payloads taken from the caller's
+ * buffers.
+ *
+ * @param[in] client Client instance for which the procedure is requested.
+ *                   Shall not be NULL.
+ * @param[in] param Parameters to be used for the publish message.
+ *                  Shall not be NULL.
+ *
+ * @return 0 or a negative error code (errno.h) indicating reason of failure.
+ *         -ENOMEM if the queue is full, -EBUSY if a QoS 1 or 2 message
+ *         with the same message id is queued or awaits acknowledgment.
+ *
+ * @note The topic and payload buffers are referenced, not copied, and shall
+ *       remain valid until @ref MQTT_EVT_PUBLISH_SENT is notified for the
+ *       message, or until the client is disconnected. The queued messages
+ *       are dropped on disconnection.
+ * @note Messages published with @ref mqtt_publish are not ordered with the
+ *       queued ones. The queue owns the message ids of its QoS 1 and 2
+ *       messages until they are acknowledged: @ref mqtt_publish rejects
+ *       them with -EBUSY, except to retransmit a message awaiting
+ *       acknowledgment with the dup flag set. Likewise, the message ids of
+ *       the messages published with @ref mqtt_publish shall not be queued
+ *       until they are acknowledged.
+ */
+int mqtt_publish_async(struct mqtt_client *client,
+		       const struct mqtt_publish_param *param);
+#endif /* CONFIG_MQTT_PUBLISH_QUEUE */
+
 /**
  * @brief API used by client to send acknowledgment on receiving QoS1 publish
  *        message. Should be called on reception of @ref MQTT_EVT_PUBLISH with
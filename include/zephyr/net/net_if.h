@@ -193,6 +193,16 @@ enum net_if_flag {
 	/** Interface supports IPv6 */
 	NET_IF_IPV6,
 
+	/** Checksums of the packets sent on the interface are computed by
+	 * the device, or are not needed, so the stack leaves them out.
+	 */
+	NET_IF_TX_CHKSUM_OFFLOAD,
+
+	/** Checksums of the packets received on the interface are verified
+	 * by the device, or are not needed, so the stack does not verify them.
+	 */
+	NET_IF_RX_CHKSUM_OFFLOAD,
+
 /** @cond INTERNAL_HIDDEN */
 	/* Total number of flags - must be at the end of the enum */
 	NET_IF_NUM_FLAGS
@@ -2004,7 +2014,8 @@ void net_if_call_link_cb(struct net_if *iface, struct net_linkaddr *lladdr,
 /**
  * @brief Check if received network packet checksum calculation can be avoided
  * or not. For example many ethernet devices support network packet offloading
- * in which case the IP stack does not need to calculate the checksum.
+ * in which case the IP stack does not need to calculate the checksum. Other
+ * interfaces can set the NET_IF_RX_CHKSUM_OFFLOAD flag for the same purpose.
  *
  * @param iface Network interface
  *
@@ -2016,7 +2027,8 @@ bool net_if_need_calc_rx_checksum(struct net_if *iface);
  * @brief Check if network packet checksum calculation can be avoided or not
  * when sending the packet. For example many ethernet devices support network
  * packet offloading in which case the IP stack does not need to calculate the
- * checksum.
+ * checksum. Other interfaces can set the NET_IF_TX_CHKSUM_OFFLOAD flag for the
+ * same purpose.
  *
  * @param iface Network interface
  *
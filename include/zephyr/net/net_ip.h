@@ -577,6 +577,10 @@ union net_proto_header {
 
 #define NET_IPV6_FRAGH_OFFSET_MASK	0xfff8	/* Mask for the 13-bit Fragment Offset field */
 
+#define NET_IPV4_FRAGH_OFFSET_MASK	0x1fff	/* Mask for the 13-bit Fragment Offset field */
+#define NET_IPV4_MORE_FRAG_MASK		0x2000	/* Mask for the 1-bit More Fragments field */
+#define NET_IPV4_DO_NOT_FRAG_MASK	0x4000	/* Mask for the 1-bit Do Not Fragment field */
+
 /** @endcond */
 
 /**
@@ -748,7 +752,7 @@ static inline bool net_ipv4_is_ll_addr(const struct in_addr *addr)
 static inline void net_ipv4_addr_copy_raw(uint8_t *dest,
 					  const uint8_t *src)
 {
-	net_ipaddr_copy((struct in_addr *)dest, (const struct in_addr *)src);
+	memcpy(dest, src, sizeof(struct in_addr));
 }
 
 /**
@@ -57,10 +57,33 @@ extern struct npf_rule npf_default_ok;
 /** @brief Default rule list termination for rejecting a packet */
 extern struct npf_rule npf_default_drop;
 
+/** @cond INTERNAL_HIDDEN */
+
+#if defined(CONFIG_NET_PKT_FILTER_COMPILE)
+struct npf_insn {
+	uint8_t op;			/* condition, or return of the verdict */
+	uint8_t result;			/* verdict returned */
+	uint16_t fail;			/* next instruction if condition fails */
+	struct npf_test *test;
+};
+
+struct npf_program {
+	struct npf_insn insns[CONFIG_NET_PKT_FILTER_PROGRAM_SIZE];
+};
+#endif
+
+/** @endcond */
+
 /** @brief rule set for a given test location */
 struct npf_rule_list {
 	sys_slist_t rule_head;
 	struct k_spinlock lock;
+#if defined(CONFIG_NET_PKT_FILTER_COMPILE)
+	/** @cond INTERNAL_HIDDEN */
+	struct npf_program *prog;	/* NULL if evaluated rule by rule */
+	struct npf_program progs[2];
+	/** @endcond */
+#endif
 };
 
 /** @brief  rule list applied to outgoing packets */
@@ -157,6 +157,9 @@ struct zsock_pollfd {
 /** Socket option to control TLS session caching on a socket. Accepted values:
  *  - 0 - Disabled.
  *  - 1 - Enabled.
+ *
+ *  Client sessions are cached for the hostname and the peer port if
+ *  TLS_HOSTNAME is set on the socket, for the peer address otherwise.
  */
 #define TLS_SESSION_CACHE 12
 /** Write-only socket option to purge session cache immediately.
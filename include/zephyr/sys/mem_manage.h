@@ -88,6 +88,17 @@
 #include <inttypes.h>
 #include <zephyr/sys/__assert.h>
 
+/** Memory regions for which paging statistics are gathered separately */
+enum k_mem_paging_region {
+	/** Kernel image: code, read-only data and static data */
+	K_MEM_PAGING_REGION_IMAGE,
+
+	/** Anonymous memory mapped with k_mem_map() */
+	K_MEM_PAGING_REGION_ANON,
+
+	K_MEM_PAGING_REGION_NUM
+};
+
 struct k_mem_paging_stats_t {
 #ifdef CONFIG_DEMAND_PAGING_STATS
 	struct {
@@ -113,6 +124,43 @@ struct k_mem_paging_stats_t {
 		/** Number of dirty pages selected for eviction */
 		unsigned long			dirty;
 	} eviction;
+
+#ifdef CONFIG_DEMAND_PAGING_PREFETCH
+	struct {
+		/** Number of page faults followed by a prefetch */
+		unsigned long			batches;
+
+		/** Number of data pages prefetched */
+		unsigned long			pages;
+	} prefetch;
+#endif
+
+#ifdef CONFIG_DEMAND_PAGING_REGION_STATS
+	/**
+	 * Statistics for each memory region, indexed by
+	 * enum k_mem_paging_region. Only the number of page faults is
+	 * gathered per thread.
+	 */
+	struct {
+		/** Number of page faults */
+		unsigned long			faults;
+
+		/**
+		 * Number of page faults per second over the last complete
+		 * CONFIG_DEMAND_PAGING_REGION_STATS_WINDOW
+		 */
+		unsigned long			fault_rate;
+
+		/** Number of data pages currently loaded in page frames */
+		unsigned long			resident;
+
+		/**
+		 * Number of resident data pages accessed since the eviction
+		 * algorithm last cleared their accessed state
+		 */
+		unsigned long			working_set;
+	} regions[K_MEM_PAGING_REGION_NUM];
+#endif /* CONFIG_DEMAND_PAGING_REGION_STATS */
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 };
 
@@ -629,6 +677,28 @@ void k_mem_paging_backing_store_page_out(uintptr_t location);
  */
 void k_mem_paging_backing_store_page_in(uintptr_t location);
 
+/**
+ * Copy several data pages from the provided locations to the scratch pages.
+ *
+ * Immediately before this is called, the scratch pages Z_SCRATCH_PAGE_N(0)
+ * to Z_SCRATCH_PAGE_N(count - 1) will be mapped read-write to the intended
+ * destination page frames for the calling context. The data page at
+ * locations[i] is to be copied to Z_SCRATCH_PAGE_N(i).
+ *
+ * This is used to prefetch data pages on sequential page faults, and allows
+ * the backing store to issue a single request for all of them. Only
+ * backing stores selecting CONFIG_BACKING_STORE_PAGE_IN_MULTI implement it,
+ * the kernel falls back to k_mem_paging_backing_store_page_in() otherwise.
+ *
+ * Calls to this and k_mem_paging_backing_store_page_out() will always be
+ * serialized, but interrupts may be enabled.
+ *
+ * @param locations Location tokens for the data pages
+ * @param count Number of data pages, at most Z_SCRATCH_PAGES
+ */
+void k_mem_paging_backing_store_page_in_multi(const uintptr_t *locations,
+					       size_t count);
+
 /**
  * Update internal accounting after a page-in
  *
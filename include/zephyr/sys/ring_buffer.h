@@ -473,6 +473,244 @@ int ring_buf_item_put(struct ring_buf *buf, uint16_t type, uint8_t value,
 int ring_buf_item_get(struct ring_buf *buf, uint16_t *type, uint8_t *value,
 		      uint32_t *data, uint8_t *size32);
 
+/**
+ * @brief Alignment of the producer and consumer state of a
+ *	  @ref ring_buf_spsc, so that they do not share a cache line.
+ */
+#if defined(CONFIG_DCACHE_LINE_SIZE) && (CONFIG_DCACHE_LINE_SIZE > 0)
+#define RING_BUF_SPSC_ALIGN CONFIG_DCACHE_LINE_SIZE
+#elif defined(CONFIG_SMP)
+#define RING_BUF_SPSC_ALIGN 64
+#else
+#define RING_BUF_SPSC_ALIGN sizeof(uint32_t)
+#endif
+
+/**
+ * @brief A structure to represent a single producer, single consumer
+ *	  ring buffer.
+ *
+ * The producer only writes the @a put state and the consumer only writes the
+ * @a get state; each side reads the tail published by the other one. Both
+ * are kept in separate cache lines.
+ */
+struct ring_buf_spsc {
+	uint8_t *buffer;
+	uint32_t size;
+	struct {
+		uint32_t head;
+		uint32_t tail;
+		uint32_t base;
+		/* Last seen consumer tail */
+		uint32_t get_tail;
+	} put __aligned(RING_BUF_SPSC_ALIGN);
+	struct {
+		uint32_t head;
+		uint32_t tail;
+		uint32_t base;
+		/* Last seen producer tail */
+		uint32_t put_tail;
+	} get __aligned(RING_BUF_SPSC_ALIGN);
+};
+
+/**
+ * @brief Function to force ring_buf_spsc internal states to given value
+ *
+ * Any value other than 0 makes sense only in validation testing context.
+ */
+static inline void ring_buf_spsc_internal_reset(struct ring_buf_spsc *buf,
+						uint32_t value)
+{
+	buf->put.head = buf->put.tail = buf->put.base = value;
+	buf->put.get_tail = value;
+	buf->get.head = buf->get.tail = buf->get.base = value;
+	buf->get.put_tail = value;
+}
+
+/**
+ * @brief Define and initialize a single producer, single consumer ring
+ *	  buffer.
+ *
+ * The data area is word aligned, so that bulk copies of whole words from
+ * word aligned data stay word aligned on both sides of the buffer wrap.
+ *
+ * The ring buffer can be accessed outside the module where it is defined
+ * using:
+ *
+ * @code extern struct ring_buf_spsc <name>; @endcode
+ *
+ * @param name  Name of the ring buffer.
+ * @param size8 Size of ring buffer (in bytes).
+ */
+#define RING_BUF_SPSC_DECLARE(name, size8) \
+	BUILD_ASSERT(size8 < RING_BUFFER_MAX_SIZE,\
+		RING_BUFFER_SIZE_ASSERT_MSG); \
+	static uint32_t __noinit \
+		_ring_buffer_spsc_data_##name[((size8) + 3) / 4]; \
+	struct ring_buf_spsc name = { \
+		.size = size8, \
+		.buffer = (uint8_t *)_ring_buffer_spsc_data_##name \
+	}
+
+/**
+ * @brief Initialize a single producer, single consumer ring buffer.
+ *
+ * This routine initializes a ring buffer, prior to its first use. It is only
+ * used for ring buffers not defined using RING_BUF_SPSC_DECLARE.
+ *
+ * @param buf Address of ring buffer.
+ * @param size Ring buffer size (in bytes).
+ * @param data Ring buffer data area (uint8_t data[size]).
+ */
+static inline void ring_buf_spsc_init(struct ring_buf_spsc *buf,
+				      uint32_t size,
+				      uint8_t *data)
+{
+	__ASSERT(size < RING_BUFFER_MAX_SIZE, RING_BUFFER_SIZE_ASSERT_MSG);
+
+	buf->size = size;
+	buf->buffer = data;
+	ring_buf_spsc_internal_reset(buf, 0);
+}
+
+/**
+ * @brief Determine free space in a single producer, single consumer ring
+ *	  buffer.
+ *
+ * The result is exact when called by the producer; the consumer may only
+ * see more free space than reported.
+ *
+ * @param buf Address of ring buffer.
+ *
+ * @return Ring buffer free space (in bytes).
+ */
+static inline uint32_t ring_buf_spsc_space_get(struct ring_buf_spsc *buf)
+{
+	return buf->size - (buf->put.head -
+			    __atomic_load_n(&buf->get.tail, __ATOMIC_ACQUIRE));
+}
+
+/**
+ * @brief Get amount of bytes stored in a single producer, single consumer
+ *	  ring buffer.
+ *
+ * The result is exact when called by the consumer; the producer may only
+ * see less data than reported.
+ *
+ * @param buf Address of ring buffer.
+ *
+ * @return Amount of data (in bytes) available for reading.
+ */
+static inline uint32_t ring_buf_spsc_size_get(struct ring_buf_spsc *buf)
+{
+	return __atomic_load_n(&buf->put.tail, __ATOMIC_ACQUIRE) -
+	       buf->get.head;
+}
+
+/**
+ * @brief Determine if a single producer, single consumer ring buffer is
+ *	  empty.
+ *
+ * @param buf Address of ring buffer.
+ *
+ * @return true if the ring buffer is empty, or false if not.
+ */
+static inline bool ring_buf_spsc_is_empty(struct ring_buf_spsc *buf)
+{
+	return ring_buf_spsc_size_get(buf) == 0U;
+}
+
+/**
+ * @brief Allocate buffer for writing data to a single producer, single
+ *	  consumer ring buffer.
+ *
+ * Same as @ref ring_buf_put_claim, without any locking required as long as
+ * there is only one producer at a time. The data is only visible to the
+ * consumer once @ref ring_buf_spsc_put_finish is called.
+ *
+ * @param[in]  buf  Address of ring buffer.
+ * @param[out] data Pointer to the address. It is set to a location within
+ *		    ring buffer.
+ * @param[in]  size Requested allocation size (in bytes).
+ *
+ * @return Size of allocated buffer which can be smaller than requested if
+ *	   there is not enough free space or buffer wraps.
+ */
+uint32_t ring_buf_spsc_put_claim(struct ring_buf_spsc *buf,
+				 uint8_t **data,
+				 uint32_t size);
+
+/**
+ * @brief Indicate number of bytes written to allocated buffers and publish
+ *	  them to the consumer.
+ *
+ * @param  buf  Address of ring buffer.
+ * @param  size Number of valid bytes in the allocated buffers.
+ *
+ * @retval 0 Successful operation.
+ * @retval -EINVAL Provided @a size exceeds free space in the ring buffer.
+ */
+int ring_buf_spsc_put_finish(struct ring_buf_spsc *buf, uint32_t size);
+
+/**
+ * @brief Write (copy) data to a single producer, single consumer ring
+ *	  buffer.
+ *
+ * The data is copied with at most two copies, one on each side of the
+ * buffer wrap, and published to the consumer at once.
+ *
+ * @param buf  Address of ring buffer.
+ * @param data Address of data.
+ * @param size Data size (in bytes).
+ *
+ * @retval Number of bytes written.
+ */
+uint32_t ring_buf_spsc_put(struct ring_buf_spsc *buf, const uint8_t *data,
+			   uint32_t size);
+
+/**
+ * @brief Get address of a valid data in a single producer, single consumer
+ *	  ring buffer.
+ *
+ * Same as @ref ring_buf_get_claim, without any locking required as long as
+ * there is only one consumer at a time. The space is only given back to the
+ * producer once @ref ring_buf_spsc_get_finish is called.
+ *
+ * @param[in]  buf  Address of ring buffer.
+ * @param[out] data Pointer to the address. It is set to a location within
+ *		    ring buffer.
+ * @param[in]  size Requested size (in bytes).
+ *
+ * @return Number of valid bytes in the provided buffer which can be smaller
+ *	   than requested if there is not enough data or buffer wraps.
+ */
+uint32_t ring_buf_spsc_get_claim(struct ring_buf_spsc *buf,
+				 uint8_t **data,
+				 uint32_t size);
+
+/**
+ * @brief Indicate number of bytes read from claimed buffers and hand the
+ *	  space back to the producer.
+ *
+ * @param  buf  Address of ring buffer.
+ * @param  size Number of bytes that can be freed.
+ *
+ * @retval 0 Successful operation.
+ * @retval -EINVAL Provided @a size exceeds valid bytes in the ring buffer.
+ */
+int ring_buf_spsc_get_finish(struct ring_buf_spsc *buf, uint32_t size);
+
+/**
+ * @brief Read data from a single producer, single consumer ring buffer.
+ *
+ * @param buf  Address of ring buffer.
+ * @param data Address of the output buffer. Can be NULL to discard data.
+ * @param size Data size (in bytes).
+ *
+ * @retval Number of bytes written to the output buffer.
+ */
+uint32_t ring_buf_spsc_get(struct ring_buf_spsc *buf, uint8_t *data,
+			   uint32_t size);
+
 /**
  * @}
  */
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_
+#define ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <zephyr/toolchain.h>
+#include <syscall_list.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup syscall_batch_apis Batched System Call APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @brief A system call request of a @ref k_syscall_ring.
+ *
+ * The arguments are laid out the way the generated invocation functions
+ * pass them to the kernel: one word per argument, 64-bit arguments split
+ * over two words on 32-bit platforms.
+ */
+struct k_syscall_req {
+	/** System call ID, K_SYSCALL_* */
+	uintptr_t id;
+	/** System call arguments */
+	uintptr_t args[6];
+	/** Return value, valid once the request has been executed */
+	uintptr_t ret;
+};
+
+/**
+ * @brief A system call submission ring.
+ *
+ * The ring and its requests live in memory of the user thread. The thread
+ * queues requests with @ref k_syscall_ring_push and has the kernel execute
+ * all of them with a single @ref k_syscall_ring_submit call, which writes
+ * the return value of each request back into it.
+ */
+struct k_syscall_ring {
+	/** Request storage */
+	struct k_syscall_req *reqs;
+	/** Number of requests in @a reqs */
+	uint32_t size;
+	/** Next request to execute, advanced by the kernel */
+	uint32_t head;
+	/** Next free request, advanced by the caller */
+	uint32_t tail;
+};
+
+/**
+ * @brief Initialize a system call submission ring.
+ *
+ * @param ring Address of the ring.
+ * @param reqs Request storage, in memory accessible to the calling thread.
+ * @param size Number of requests in @a reqs.
+ */
+static inline void k_syscall_ring_init(struct k_syscall_ring *ring,
+				       struct k_syscall_req *reqs,
+				       uint32_t size)
+{
+	ring->reqs = reqs;
+	ring->size = size;
+	ring->head = 0U;
+	ring->tail = 0U;
+}
+
+/**
+ * @brief Queue a system call request.
+ *
+ * The caller fills in the arguments of the returned request. Its return
+ * value can be read once @ref k_syscall_ring_submit has returned, until the
+ * request is reused by a later push.
+ *
+ * @param ring Address of the ring.
+ * @param id System call ID, K_SYSCALL_*.
+ *
+ * @return Address of the request, or NULL if the ring is full.
+ */
+static inline struct k_syscall_req *k_syscall_ring_push(
+	struct k_syscall_ring *ring, uintptr_t id)
+{
+	struct k_syscall_req *req;
+
+	if ((ring->tail - ring->head) >= ring->size) {
+		return NULL;
+	}
+
+	req = &ring->reqs[ring->tail % ring->size];
+	req->id = id;
+	ring->tail++;
+
+	return req;
+}
+
+/**
+ * @brief Execute the queued system call requests.
+ *
+ * All requests queued since the last submission are executed in order in
+ * a single system call, in the context of the calling thread, and the ring
+ * is empty on return. Each request is validated by the verification
+ * function of its system call, exactly as if it had been invoked directly;
+ * a request that fails validation triggers a kernel oops.
+ *
+ * Only the system calls that were marked as batchable in
+ * scripts/gen_syscalls.py can be queued; other requests complete with
+ * -ENOSYS without being executed.
+ *
+ * @param ring Address of the ring.
+ *
+ * @return Number of requests executed.
+ * @retval -EINVAL The ring is corrupted.
+ * @retval -ENOTSUP Called from supervisor mode.
+ */
+__syscall int k_syscall_ring_submit(struct k_syscall_ring *ring);
+
+/** @} */
+
+#include <syscalls/syscall_batch.h>
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_ */
@@ -18,6 +18,9 @@
 #include <zephyr/logging/log.h>
 
 extern const _k_syscall_handler_t _k_syscall_table[K_SYSCALL_LIMIT];
+#ifdef CONFIG_SYSCALL_BATCH
+extern const bool _k_syscall_batchable[K_SYSCALL_LIMIT];
+#endif
 
 enum _obj_init_check {
 	_OBJ_INIT_TRUE = 0,
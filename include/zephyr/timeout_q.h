@@ -25,6 +25,9 @@ extern "C" {
 static inline void z_init_timeout(struct _timeout *to)
 {
 	sys_dnode_init(&to->node);
+#ifdef CONFIG_TIMEOUT_SLACK
+	to->slack = 0;
+#endif
 }
 
 void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
@@ -56,6 +59,10 @@ static inline int z_abort_thread_timeout(struct k_thread *thread)
 
 int32_t z_get_next_timeout_expiry(void);
 
+#ifdef CONFIG_TIMEOUT_SLACK
+void z_timeout_slack_set(struct _timeout *to, k_timeout_t slack);
+#endif
+
 void z_set_timeout_expiry(int32_t ticks, bool is_idle);
 
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout);
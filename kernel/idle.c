@@ -36,6 +36,10 @@ void idle(void *unused1, void *unused2, void *unused3)
 	ARG_UNUSED(unused2);
 	ARG_UNUSED(unused3);
 
+#ifdef CONFIG_IDLE_STATS
+	struct _cpu *cpu;
+#endif
+
 	__ASSERT_NO_MSG(_current->base.prio >= 0);
 
 	while (true) {
@@ -61,6 +65,13 @@ void idle(void *unused1, void *unused2, void *unused3)
 		 */
 		(void) arch_irq_lock();
 
+#ifdef CONFIG_IDLE_STATS
+		/* Wakeups are counted after k_cpu_idle() returns with
+		 * interrupts unmasked, when _current_cpu is off limits
+		 */
+		cpu = _current_cpu;
+#endif
+
 #ifdef CONFIG_PM
 		_kernel.idle = z_get_next_timeout_expiry();
 
@@ -86,6 +97,10 @@ void idle(void *unused1, void *unused2, void *unused3)
 		k_cpu_idle();
 #endif
 
+#ifdef CONFIG_IDLE_STATS
+		cpu->idle_stats.wakeups++;
+#endif
+
 #if !defined(CONFIG_PREEMPT_ENABLED)
 # if !defined(CONFIG_USE_SWITCH) || defined(CONFIG_SPARC)
 		/* A legacy mess: the idle thread is by definition
@@ -104,3 +119,16 @@ void idle(void *unused1, void *unused2, void *unused3)
 #endif
 	}
 }
+
+#ifdef CONFIG_IDLE_STATS
+int k_idle_stats_get(int cpu, struct k_idle_stats *stats)
+{
+	if ((cpu < 0) || (cpu >= CONFIG_MP_NUM_CPUS) || (stats == NULL)) {
+		return -EINVAL;
+	}
+
+	*stats = _kernel.cpus[cpu].idle_stats;
+
+	return 0;
+}
+#endif /* CONFIG_IDLE_STATS */
@@ -402,6 +402,17 @@ void arch_mem_page_in(void *addr, uintptr_t phys);
  */
 void arch_mem_scratch(uintptr_t phys);
 
+/**
+ * Update current page tables for a temporary mapping of several page frames
+ *
+ * Like arch_mem_scratch(), but maps the physical page frame address to the
+ * scratch page Z_SCRATCH_PAGE_N(n), out of Z_SCRATCH_PAGES. Used to page in
+ * several data pages in one backing store request.
+ *
+ * This API is part of infrastructure still under development and may change.
+ */
+void arch_mem_scratch_n(size_t n, uintptr_t phys);
+
 enum arch_page_location {
 	ARCH_PAGE_LOCATION_PAGED_OUT,
 	ARCH_PAGE_LOCATION_PAGED_IN,
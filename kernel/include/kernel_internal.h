@@ -119,6 +119,11 @@ extern void z_thread_monitor_exit(struct k_thread *thread);
 	} while (false)
 #endif /* CONFIG_THREAD_MONITOR */
 
+#ifdef CONFIG_THREAD_POOL
+/* give a thread pool slot back when the thread on it exits */
+extern void z_thread_pool_exit(struct k_thread *thread);
+#endif /* CONFIG_THREAD_POOL */
+
 #ifdef CONFIG_USE_SWITCH
 /* This is a arch function traditionally, but when the switch-based
  * z_swap() is in use it's a simple inline provided by the kernel.
@@ -273,6 +278,18 @@ void pm_system_resume(void);
 
 #endif
 
+#ifdef CONFIG_DEMAND_PAGING_REGION_STATS
+/**
+ * Account a page fault in the statistics of its memory region.
+ *
+ * Called with interrupts locked.
+ *
+ * @param addr Faulting virtual address.
+ * @return Memory region of the address.
+ */
+enum k_mem_paging_region z_paging_region_fault_inc(void *addr);
+#endif /* CONFIG_DEMAND_PAGING_REGION_STATS */
+
 #ifdef CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM
 /**
  * Initialize the timing histograms for demand paging.
@@ -218,13 +218,20 @@ extern size_t z_free_page_count;
 	     _phys += CONFIG_MMU_PAGE_SIZE, _pageframe++)
 
 #ifdef CONFIG_DEMAND_PAGING
-/* We reserve a virtual page as a scratch area for page-ins/outs at the end
- * of the address space
+/* We reserve virtual pages as a scratch area for page-ins/outs at the end
+ * of the address space, one per page of a prefetch batch
  */
-#define Z_VM_RESERVED	CONFIG_MMU_PAGE_SIZE
+#ifdef CONFIG_DEMAND_PAGING_PREFETCH
+#define Z_SCRATCH_PAGES	CONFIG_DEMAND_PAGING_PREFETCH_PAGES
+#else
+#define Z_SCRATCH_PAGES	1
+#endif
+#define Z_VM_RESERVED	(Z_SCRATCH_PAGES * CONFIG_MMU_PAGE_SIZE)
 #define Z_SCRATCH_PAGE	((void *)((uintptr_t)CONFIG_KERNEL_VM_BASE + \
 				     (uintptr_t)CONFIG_KERNEL_VM_SIZE - \
-				     CONFIG_MMU_PAGE_SIZE))
+				     Z_VM_RESERVED))
+#define Z_SCRATCH_PAGE_N(n) \
+	((void *)((uintptr_t)Z_SCRATCH_PAGE + ((n) * CONFIG_MMU_PAGE_SIZE)))
 #else
 #define Z_VM_RESERVED	0
 #endif
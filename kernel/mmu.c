@@ -1220,10 +1220,18 @@ out:
 }
 
 static inline void paging_stats_faults_inc(struct k_thread *faulting_thread,
-					   int key)
+					   int key, void *addr)
 {
 #ifdef CONFIG_DEMAND_PAGING_STATS
 	bool is_irq_unlocked = arch_irq_unlocked(key);
+#if defined(CONFIG_DEMAND_PAGING_REGION_STATS) && \
+	defined(CONFIG_DEMAND_PAGING_THREAD_STATS)
+	enum k_mem_paging_region region = z_paging_region_fault_inc(addr);
+#elif defined(CONFIG_DEMAND_PAGING_REGION_STATS)
+	(void)z_paging_region_fault_inc(addr);
+#else
+	ARG_UNUSED(addr);
+#endif
 
 	paging_stats.pagefaults.cnt++;
 
@@ -1241,6 +1249,10 @@ static inline void paging_stats_faults_inc(struct k_thread *faulting_thread,
 	} else {
 		faulting_thread->paging_stats.pagefaults.irq_locked++;
 	}
+
+#ifdef CONFIG_DEMAND_PAGING_REGION_STATS
+	faulting_thread->paging_stats.regions[region].faults++;
+#endif
 #else
 	ARG_UNUSED(faulting_thread);
 #endif
@@ -1312,6 +1324,139 @@ static inline struct z_page_frame *do_eviction_select(bool *dirty)
 	return pf;
 }
 
+#ifdef CONFIG_DEMAND_PAGING_PREFETCH
+/* Data page following the last page fault, to detect sequential access */
+static uint8_t *prefetch_next;
+
+static inline void do_backing_store_page_in_multi(struct z_page_frame **pfs,
+						  uintptr_t *locations,
+						  size_t count)
+{
+#ifdef CONFIG_BACKING_STORE_PAGE_IN_MULTI
+	for (size_t i = 0; i < count; i++) {
+		arch_mem_scratch_n(i, z_page_frame_to_phys(pfs[i]));
+	}
+	k_mem_paging_backing_store_page_in_multi(locations, count);
+#else
+	for (size_t i = 0; i < count; i++) {
+		arch_mem_scratch(z_page_frame_to_phys(pfs[i]));
+		do_backing_store_page_in(locations[i]);
+	}
+#endif /* CONFIG_BACKING_STORE_PAGE_IN_MULTI */
+}
+
+/*
+ * Page in the data pages following the one that just faulted in at
+ * fault_pf, if the page fault continues a sequential access. Stops at the
+ * first data page not paged out, or when the backing store is down to the
+ * location it keeps for page faults.
+ *
+ * Called with interrupts locked, and returns with them locked. The key is
+ * updated if they were unlocked in between.
+ */
+static int do_prefetch(struct z_page_frame *fault_pf, int key)
+{
+	struct z_page_frame *pfs[CONFIG_DEMAND_PAGING_PREFETCH_PAGES];
+	uintptr_t locations[CONFIG_DEMAND_PAGING_PREFETCH_PAGES];
+	uint8_t *addr = fault_pf->addr;
+	size_t count = 0;
+
+	if (addr != prefetch_next) {
+		prefetch_next = addr + CONFIG_MMU_PAGE_SIZE;
+		return key;
+	}
+
+	/* Don't evict the data page we just loaded to make room */
+	fault_pf->flags |= Z_PAGE_FRAME_BUSY;
+
+	while (count < CONFIG_DEMAND_PAGING_PREFETCH_PAGES) {
+		uint8_t *next = addr + ((count + 1) * CONFIG_MMU_PAGE_SIZE);
+		struct z_page_frame *pf;
+		uintptr_t page_out_location;
+		enum arch_page_location status;
+		bool dirty = false;
+		bool evicted = false;
+
+		if (next >= Z_VIRT_REGION_END_ADDR) {
+			break;
+		}
+
+		status = arch_page_location_get(next, &locations[count]);
+		if (status != ARCH_PAGE_LOCATION_PAGED_OUT) {
+			break;
+		}
+
+		pf = free_page_frame_list_get();
+		if (pf == NULL) {
+			pf = do_eviction_select(&dirty);
+			if (pf == NULL) {
+				break;
+			}
+			evicted = true;
+		}
+
+		/* Not on behalf of a page fault, so that the backing store
+		 * keeps a free location for the next one
+		 */
+		if (page_frame_prepare_locked(pf, &dirty, false,
+					      &page_out_location) != 0) {
+			break;
+		}
+		pf->flags |= Z_PAGE_FRAME_BUSY;
+
+		if (evicted) {
+			paging_stats_eviction_inc(_current_cpu->current, dirty);
+		}
+
+		if (dirty) {
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+			irq_unlock(key);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+			do_backing_store_page_out(page_out_location);
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+			key = irq_lock();
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+		}
+
+		pfs[count++] = pf;
+	}
+
+	if (count > 0) {
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+		irq_unlock(key);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+		do_backing_store_page_in_multi(pfs, locations, count);
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+		key = irq_lock();
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		uint8_t *next = addr + ((i + 1) * CONFIG_MMU_PAGE_SIZE);
+
+		pfs[i]->flags &= ~Z_PAGE_FRAME_BUSY;
+		pfs[i]->flags |= Z_PAGE_FRAME_MAPPED;
+		pfs[i]->addr = next;
+		arch_mem_page_in(next, z_page_frame_to_phys(pfs[i]));
+		k_mem_paging_backing_store_page_finalize(pfs[i], locations[i]);
+	}
+
+	fault_pf->flags &= ~Z_PAGE_FRAME_BUSY;
+
+	/* Faulting right after the batch still counts as sequential */
+	prefetch_next = addr + ((count + 1) * CONFIG_MMU_PAGE_SIZE);
+
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	if (count > 0) {
+		paging_stats.prefetch.batches++;
+		paging_stats.prefetch.pages += count;
+	}
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+
+	return key;
+}
+#endif /* CONFIG_DEMAND_PAGING_PREFETCH */
+
 static bool do_page_fault(void *addr, bool pin)
 {
 	struct z_page_frame *pf;
@@ -1391,7 +1536,7 @@ static bool do_page_fault(void *addr, bool pin)
 	__ASSERT(status == ARCH_PAGE_LOCATION_PAGED_OUT,
 		 "unexpected status value %d", status);
 
-	paging_stats_faults_inc(faulting_thread, key);
+	paging_stats_faults_inc(faulting_thread, key, addr);
 
 	pf = free_page_frame_list_get();
 	if (pf == NULL) {
@@ -1431,6 +1576,11 @@ static bool do_page_fault(void *addr, bool pin)
 
 	arch_mem_page_in(addr, z_page_frame_to_phys(pf));
 	k_mem_paging_backing_store_page_finalize(pf, page_in_location);
+#ifdef CONFIG_DEMAND_PAGING_PREFETCH
+	if (!pin) {
+		key = do_prefetch(pf, key);
+	}
+#endif /* CONFIG_DEMAND_PAGING_PREFETCH */
 out:
 	irq_unlock(key);
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
@@ -32,6 +32,89 @@ static inline void handle_poll_events(struct k_msgq *msgq, uint32_t state)
 }
 #endif /* CONFIG_POLL */
 
+/* A thread pended by k_msgq_put_claim() or k_msgq_get_claim() has this in
+ * its swap data until it is handed a message slot.
+ */
+static char claim_pending;
+#define MSGQ_CLAIM_PENDING ((void *)&claim_pending)
+
+/* Append a message at the write pointer, which may be a claimed slot that
+ * already holds it
+ */
+static inline void msgq_push(struct k_msgq *msgq, const void *data)
+{
+	if (data != msgq->write_ptr) {
+		(void)memcpy(msgq->write_ptr, data, msgq->msg_size);
+	}
+	msgq->write_ptr += msgq->msg_size;
+	if (msgq->write_ptr == msgq->buffer_end) {
+		msgq->write_ptr = msgq->buffer_start;
+	}
+	msgq->used_msgs++;
+}
+
+/* Drop the message at the read pointer */
+static inline void msgq_pop(struct k_msgq *msgq)
+{
+	msgq->read_ptr += msgq->msg_size;
+	if (msgq->read_ptr == msgq->buffer_end) {
+		msgq->read_ptr = msgq->buffer_start;
+	}
+	msgq->used_msgs--;
+}
+
+/* Unpend the next waiter to serve. A pending claimer is only served once it
+ * is the last waiter: the others pended before its claim was recorded, and
+ * serving them later would have them overwrite or consume the claimed slot.
+ */
+static struct k_thread *msgq_waiter_unpend(struct k_msgq *msgq)
+{
+	struct k_thread *thread, *claimer = NULL;
+
+	_WAIT_Q_FOR_EACH(&msgq->wait_q, thread) {
+		if (thread->base.swap_data != MSGQ_CLAIM_PENDING) {
+			break;
+		}
+		claimer = thread;
+	}
+
+	if (thread == NULL) {
+		thread = claimer;
+	}
+	if (thread != NULL) {
+		z_unpend_thread(thread);
+	}
+
+	return thread;
+}
+
+/* Give a message to a waiting reader and wake it up */
+static void msgq_reader_give(struct k_msgq *msgq, struct k_thread *reader,
+			     const void *data)
+{
+	if (reader->base.swap_data == MSGQ_CLAIM_PENDING) {
+		/* queue is empty: the message becomes the claimed head */
+		msgq_push(msgq, data);
+		reader->base.swap_data = msgq->read_ptr;
+	} else {
+		(void)memcpy(reader->base.swap_data, data, msgq->msg_size);
+	}
+	arch_thread_return_value_set(reader, 0);
+	z_ready_thread(reader);
+}
+
+/* Fill the slot freed by a reader from a waiting writer and wake it up */
+static void msgq_writer_take(struct k_msgq *msgq, struct k_thread *writer)
+{
+	if (writer->base.swap_data == MSGQ_CLAIM_PENDING) {
+		writer->base.swap_data = msgq->write_ptr;
+	} else {
+		msgq_push(msgq, writer->base.swap_data);
+	}
+	arch_thread_return_value_set(writer, 0);
+	z_ready_thread(writer);
+}
+
 void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 		 uint32_t max_msgs)
 {
@@ -125,28 +208,22 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put, msgq, timeout);
 
-	if (msgq->used_msgs < msgq->max_msgs) {
+	if ((msgq->flags & K_MSGQ_FLAG_PUT_CLAIM) != 0U) {
+		/* the write pointer belongs to the claimer */
+		result = -EBUSY;
+	} else if (msgq->used_msgs < msgq->max_msgs) {
 		/* message queue isn't full */
-		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		pending_thread = msgq_waiter_unpend(msgq);
 		if (pending_thread != NULL) {
 			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, 0);
 
-			/* give message to waiting thread */
-			(void)memcpy(pending_thread->base.swap_data, data,
-			       msgq->msg_size);
-			/* wake up waiting thread */
-			arch_thread_return_value_set(pending_thread, 0);
-			z_ready_thread(pending_thread);
+			/* give message to waiting thread and wake it up */
+			msgq_reader_give(msgq, pending_thread, data);
 			z_reschedule(&msgq->lock, key);
 			return 0;
 		} else {
 			/* put message in queue */
-			(void)memcpy(msgq->write_ptr, data, msgq->msg_size);
-			msgq->write_ptr += msgq->msg_size;
-			if (msgq->write_ptr == msgq->buffer_end) {
-				msgq->write_ptr = msgq->buffer_start;
-			}
-			msgq->used_msgs++;
+			msgq_push(msgq, data);
 #ifdef CONFIG_POLL
 			handle_poll_events(msgq, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
 #endif /* CONFIG_POLL */
@@ -215,32 +292,21 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get, msgq, timeout);
 
-	if (msgq->used_msgs > 0U) {
+	if ((msgq->flags & K_MSGQ_FLAG_GET_CLAIM) != 0U) {
+		/* the read pointer belongs to the claimer */
+		result = -EBUSY;
+	} else if (msgq->used_msgs > 0U) {
 		/* take first available message from queue */
 		(void)memcpy(data, msgq->read_ptr, msgq->msg_size);
-		msgq->read_ptr += msgq->msg_size;
-		if (msgq->read_ptr == msgq->buffer_end) {
-			msgq->read_ptr = msgq->buffer_start;
-		}
-		msgq->used_msgs--;
+		msgq_pop(msgq);
 
 		/* handle first thread waiting to write (if any) */
-		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		pending_thread = msgq_waiter_unpend(msgq);
 		if (pending_thread != NULL) {
 			SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get, msgq, timeout);
 
-			/* add thread's message to queue */
-			(void)memcpy(msgq->write_ptr, pending_thread->base.swap_data,
-			       msgq->msg_size);
-			msgq->write_ptr += msgq->msg_size;
-			if (msgq->write_ptr == msgq->buffer_end) {
-				msgq->write_ptr = msgq->buffer_start;
-			}
-			msgq->used_msgs++;
-
-			/* wake up waiting thread */
-			arch_thread_return_value_set(pending_thread, 0);
-			z_ready_thread(pending_thread);
+			/* add thread's message to queue and wake it up */
+			msgq_writer_take(msgq, pending_thread);
 			z_reschedule(&msgq->lock, key);
 
 			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get, msgq, timeout, 0);
@@ -315,6 +381,153 @@ static inline int z_vrfy_k_msgq_peek(struct k_msgq *msgq, void *data)
 #include <syscalls/k_msgq_peek_mrsh.c>
 #endif
 
+/* Wait for a claim once the flag recording it has been set, the slot is
+ * handed over by msgq_reader_give() or msgq_writer_take().
+ */
+static int msgq_claim_pend(struct k_msgq *msgq, k_spinlock_key_t key,
+			   uint8_t flag, void **data, k_timeout_t timeout)
+{
+	int result;
+
+	msgq->flags |= flag;
+	_current->base.swap_data = MSGQ_CLAIM_PENDING;
+
+	result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+	if (result == 0) {
+		*data = _current->base.swap_data;
+	} else {
+		key = k_spin_lock(&msgq->lock);
+		msgq->flags &= ~flag;
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return result;
+}
+
+int k_msgq_put_claim(struct k_msgq *msgq, void **data, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	k_spinlock_key_t key;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if ((msgq->flags & K_MSGQ_FLAG_PUT_CLAIM) != 0U) {
+		result = -EBUSY;
+	} else if (msgq->used_msgs < msgq->max_msgs) {
+		msgq->flags |= K_MSGQ_FLAG_PUT_CLAIM;
+		*data = msgq->write_ptr;
+		result = 0;
+	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		result = -ENOMSG;
+	} else {
+		return msgq_claim_pend(msgq, key, K_MSGQ_FLAG_PUT_CLAIM, data,
+				       timeout);
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return result;
+}
+
+int k_msgq_put_commit(struct k_msgq *msgq, bool discard)
+{
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&msgq->lock);
+
+	CHECKIF((msgq->flags & K_MSGQ_FLAG_PUT_CLAIM) == 0U) {
+		k_spin_unlock(&msgq->lock, key);
+
+		return -EINVAL;
+	}
+
+	msgq->flags &= ~K_MSGQ_FLAG_PUT_CLAIM;
+
+	if (!discard) {
+		pending_thread = msgq_waiter_unpend(msgq);
+		if (pending_thread != NULL) {
+			msgq_reader_give(msgq, pending_thread, msgq->write_ptr);
+			z_reschedule(&msgq->lock, key);
+			return 0;
+		}
+
+		msgq_push(msgq, msgq->write_ptr);
+#ifdef CONFIG_POLL
+		handle_poll_events(msgq, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+#endif /* CONFIG_POLL */
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return 0;
+}
+
+int k_msgq_get_claim(struct k_msgq *msgq, void **data, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	k_spinlock_key_t key;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if ((msgq->flags & K_MSGQ_FLAG_GET_CLAIM) != 0U) {
+		result = -EBUSY;
+	} else if (msgq->used_msgs > 0U) {
+		msgq->flags |= K_MSGQ_FLAG_GET_CLAIM;
+		*data = msgq->read_ptr;
+		result = 0;
+	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		result = -ENOMSG;
+	} else {
+		return msgq_claim_pend(msgq, key, K_MSGQ_FLAG_GET_CLAIM, data,
+				       timeout);
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return result;
+}
+
+int k_msgq_get_finish(struct k_msgq *msgq, bool keep)
+{
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&msgq->lock);
+
+	CHECKIF((msgq->flags & K_MSGQ_FLAG_GET_CLAIM) == 0U) {
+		k_spin_unlock(&msgq->lock, key);
+
+		return -EINVAL;
+	}
+
+	msgq->flags &= ~K_MSGQ_FLAG_GET_CLAIM;
+
+	if (keep) {
+#ifdef CONFIG_POLL
+		/* a message handed over to the claimer was never signaled */
+		handle_poll_events(msgq, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+#endif /* CONFIG_POLL */
+	} else {
+		msgq_pop(msgq);
+
+		pending_thread = msgq_waiter_unpend(msgq);
+		if (pending_thread != NULL) {
+			msgq_writer_take(msgq, pending_thread);
+			z_reschedule(&msgq->lock, key);
+			return 0;
+		}
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return 0;
+}
+
 void z_impl_k_msgq_purge(struct k_msgq *msgq)
 {
 	k_spinlock_key_t key;
@@ -330,6 +543,13 @@ void z_impl_k_msgq_purge(struct k_msgq *msgq)
 		z_ready_thread(pending_thread);
 	}
 
+	/* a granted get claim points at a message that is gone, while a
+	 * pending one (on an empty queue) is dropped by its owner on wake up
+	 */
+	if (msgq->used_msgs > 0U) {
+		msgq->flags &= ~K_MSGQ_FLAG_GET_CLAIM;
+	}
+
 	msgq->used_msgs = 0;
 	msgq->read_ptr = msgq->write_ptr;
 
@@ -92,18 +92,11 @@ static bool adjust_owner_prio(struct k_mutex *mutex, int32_t new_prio)
 	return false;
 }
 
-int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
+/* Take the mutex if it is free or already owned by the current thread,
+ * called with the lock held
+ */
+static inline bool mutex_acquire(struct k_mutex *mutex)
 {
-	int new_prio;
-	k_spinlock_key_t key;
-	bool resched = false;
-
-	__ASSERT(!arch_is_in_isr(), "mutexes cannot be used inside ISRs");
-
-	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mutex, lock, mutex, timeout);
-
-	key = k_spin_lock(&lock);
-
 	if (likely((mutex->lock_count == 0U) || (mutex->owner == _current))) {
 
 		mutex->owner_orig_prio = (mutex->lock_count == 0U) ?
@@ -117,6 +110,77 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 			_current, mutex, mutex->lock_count,
 			mutex->owner_orig_prio);
 
+		return true;
+	}
+
+	return false;
+}
+
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+/* True if the thread is running on another CPU, and so likely to release
+ * the mutexes it owns shortly. This is only a hint, the answer can be
+ * stale by the time it is used.
+ */
+static bool owner_running_elsewhere(struct k_thread *owner)
+{
+	unsigned int currcpu = arch_curr_cpu()->id;
+
+	for (unsigned int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		if ((i != currcpu) &&
+		    (*(struct k_thread *volatile *)&_kernel.cpus[i].current ==
+		     owner)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Spin while the owner of the mutex runs on another CPU, then try to take
+ * it. Spinning is pointless when there are waiters, as the owner hands the
+ * mutex over to the first one on unlock. There is no priority to inherit
+ * while spinning either: the owner is already running.
+ *
+ * Called with the lock held, which is dropped while spinning.
+ */
+static bool mutex_spin(struct k_mutex *mutex, k_spinlock_key_t *key)
+{
+	struct k_thread *owner = mutex->owner;
+	volatile uint32_t *lock_count = &mutex->lock_count;
+
+	if ((z_waitq_head(&mutex->wait_q) != NULL) ||
+	    !owner_running_elsewhere(owner)) {
+		return false;
+	}
+
+	k_spin_unlock(&lock, *key);
+
+	for (int i = 0; i < CONFIG_MUTEX_ADAPTIVE_SPIN_COUNT; i++) {
+		if ((*lock_count == 0U) || !owner_running_elsewhere(owner)) {
+			break;
+		}
+		arch_nop();
+	}
+
+	*key = k_spin_lock(&lock);
+
+	return (z_waitq_head(&mutex->wait_q) == NULL) && mutex_acquire(mutex);
+}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
+int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
+{
+	int new_prio;
+	k_spinlock_key_t key;
+	bool resched = false;
+
+	__ASSERT(!arch_is_in_isr(), "mutexes cannot be used inside ISRs");
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mutex, lock, mutex, timeout);
+
+	key = k_spin_lock(&lock);
+
+	if (mutex_acquire(mutex)) {
 		k_spin_unlock(&lock, key);
 
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, 0);
@@ -132,6 +196,16 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 		return -EBUSY;
 	}
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+	if (mutex_spin(mutex, &key)) {
+		k_spin_unlock(&lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, 0);
+
+		return 0;
+	}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_mutex, lock, mutex, timeout);
 
 	new_prio = new_prio_for_inheritance(_current->base.prio,
@@ -9,9 +9,97 @@
 #include <zephyr/syscall_handler.h>
 #include <zephyr/toolchain.h>
 #include <zephyr/sys/mem_manage.h>
+#include <mmu.h>
+#include <kernel_arch_interface.h>
 
 extern struct k_mem_paging_stats_t paging_stats;
 
+#ifdef CONFIG_DEMAND_PAGING_REGION_STATS
+/* Start of the current fault rate window and the faults counted in it */
+static int64_t region_window_start;
+static unsigned long region_window_faults[K_MEM_PAGING_REGION_NUM];
+
+static enum k_mem_paging_region paging_region_get(void *addr)
+{
+	uint8_t *virt = addr;
+
+	if ((virt >= Z_KERNEL_VIRT_START) && (virt < Z_KERNEL_VIRT_END)) {
+		return K_MEM_PAGING_REGION_IMAGE;
+	}
+
+	return K_MEM_PAGING_REGION_ANON;
+}
+
+/* Close the fault rate window if it is over, called with IRQs locked.
+ * Done lazily on faults and reads rather than from a timer.
+ */
+static void region_window_update(void)
+{
+	int64_t elapsed = k_uptime_get() - region_window_start;
+
+	if (elapsed < CONFIG_DEMAND_PAGING_REGION_STATS_WINDOW) {
+		return;
+	}
+
+	for (int i = 0; i < K_MEM_PAGING_REGION_NUM; i++) {
+		paging_stats.regions[i].fault_rate =
+			(unsigned long)((region_window_faults[i] * 1000ULL) /
+					elapsed);
+		region_window_faults[i] = 0;
+	}
+	region_window_start += elapsed;
+}
+
+enum k_mem_paging_region z_paging_region_fault_inc(void *addr)
+{
+	enum k_mem_paging_region region = paging_region_get(addr);
+
+	region_window_update();
+	paging_stats.regions[region].faults++;
+	region_window_faults[region]++;
+
+	return region;
+}
+
+/* Count the resident and recently accessed data pages of each region */
+static void region_pages_get(struct k_mem_paging_stats_t *stats)
+{
+	unsigned long resident[K_MEM_PAGING_REGION_NUM] = { 0 };
+	unsigned long working_set[K_MEM_PAGING_REGION_NUM] = { 0 };
+	struct z_page_frame *pf;
+	enum k_mem_paging_region region;
+	uintptr_t flags, phys;
+	int key;
+
+	key = irq_lock();
+	region_window_update();
+	Z_PAGE_FRAME_FOREACH(phys, pf) {
+		if (z_page_frame_is_reserved(pf) || !z_page_frame_is_mapped(pf)) {
+			continue;
+		}
+
+		region = paging_region_get(pf->addr);
+		resident[region]++;
+
+		flags = arch_page_info_get(pf->addr, NULL, false);
+		if ((flags & ARCH_DATA_PAGE_ACCESSED) != 0UL) {
+			working_set[region]++;
+		}
+	}
+
+	/* Fault rates may have just been updated */
+	for (int i = 0; i < K_MEM_PAGING_REGION_NUM; i++) {
+		stats->regions[i].fault_rate = paging_stats.regions[i].fault_rate;
+	}
+	irq_unlock(key);
+
+	for (int i = 0; i < K_MEM_PAGING_REGION_NUM; i++) {
+		stats->regions[i].resident = resident[i];
+		stats->regions[i].working_set = working_set[i];
+	}
+}
+#endif /* CONFIG_DEMAND_PAGING_REGION_STATS */
+
 #ifdef CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM
 struct k_mem_paging_histogram_t z_paging_histogram_eviction;
 struct k_mem_paging_histogram_t z_paging_histogram_backing_store_page_in;
@@ -96,6 +184,10 @@ void z_impl_k_mem_paging_stats_get(struct k_mem_paging_stats_t *stats)
 
 	/* Copy statistics */
 	memcpy(stats, &paging_stats, sizeof(paging_stats));
+
+#ifdef CONFIG_DEMAND_PAGING_REGION_STATS
+	region_pages_get(stats);
+#endif
 }
 
 #ifdef CONFIG_USERSPACE
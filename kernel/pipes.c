@@ -38,6 +38,8 @@ void k_pipe_init(struct k_pipe *pipe, unsigned char *buffer, size_t size)
 	pipe->bytes_used = 0;
 	pipe->read_index = 0;
 	pipe->write_index = 0;
+	pipe->put_claimed = 0;
+	pipe->get_claimed = 0;
 	pipe->lock = (struct k_spinlock){};
 	z_waitq_init(&pipe->wait_q.writers);
 	z_waitq_init(&pipe->wait_q.readers);
@@ -91,6 +93,7 @@ void z_impl_k_pipe_flush(struct k_pipe *pipe)
 
 	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
 
+	pipe->get_claimed = 0;
 	(void) pipe_get_internal(key, pipe, NULL, (size_t) -1, &bytes_read, 0,
 				 K_NO_WAIT);
 
@@ -115,6 +118,7 @@ void z_impl_k_pipe_buffer_flush(struct k_pipe *pipe)
 
 	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
 
+	pipe->get_claimed = 0;
 	if (pipe->buffer != NULL) {
 		(void) pipe_get_internal(key, pipe, NULL, pipe->size,
 					 &bytes_read, 0, K_NO_WAIT);
@@ -160,6 +164,8 @@ int k_pipe_cleanup(struct k_pipe *pipe)
 		pipe->bytes_used = 0;
 		pipe->read_index = 0;
 		pipe->write_index = 0;
+		pipe->put_claimed = 0;
+		pipe->get_claimed = 0;
 		pipe->flags &= ~K_PIPE_FLAG_ALLOC;
 	}
 
@@ -412,6 +418,16 @@ int z_impl_k_pipe_put(struct k_pipe *pipe, void *data, size_t bytes_to_write,
 
 	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
 
+	if (pipe->put_claimed != 0U) {
+		/* The data must follow the claimed bytes */
+		k_spin_unlock(&pipe->lock, key);
+		*bytes_written = 0;
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, put, pipe, timeout, -EBUSY);
+
+		return -EBUSY;
+	}
+
 	/*
 	 * Create a list of "working readers" into which the data will be
 	 * directly copied.
@@ -735,6 +751,16 @@ int z_impl_k_pipe_get(struct k_pipe *pipe, void *data, size_t bytes_to_read,
 
 	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
 
+	if (pipe->get_claimed != 0U) {
+		/* The claimed bytes must be consumed first */
+		k_spin_unlock(&pipe->lock, key);
+		*bytes_read = 0;
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, get, pipe, timeout, -EBUSY);
+
+		return -EBUSY;
+	}
+
 	int ret = pipe_get_internal(key, pipe, data, bytes_to_read, bytes_read,
 				    min_xfer, timeout);
 
@@ -758,6 +784,230 @@ int z_vrfy_k_pipe_get(struct k_pipe *pipe, void *data, size_t bytes_to_read,
 #include <syscalls/k_pipe_get_mrsh.c>
 #endif
 
+/**
+ * @brief Wait for the next transfer on a pipe
+ *
+ * The caller pends on @a wait_q as a reader or writer of zero bytes, so it
+ * is woken up by the next transfer in the other direction without any data
+ * being copied, and can then check the pipe's buffer again.
+ *
+ * @return 0 if woken up, -EIO or -EAGAIN if out of time
+ */
+static int pipe_claim_wait(struct k_pipe *pipe, k_spinlock_key_t *key,
+			   _wait_q_t *wait_q, k_timeout_t timeout,
+			   uint64_t end)
+{
+	struct k_pipe_desc pipe_desc = { .buffer = NULL, .bytes_to_xfer = 0 };
+	int64_t remaining;
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		return -EIO;
+	}
+
+	if (!K_TIMEOUT_EQ(timeout, K_FOREVER)) {
+		remaining = (int64_t)(end - sys_clock_tick_get());
+		if (remaining <= 0) {
+			return -EAGAIN;
+		}
+		timeout = K_TICKS(remaining);
+	}
+
+	_current->base.swap_data = &pipe_desc;
+	(void)z_pend_curr(&pipe->lock, *key, wait_q, timeout);
+	*key = k_spin_lock(&pipe->lock);
+
+	return 0;
+}
+
+static void pipe_claim_xfer(struct k_pipe *pipe, struct k_pipe_desc *desc,
+			    bool reader)
+{
+	size_t bytes_copied;
+
+	if (reader) {
+		bytes_copied = pipe_buffer_get(pipe, desc->buffer,
+					       desc->bytes_to_xfer);
+	} else {
+		bytes_copied = pipe_buffer_put(pipe, desc->buffer,
+					       desc->bytes_to_xfer);
+	}
+
+	desc->buffer         += bytes_copied;
+	desc->bytes_to_xfer  -= bytes_copied;
+}
+
+/**
+ * @brief Hand the buffered data to waiting readers, or fill the buffer from
+ * waiting writers, after a commit or finish
+ *
+ * Called with @a pipe locked, which is unlocked on return.
+ */
+static void pipe_claim_release(struct k_pipe *pipe, k_spinlock_key_t key,
+			       bool readers)
+{
+	struct k_thread    *waiter;
+	struct k_thread    *thread;
+	struct k_pipe_desc *desc;
+	sys_dlist_t    xfer_list;
+	_wait_q_t      *wait_q = readers ? &pipe->wait_q.readers :
+					   &pipe->wait_q.writers;
+
+	if (z_waitq_head(wait_q) == NULL) {
+		k_spin_unlock(&pipe->lock, key);
+		return;
+	}
+
+	(void)pipe_xfer_prepare(&xfer_list, &waiter, wait_q, 0,
+				readers ? pipe->bytes_used :
+					  pipe->size - pipe->bytes_used,
+				0, K_FOREVER);
+
+	z_sched_lock();
+	k_spin_unlock(&pipe->lock, key);
+
+	/* As in k_pipe_put() and k_pipe_get(), 'waiter' can still be given
+	 * data even if it times out meanwhile.
+	 */
+	while ((thread = (struct k_thread *)sys_dlist_get(&xfer_list)) != NULL) {
+		desc = (struct k_pipe_desc *)thread->base.swap_data;
+		pipe_claim_xfer(pipe, desc, readers);
+
+		/* The thread's request has been satisfied. Ready it. */
+		z_ready_thread(thread);
+	}
+
+	if (waiter != NULL) {
+		desc = (struct k_pipe_desc *)waiter->base.swap_data;
+		pipe_claim_xfer(pipe, desc, readers);
+	}
+
+	k_sched_unlock();
+}
+
+int k_pipe_put_claim(struct k_pipe *pipe, void **data, size_t *size,
+		     k_timeout_t timeout)
+{
+	uint64_t end = sys_clock_timeout_end_calc(timeout);
+	int ret;
+
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	CHECKIF((pipe->buffer == NULL) || (*size == 0U)) {
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+	do {
+		if (pipe->put_claimed != 0U) {
+			ret = -EBUSY;
+			break;
+		}
+
+		if (pipe->bytes_used < pipe->size) {
+			/* No writer is waiting when there is space */
+			*size = MIN(*size, MIN(pipe->size - pipe->bytes_used,
+					       pipe->size - pipe->write_index));
+			*data = pipe->buffer + pipe->write_index;
+			pipe->put_claimed = *size;
+			ret = 0;
+			break;
+		}
+
+		ret = pipe_claim_wait(pipe, &key, &pipe->wait_q.writers,
+				      timeout, end);
+	} while (ret == 0);
+
+	k_spin_unlock(&pipe->lock, key);
+
+	return ret;
+}
+
+int k_pipe_put_commit(struct k_pipe *pipe, size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+	CHECKIF((pipe->put_claimed == 0U) || (size > pipe->put_claimed)) {
+		k_spin_unlock(&pipe->lock, key);
+
+		return -EINVAL;
+	}
+
+	pipe->put_claimed = 0;
+	pipe->bytes_used += size;
+	pipe->write_index += size;
+	if (pipe->write_index == pipe->size) {
+		pipe->write_index = 0;
+	}
+
+	/* Readers only wait on an empty buffer, serve them from the data */
+	pipe_claim_release(pipe, key, true);
+
+	return 0;
+}
+
+int k_pipe_get_claim(struct k_pipe *pipe, void **data, size_t *size,
+		     k_timeout_t timeout)
+{
+	uint64_t end = sys_clock_timeout_end_calc(timeout);
+	int ret;
+
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	CHECKIF((pipe->buffer == NULL) || (*size == 0U)) {
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+	do {
+		if (pipe->get_claimed != 0U) {
+			ret = -EBUSY;
+			break;
+		}
+
+		if (pipe->bytes_used > 0U) {
+			/* No reader is waiting when there is data */
+			*size = MIN(*size, MIN(pipe->bytes_used,
+					       pipe->size - pipe->read_index));
+			*data = pipe->buffer + pipe->read_index;
+			pipe->get_claimed = *size;
+			ret = 0;
+			break;
+		}
+
+		ret = pipe_claim_wait(pipe, &key, &pipe->wait_q.readers,
+				      timeout, end);
+	} while (ret == 0);
+
+	k_spin_unlock(&pipe->lock, key);
+
+	return ret;
+}
+
+int k_pipe_get_finish(struct k_pipe *pipe, size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+	CHECKIF((pipe->get_claimed == 0U) || (size > pipe->get_claimed)) {
+		k_spin_unlock(&pipe->lock, key);
+
+		return -EINVAL;
+	}
+
+	pipe->get_claimed = 0;
+	pipe->bytes_used -= size;
+	pipe->read_index += size;
+	if (pipe->read_index == pipe->size) {
+		pipe->read_index = 0;
+	}
+
+	/* Writers only wait on a full buffer, move their data in */
+	pipe_claim_release(pipe, key, false);
+
+	return 0;
+}
+
 size_t z_impl_k_pipe_read_avail(struct k_pipe *pipe)
 {
 	size_t res;
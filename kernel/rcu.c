@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file @brief RCU-style read-mostly synchronization
+ *
+ * Readers lock the scheduler, so a thread cannot be switched out in the
+ * middle of a read-side critical section. On a uniprocessor system, every
+ * critical section has therefore ended by the time an updater runs, and a
+ * grace period is free.
+ *
+ * On SMP, each CPU keeps the nesting depth of the current read-side
+ * critical section and the number of critical sections it has left. A
+ * grace period waits until each other CPU has either been seen outside a
+ * critical section or has left the one it was in.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel_structs.h>
+#include <zephyr/sys/atomic.h>
+
+#ifdef CONFIG_SMP
+static struct {
+	atomic_t nest;
+	atomic_t seq;
+} rcu_cpu[CONFIG_MP_NUM_CPUS];
+
+void z_rcu_read_lock(void)
+{
+	/* The scheduler lock keeps the thread on this CPU until unlock */
+	if (!k_is_in_isr()) {
+		k_sched_lock();
+	}
+
+	(void)atomic_inc(&rcu_cpu[arch_curr_cpu()->id].nest);
+}
+
+void z_rcu_read_unlock(void)
+{
+	unsigned int id = arch_curr_cpu()->id;
+
+	__ASSERT(atomic_get(&rcu_cpu[id].nest) > 0,
+		 "not in an RCU read-side critical section");
+
+	if (atomic_dec(&rcu_cpu[id].nest) == 1) {
+		(void)atomic_inc(&rcu_cpu[id].seq);
+	}
+
+	if (!k_is_in_isr()) {
+		k_sched_unlock();
+	}
+}
+#endif /* CONFIG_SMP */
+
+void k_rcu_synchronize(void)
+{
+#ifdef CONFIG_SMP
+	atomic_val_t seq[CONFIG_MP_NUM_CPUS];
+	unsigned int currcpu;
+#endif /* CONFIG_SMP */
+
+	__ASSERT(!k_is_in_isr(), "RCU grace periods cannot be waited in ISRs");
+
+#ifdef CONFIG_SMP
+	/* The thread may migrate while waiting, which does not matter: it is
+	 * not in a critical section, and so neither is its CPU.
+	 */
+	k_sched_lock();
+	currcpu = arch_curr_cpu()->id;
+	__ASSERT(atomic_get(&rcu_cpu[currcpu].nest) == 0,
+		 "RCU grace periods cannot be waited in read-side critical sections");
+	for (unsigned int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		seq[i] = atomic_get(&rcu_cpu[i].seq);
+	}
+	k_sched_unlock();
+
+	for (unsigned int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		if (i == currcpu) {
+			continue;
+		}
+
+		while ((atomic_get(&rcu_cpu[i].nest) != 0) &&
+		       (atomic_get(&rcu_cpu[i].seq) == seq[i])) {
+			k_yield();
+		}
+	}
+#endif /* CONFIG_SMP */
+}
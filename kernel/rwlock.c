@@ -0,0 +1,354 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file @brief reader-writer lock kernel services
+ *
+ * A reader-writer lock is held either by any number of readers or by a
+ * single writer. Waiting writers take precedence over new readers, so that
+ * a steady flow of readers cannot starve writers out, and the lock is
+ * handed over directly to the next owner(s) on unlock.
+ *
+ * The writer holding the lock inherits the priority of the highest priority
+ * waiter, following the same nesting rules as mutexes. Readers are only
+ * counted, not tracked, so their priority cannot be raised.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel_structs.h>
+#include <ksched.h>
+#include <zephyr/wait_q.h>
+#include <errno.h>
+#include <zephyr/syscall_handler.h>
+#include <zephyr/sys/check.h>
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(os, CONFIG_KERNEL_LOG_LEVEL);
+
+/* Global like the mutex one, as it protects the writer's priority too */
+static struct k_spinlock lock;
+
+int z_impl_k_rwlock_init(struct k_rwlock *rwlock)
+{
+	rwlock->writer = NULL;
+	rwlock->readers = 0U;
+
+	z_waitq_init(&rwlock->readers_q);
+	z_waitq_init(&rwlock->writers_q);
+
+	z_object_init(rwlock);
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_init(struct k_rwlock *rwlock)
+{
+	Z_OOPS(Z_SYSCALL_OBJ_INIT(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_init(rwlock);
+}
+#include <syscalls/k_rwlock_init_mrsh.c>
+#endif
+
+static int32_t new_prio_for_inheritance(int32_t target, int32_t limit)
+{
+	int new_prio = z_is_prio_higher(target, limit) ? target : limit;
+
+	return z_get_new_prio_with_ceiling(new_prio);
+}
+
+/* Priority the writer should run at: its own, raised to that of the
+ * highest priority waiter
+ */
+static int32_t writer_prio(struct k_rwlock *rwlock)
+{
+	struct k_thread *reader = z_waitq_head(&rwlock->readers_q);
+	struct k_thread *writer = z_waitq_head(&rwlock->writers_q);
+	int32_t prio = rwlock->writer_orig_prio;
+
+	if (reader != NULL) {
+		prio = new_prio_for_inheritance(reader->base.prio, prio);
+	}
+	if (writer != NULL) {
+		prio = new_prio_for_inheritance(writer->base.prio, prio);
+	}
+
+	return prio;
+}
+
+static bool adjust_writer_prio(struct k_rwlock *rwlock, int32_t new_prio)
+{
+	if (rwlock->writer->base.prio != new_prio) {
+		LOG_DBG("%p rwlock %p writer prio changed to %d (was %d)",
+			rwlock->writer, rwlock, new_prio,
+			rwlock->writer->base.prio);
+
+		return z_set_prio(rwlock->writer, new_prio);
+	}
+
+	return false;
+}
+
+/* Raise the writer's priority to the current thread's before it waits,
+ * called with the lock held
+ */
+static bool boost_writer(struct k_rwlock *rwlock)
+{
+	int32_t new_prio;
+
+	if (rwlock->writer == NULL) {
+		return false;
+	}
+
+	new_prio = new_prio_for_inheritance(_current->base.prio,
+					    rwlock->writer->base.prio);
+	if (z_is_prio_higher(new_prio, rwlock->writer->base.prio)) {
+		return adjust_writer_prio(rwlock, new_prio);
+	}
+
+	return false;
+}
+
+/* Hand the lock over to the first waiting writer, if any. The new writer
+ * is already of higher or equal priority than the other waiting writers,
+ * but waiting readers may still raise it. Called with the lock held and
+ * the lock free.
+ */
+static bool wake_writer(struct k_rwlock *rwlock)
+{
+	struct k_thread *thread = z_unpend_first_thread(&rwlock->writers_q);
+
+	if (thread == NULL) {
+		return false;
+	}
+
+	rwlock->writer = thread;
+	rwlock->writer_orig_prio = thread->base.prio;
+	(void)adjust_writer_prio(rwlock, writer_prio(rwlock));
+
+	LOG_DBG("new writer of rwlock %p: %p", rwlock, thread);
+
+	arch_thread_return_value_set(thread, 0);
+	z_ready_thread(thread);
+
+	return true;
+}
+
+/* Hand the lock over to all the waiting readers, called with the lock held
+ * and no writer waiting
+ */
+static bool wake_readers(struct k_rwlock *rwlock)
+{
+	struct k_thread *thread;
+	bool woken = false;
+
+	while ((thread = z_unpend_first_thread(&rwlock->readers_q)) != NULL) {
+		rwlock->readers++;
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+		woken = true;
+	}
+
+	return woken;
+}
+
+/* Clean up after a timed out wait, called with the lock held */
+static int rwlock_timeout(struct k_rwlock *rwlock, k_spinlock_key_t key)
+{
+	bool resched = false;
+
+	if (rwlock->writer != NULL) {
+		resched = adjust_writer_prio(rwlock, writer_prio(rwlock));
+	} else if (z_waitq_head(&rwlock->writers_q) == NULL) {
+		/* The readers were waiting behind a writer that gave up */
+		resched = wake_readers(rwlock);
+	}
+
+	if (resched) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+
+	return -EAGAIN;
+}
+
+int z_impl_k_rwlock_rdlock(struct k_rwlock *rwlock, k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+	int ret;
+
+	__ASSERT(!arch_is_in_isr(), "rwlocks cannot be used inside ISRs");
+
+	key = k_spin_lock(&lock);
+
+	if (likely((rwlock->writer == NULL) &&
+		   (z_waitq_head(&rwlock->writers_q) == NULL))) {
+		rwlock->readers++;
+		k_spin_unlock(&lock, key);
+
+		return 0;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		k_spin_unlock(&lock, key);
+
+		return -EBUSY;
+	}
+
+	(void)boost_writer(rwlock);
+
+	ret = z_pend_curr(&lock, key, &rwlock->readers_q, timeout);
+	if (ret == 0) {
+		return 0;
+	}
+
+	LOG_DBG("%p timeout on rwlock %p", _current, rwlock);
+
+	return rwlock_timeout(rwlock, k_spin_lock(&lock));
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_rdlock(struct k_rwlock *rwlock,
+					 k_timeout_t timeout)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_rdlock(rwlock, timeout);
+}
+#include <syscalls/k_rwlock_rdlock_mrsh.c>
+#endif
+
+int z_impl_k_rwlock_wrlock(struct k_rwlock *rwlock, k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+	int ret;
+
+	__ASSERT(!arch_is_in_isr(), "rwlocks cannot be used inside ISRs");
+
+	key = k_spin_lock(&lock);
+
+	if (likely((rwlock->writer == NULL) && (rwlock->readers == 0U))) {
+		rwlock->writer = _current;
+		rwlock->writer_orig_prio = _current->base.prio;
+		k_spin_unlock(&lock, key);
+
+		return 0;
+	}
+
+	CHECKIF(rwlock->writer == _current) {
+		k_spin_unlock(&lock, key);
+
+		return -EDEADLK;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		k_spin_unlock(&lock, key);
+
+		return -EBUSY;
+	}
+
+	(void)boost_writer(rwlock);
+
+	ret = z_pend_curr(&lock, key, &rwlock->writers_q, timeout);
+	if (ret == 0) {
+		return 0;
+	}
+
+	LOG_DBG("%p timeout on rwlock %p", _current, rwlock);
+
+	return rwlock_timeout(rwlock, k_spin_lock(&lock));
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_wrlock(struct k_rwlock *rwlock,
+					 k_timeout_t timeout)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_wrlock(rwlock, timeout);
+}
+#include <syscalls/k_rwlock_wrlock_mrsh.c>
+#endif
+
+int z_impl_k_rwlock_rdunlock(struct k_rwlock *rwlock)
+{
+	k_spinlock_key_t key;
+
+	__ASSERT(!arch_is_in_isr(), "rwlocks cannot be used inside ISRs");
+
+	key = k_spin_lock(&lock);
+
+	CHECKIF(rwlock->readers == 0U) {
+		k_spin_unlock(&lock, key);
+
+		return -EINVAL;
+	}
+
+	rwlock->readers--;
+
+	if ((rwlock->readers == 0U) && wake_writer(rwlock)) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_rdunlock(struct k_rwlock *rwlock)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_rdunlock(rwlock);
+}
+#include <syscalls/k_rwlock_rdunlock_mrsh.c>
+#endif
+
+int z_impl_k_rwlock_wrunlock(struct k_rwlock *rwlock)
+{
+	k_spinlock_key_t key;
+	bool resched;
+
+	__ASSERT(!arch_is_in_isr(), "rwlocks cannot be used inside ISRs");
+
+	key = k_spin_lock(&lock);
+
+	CHECKIF(rwlock->writer == NULL) {
+		k_spin_unlock(&lock, key);
+
+		return -EINVAL;
+	}
+
+	CHECKIF(rwlock->writer != _current) {
+		k_spin_unlock(&lock, key);
+
+		return -EPERM;
+	}
+
+	resched = adjust_writer_prio(rwlock, rwlock->writer_orig_prio);
+	rwlock->writer = NULL;
+
+	if (!wake_writer(rwlock)) {
+		resched = wake_readers(rwlock) || resched;
+	} else {
+		resched = true;
+	}
+
+	if (resched) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_wrunlock(struct k_rwlock *rwlock)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_wrunlock(rwlock);
+}
+#include <syscalls/k_rwlock_wrunlock_mrsh.c>
+#endif
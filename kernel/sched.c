@@ -1362,6 +1362,26 @@ static inline void z_vrfy_k_thread_deadline_set(k_tid_t tid, int deadline)
 #endif
 #endif
 
+#ifdef CONFIG_TIMEOUT_SLACK
+void z_impl_k_thread_timer_slack_set(k_tid_t tid, k_timeout_t slack)
+{
+	z_timeout_slack_set(&tid->base.timeout, slack);
+}
+
+#ifdef CONFIG_USERSPACE
+static inline void z_vrfy_k_thread_timer_slack_set(k_tid_t tid,
+						   k_timeout_t slack)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(tid, K_OBJ_THREAD));
+	Z_OOPS(Z_SYSCALL_VERIFY_MSG(K_TIMEOUT_EQ(slack, K_FOREVER) ||
+				    (slack.ticks >= 0),
+				    "invalid thread timer slack"));
+	z_impl_k_thread_timer_slack_set(tid, slack);
+}
+#include <syscalls/k_thread_timer_slack_set_mrsh.c>
+#endif
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 bool k_can_yield(void)
 {
 	return !(k_is_pre_kernel() || k_is_in_isr() ||
@@ -1705,6 +1725,11 @@ static void end_thread(struct k_thread *thread)
 		z_object_uninit(thread->stack_obj);
 		z_object_uninit(thread);
 #endif
+
+#ifdef CONFIG_THREAD_POOL
+		/* Last, as the slot may be reused from here on */
+		z_thread_pool_exit(thread);
+#endif
 	}
 }
 
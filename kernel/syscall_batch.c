@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/syscall_handler.h>
+#include <zephyr/sys/syscall_batch.h>
+#include <string.h>
+
+int z_impl_k_syscall_ring_submit(struct k_syscall_ring *ring)
+{
+	ARG_UNUSED(ring);
+
+	/* Supervisor threads call the implementation functions directly */
+	return -ENOTSUP;
+}
+
+static inline int z_vrfy_k_syscall_ring_submit(struct k_syscall_ring *ring)
+{
+	void *ssf = _current->syscall_frame;
+	struct k_syscall_ring kring;
+	int done = 0;
+
+	Z_OOPS(Z_SYSCALL_MEMORY_WRITE(ring, sizeof(*ring)));
+	(void)memcpy(&kring, ring, sizeof(kring));
+
+	if ((kring.size == 0U) || ((kring.tail - kring.head) > kring.size)) {
+		return -EINVAL;
+	}
+
+	Z_OOPS(Z_SYSCALL_MEMORY_ARRAY_WRITE(kring.reqs, kring.size,
+					    sizeof(struct k_syscall_req)));
+
+	for (uint32_t i = kring.head; i != kring.tail; i++) {
+		struct k_syscall_req *req = &kring.reqs[i % kring.size];
+		struct k_syscall_req kreq;
+		uintptr_t ret;
+
+		/* Work on a copy, the request may be modified concurrently */
+		(void)memcpy(&kreq, req, sizeof(kreq));
+
+		if ((kreq.id >= K_SYSCALL_LIMIT) ||
+		    !_k_syscall_batchable[kreq.id]) {
+			ret = (uintptr_t)-ENOSYS;
+		} else {
+			/* Go through the unmarshalling and verification
+			 * functions, the same way the arch syscall entry does.
+			 * They clear the syscall frame on return.
+			 */
+			ret = _k_syscall_table[kreq.id](kreq.args[0],
+							kreq.args[1],
+							kreq.args[2],
+							kreq.args[3],
+							kreq.args[4],
+							kreq.args[5], ssf);
+			_current->syscall_frame = ssf;
+		}
+
+		req->ret = ret;
+		done++;
+	}
+
+	ring->head = kring.tail;
+
+	return done;
+}
+#include <syscalls/k_syscall_ring_submit_mrsh.c>
@@ -607,6 +607,9 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 		new_thread->base.cpu_mask = -1; /* allow all cpus */
 	}
 #endif
+#ifdef CONFIG_FPU_SHARING_STATS
+	new_thread->float_stats = (struct k_float_stats) {};
+#endif
 #ifdef CONFIG_ARCH_HAS_CUSTOM_SWAP_TO_MAIN
 	/* _current may be null if the dummy thread is not used */
 	if (!_current) {
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file @brief thread pools
+ *
+ * A thread pool hands out thread objects and their stacks from a free list.
+ * A slot is free once it has been released by its owner, which is the pool
+ * itself for spawned threads, and the thread created on it is dead. The
+ * scheduler reports thread exits through z_thread_pool_exit(), and pools
+ * are looked up by the address of the thread object, so that threads
+ * created outside of pools are not affected.
+ *
+ * The exit is reported before the thread switches out for the last time.
+ * On SMP, the thread may therefore still be running on its stack on
+ * another CPU when its slot is freed, so a slot is only handed out again
+ * once the context switch away from its previous thread has completed.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/check.h>
+#include <kernel_internal.h>
+#include <kswap.h>
+
+/* The slot is not on the free list */
+#define SLOT_USED	BIT(0)
+/* The slot is allocated and not released yet */
+#define SLOT_OWNED	BIT(1)
+
+static inline struct k_thread *slot_thread(struct k_thread_pool *pool,
+					   uint32_t slot)
+{
+	return (struct k_thread *)(pool->threads + (slot * pool->thread_size));
+}
+
+static int slot_index(struct k_thread_pool *pool, struct k_thread *thread)
+{
+	uintptr_t offset = (uintptr_t)thread - (uintptr_t)pool->threads;
+
+	if (((uintptr_t)thread < (uintptr_t)pool->threads) ||
+	    (offset >= (pool->count * pool->thread_size)) ||
+	    ((offset % pool->thread_size) != 0U)) {
+		return -1;
+	}
+
+	return offset / pool->thread_size;
+}
+
+/* Called with the pool lock held */
+static void slot_put(struct k_thread_pool *pool, uint32_t slot)
+{
+	pool->flags[slot] = 0U;
+	pool->free[pool->num_free++] = slot;
+}
+
+struct k_thread *k_thread_pool_alloc(struct k_thread_pool *pool)
+{
+	k_spinlock_key_t key = k_spin_lock(&pool->lock);
+	uint32_t slot;
+
+	if (pool->num_free > 0U) {
+		slot = pool->free[--pool->num_free];
+	} else if (pool->next < pool->count) {
+		slot = pool->next++;
+		/* Until a thread is created on it, the slot is as good as
+		 * one whose thread has exited and switched out
+		 */
+		slot_thread(pool, slot)->base.thread_state = _THREAD_DEAD;
+#ifdef CONFIG_SMP
+		slot_thread(pool, slot)->switch_handle = slot_thread(pool, slot);
+#endif
+	} else {
+		k_spin_unlock(&pool->lock, key);
+
+		return NULL;
+	}
+
+	pool->flags[slot] = SLOT_USED | SLOT_OWNED;
+
+	k_spin_unlock(&pool->lock, key);
+
+#ifdef CONFIG_SMP
+	/* The previous thread of the slot may still be switching out */
+	wait_for_switch(slot_thread(pool, slot));
+#endif
+
+	return slot_thread(pool, slot);
+}
+
+k_thread_stack_t *k_thread_pool_stack_get(struct k_thread_pool *pool,
+					  struct k_thread *thread,
+					  size_t *size)
+{
+	int slot = slot_index(pool, thread);
+
+	__ASSERT(slot >= 0, "thread %p not in pool %p", thread, pool);
+
+	*size = pool->stack_size;
+
+	return (k_thread_stack_t *)((char *)pool->stacks +
+				    (slot * pool->stack_len));
+}
+
+void k_thread_pool_free(struct k_thread_pool *pool, struct k_thread *thread)
+{
+	int slot = slot_index(pool, thread);
+	k_spinlock_key_t key;
+
+	CHECKIF(slot < 0) {
+		return;
+	}
+
+	key = k_spin_lock(&pool->lock);
+
+	CHECKIF((pool->flags[slot] & SLOT_OWNED) == 0U) {
+		k_spin_unlock(&pool->lock, key);
+
+		return;
+	}
+
+	/* A live thread puts the slot back from z_thread_pool_exit(). The
+	 * thread is marked dead before that call, so whichever of the two
+	 * takes the pool lock last sees the slot both released and dead.
+	 */
+	pool->flags[slot] &= ~SLOT_OWNED;
+	if ((thread->base.thread_state & _THREAD_DEAD) != 0U) {
+		slot_put(pool, slot);
+	}
+
+	k_spin_unlock(&pool->lock, key);
+}
+
+k_tid_t k_thread_pool_spawn(struct k_thread_pool *pool,
+			    k_thread_entry_t entry,
+			    void *p1, void *p2, void *p3,
+			    int prio, uint32_t options, k_timeout_t delay)
+{
+	struct k_thread *thread = k_thread_pool_alloc(pool);
+	k_thread_stack_t *stack;
+	size_t size;
+
+	if (thread == NULL) {
+		return NULL;
+	}
+
+	stack = k_thread_pool_stack_get(pool, thread, &size);
+	(void)k_thread_create(thread, stack, size, entry, p1, p2, p3, prio,
+			      options, delay);
+
+	/* The slot now belongs to the thread, and is freed when it exits */
+	k_thread_pool_free(pool, thread);
+
+	return thread;
+}
+
+void z_thread_pool_exit(struct k_thread *thread)
+{
+	STRUCT_SECTION_FOREACH(k_thread_pool, pool) {
+		int slot = slot_index(pool, thread);
+
+		if (slot >= 0) {
+			k_spinlock_key_t key = k_spin_lock(&pool->lock);
+
+			if (pool->flags[slot] == SLOT_USED) {
+				slot_put(pool, slot);
+			}
+
+			k_spin_unlock(&pool->lock, key);
+			break;
+		}
+	}
+}
@@ -64,17 +64,48 @@ static int32_t elapsed(void)
 	return announce_remaining == 0 ? sys_clock_elapsed() : 0U;
 }
 
+#ifdef CONFIG_TIMEOUT_SLACK
+/* Ticks until the timer must fire to expire the head of the list, with
+ * expiries coalesced within the slack of each timeout: every timeout due
+ * before the deadline found so far is expired by the same announcement,
+ * and caps the deadline at its own expiry plus its slack.  The
+ * announcement then expires all the timeouts that are due, so none of
+ * them is late by more than its slack.
+ */
+static int64_t expiry_dticks(struct _timeout *to)
+{
+	int64_t dt = to->dticks;
+	int64_t deadline = dt + to->slack;
+
+	for (to = next(to); to != NULL; to = next(to)) {
+		dt += to->dticks;
+		if (dt > deadline) {
+			break;
+		}
+		deadline = MIN(deadline, dt + to->slack);
+	}
+
+	return deadline;
+}
+#else
+static inline int64_t expiry_dticks(struct _timeout *to)
+{
+	return to->dticks;
+}
+#endif
+
 static int32_t next_timeout(void)
 {
 	struct _timeout *to = first();
 	int32_t ticks_elapsed = elapsed();
+	int64_t dticks = (to == NULL) ? 0 : expiry_dticks(to);
 	int32_t ret;
 
 	if ((to == NULL) ||
-	    ((int64_t)(to->dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
+	    ((int64_t)(dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
 		ret = MAX_WAIT;
 	} else {
-		ret = MAX(0, to->dticks - ticks_elapsed);
+		ret = MAX(0, dticks - ticks_elapsed);
 	}
 
 #ifdef CONFIG_TIMESLICING
@@ -101,6 +132,9 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 
 	LOCKED(&timeout_lock) {
 		struct _timeout *t;
+#ifdef CONFIG_TIMEOUT_SLACK
+		int32_t prev_time = next_timeout();
+#endif
 
 		if (IS_ENABLED(CONFIG_TIMEOUT_64BIT) &&
 		    Z_TICK_ABS(timeout.ticks) >= 0) {
@@ -124,6 +158,15 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 			sys_dlist_append(&timeout_list, &to->node);
 		}
 
+#ifdef CONFIG_TIMEOUT_SLACK
+		/* A timeout behind the head can still pull in the
+		 * coalesced expiry if it is due within its window
+		 */
+		if ((to != first()) && (next_timeout() < prev_time)) {
+			sys_clock_set_timeout(next_timeout(), false);
+		}
+#endif
+
 		if (to == first()) {
 #if CONFIG_TIMESLICING
 			/*
@@ -161,6 +204,18 @@ int z_abort_timeout(struct _timeout *to)
 	return ret;
 }
 
+#ifdef CONFIG_TIMEOUT_SLACK
+void z_timeout_slack_set(struct _timeout *to, k_timeout_t slack)
+{
+	k_ticks_t ticks = K_TIMEOUT_EQ(slack, K_FOREVER) ? INT32_MAX
+			  : slack.ticks;
+
+	__ASSERT(ticks >= 0, "invalid timeout slack");
+
+	to->slack = CLAMP(ticks, 0, INT32_MAX);
+}
+#endif
+
 /* must be locked */
 static k_ticks_t timeout_rem(const struct _timeout *timeout)
 {
@@ -244,6 +299,12 @@ void sys_clock_announce(int32_t ticks)
 
 	k_spinlock_key_t key = k_spin_lock(&timeout_lock);
 
+#ifdef CONFIG_IDLE_STATS
+	if (_current == _current_cpu->idle_thread) {
+		_current_cpu->idle_stats.timer_wakeups++;
+	}
+#endif
+
 	/* We release the lock around the callbacks below, so on SMP
 	 * systems someone might be already running the loop.  Don't
 	 * race (which will cause paralllel execution of "sequential"
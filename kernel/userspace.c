@@ -162,10 +162,120 @@ static struct rbtree obj_rb_tree = {
  */
 static sys_dlist_t obj_list = SYS_DLIST_STATIC_INIT(&obj_list);
 
+#if CONFIG_DYNAMIC_OBJECTS_HASH_SIZE > 0
+BUILD_ASSERT((CONFIG_DYNAMIC_OBJECTS_HASH_SIZE &
+	      (CONFIG_DYNAMIC_OBJECTS_HASH_SIZE - 1)) == 0,
+	     "DYNAMIC_OBJECTS_HASH_SIZE must be a power of two");
+
+#define OBJ_HASH_MASK	(CONFIG_DYNAMIC_OBJECTS_HASH_SIZE - 1U)
+
 /*
- * TODO: Write some hash table code that will replace both obj_rb_tree
- * and obj_list.
+ * Open addressing hash table of allocated kernel objects, so that looking
+ * up an object does not walk obj_rb_tree under lists_lock. It is updated
+ * along with obj_rb_tree, which stays the authoritative set: lookups read
+ * the slots without the lock and only trust a hit. A miss falls back to the
+ * tree, which covers the objects that did not fit in the table and entries
+ * being moved by a concurrent removal.
  */
+static atomic_ptr_t obj_hash[CONFIG_DYNAMIC_OBJECTS_HASH_SIZE];
+static size_t obj_hash_cnt;
+
+static inline size_t obj_hash_slot(const struct dyn_obj *dyn)
+{
+	uint32_t h = (uint32_t)((uintptr_t)dyn / sizeof(void *));
+
+	h ^= h >> 16;
+	h *= 0x45d9f3bU;
+	h ^= h >> 16;
+
+	return h & OBJ_HASH_MASK;
+}
+
+static void obj_hash_add(struct dyn_obj *dyn)
+{
+	size_t i;
+
+	/* Keep a quarter of the slots empty so that probes stay short */
+	if (obj_hash_cnt >= (CONFIG_DYNAMIC_OBJECTS_HASH_SIZE * 3U / 4U)) {
+		return;
+	}
+
+	i = obj_hash_slot(dyn);
+	while (atomic_ptr_get(&obj_hash[i]) != NULL) {
+		i = (i + 1U) & OBJ_HASH_MASK;
+	}
+
+	(void)atomic_ptr_set(&obj_hash[i], dyn);
+	obj_hash_cnt++;
+}
+
+static bool obj_hash_contains(const struct dyn_obj *dyn)
+{
+	size_t i = obj_hash_slot(dyn);
+
+	for (size_t n = 0; n < CONFIG_DYNAMIC_OBJECTS_HASH_SIZE; n++) {
+		void *ent = atomic_ptr_get(&obj_hash[i]);
+
+		if (ent == dyn) {
+			return true;
+		} else if (ent == NULL) {
+			break;
+		}
+		i = (i + 1U) & OBJ_HASH_MASK;
+	}
+
+	return false;
+}
+
+static void obj_hash_remove(struct dyn_obj *dyn)
+{
+	struct dyn_obj *ent;
+	size_t i = obj_hash_slot(dyn);
+	size_t j;
+
+	while ((ent = atomic_ptr_get(&obj_hash[i])) != dyn) {
+		if (ent == NULL) {
+			/* Not in the table */
+			return;
+		}
+		i = (i + 1U) & OBJ_HASH_MASK;
+	}
+
+	/* Fill the hole with the following entries of the probe sequence
+	 * whose home slot is not between the hole and their position.
+	 */
+	for (j = (i + 1U) & OBJ_HASH_MASK;
+	     (ent = atomic_ptr_get(&obj_hash[j])) != NULL;
+	     j = (j + 1U) & OBJ_HASH_MASK) {
+		size_t home = obj_hash_slot(ent);
+
+		if (((j - home) & OBJ_HASH_MASK) >= ((j - i) & OBJ_HASH_MASK)) {
+			(void)atomic_ptr_set(&obj_hash[i], ent);
+			i = j;
+		}
+	}
+
+	(void)atomic_ptr_set(&obj_hash[i], NULL);
+	obj_hash_cnt--;
+}
+#else
+static inline void obj_hash_add(struct dyn_obj *dyn)
+{
+	ARG_UNUSED(dyn);
+}
+
+static inline bool obj_hash_contains(const struct dyn_obj *dyn)
+{
+	ARG_UNUSED(dyn);
+
+	return false;
+}
+
+static inline void obj_hash_remove(struct dyn_obj *dyn)
+{
+	ARG_UNUSED(dyn);
+}
+#endif /* CONFIG_DYNAMIC_OBJECTS_HASH_SIZE > 0 */
 
 static size_t obj_size_get(enum k_objects otype)
 {
@@ -230,6 +340,10 @@ static struct dyn_obj *dyn_object_find(void *obj)
 	 */
 	node = dyn_obj_to_node(obj);
 
+	if (obj_hash_contains(node_to_dyn_obj(node))) {
+		return node_to_dyn_obj(node);
+	}
+
 	k_spinlock_key_t key = k_spin_lock(&lists_lock);
 	if (rb_contains(&obj_rb_tree, node)) {
 		ret = node_to_dyn_obj(node);
@@ -323,6 +437,7 @@ struct z_object *z_dynamic_object_aligned_create(size_t align, size_t size)
 
 	rb_insert(&obj_rb_tree, &dyn->node);
 	sys_dlist_append(&obj_list, &dyn->dobj_list);
+	obj_hash_add(dyn);
 	k_spin_unlock(&lists_lock, key);
 
 	return &dyn->kobj;
@@ -398,8 +513,12 @@ void k_object_free(void *obj)
 
 	dyn = dyn_object_find(obj);
 	if (dyn != NULL) {
+		k_spinlock_key_t lists_key = k_spin_lock(&lists_lock);
+
 		rb_remove(&obj_rb_tree, &dyn->node);
 		sys_dlist_remove(&dyn->dobj_list);
+		obj_hash_remove(dyn);
+		k_spin_unlock(&lists_lock, lists_key);
 
 		if (dyn->kobj.type == K_OBJ_THREAD) {
 			thread_idx_free(dyn->kobj.data.thread_id);
@@ -462,8 +581,23 @@ static unsigned int thread_index_get(struct k_thread *thread)
 	return ko->data.thread_id;
 }
 
-static void unref_check(struct z_object *ko, uintptr_t index)
+/* Objects whose last reference is dropped are unlinked under lists_lock,
+ * as in k_object_free(). It is taken before obj_lock, which is the order
+ * of the z_object_wordlist_foreach() callbacks, which already hold it.
+ */
+static void unref_check(struct z_object *ko, uintptr_t index,
+			bool lists_locked)
 {
+#ifdef CONFIG_DYNAMIC_OBJECTS
+	struct dyn_obj *unlinked = NULL;
+	k_spinlock_key_t lists_key = { 0 };
+
+	if (!lists_locked) {
+		lists_key = k_spin_lock(&lists_lock);
+	}
+#else
+	ARG_UNUSED(lists_locked);
+#endif
 	k_spinlock_key_t key = k_spin_lock(&obj_lock);
 
 	sys_bitfield_clear_bit((mem_addr_t)&ko->perms, index);
@@ -508,10 +642,21 @@ static void unref_check(struct z_object *ko, uintptr_t index)
 
 	rb_remove(&obj_rb_tree, &dyn->node);
 	sys_dlist_remove(&dyn->dobj_list);
-	k_free(dyn);
+	obj_hash_remove(dyn);
+	unlinked = dyn;
 out:
 #endif
 	k_spin_unlock(&obj_lock, key);
+
+#ifdef CONFIG_DYNAMIC_OBJECTS
+	if (!lists_locked) {
+		k_spin_unlock(&lists_lock, lists_key);
+	}
+
+	if (unlinked != NULL) {
+		k_free(unlinked);
+	}
+#endif
 }
 
 static void wordlist_cb(struct z_object *ko, void *ctx_ptr)
@@ -552,7 +697,7 @@ void z_thread_perms_clear(struct z_object *ko, struct k_thread *thread)
 
 	if (index != -1) {
 		sys_bitfield_clear_bit((mem_addr_t)&ko->perms, index);
-		unref_check(ko, index);
+		unref_check(ko, index, false);
 	}
 }
 
@@ -560,7 +705,8 @@ static void clear_perms_cb(struct z_object *ko, void *ctx_ptr)
 {
 	uintptr_t id = (uintptr_t)ctx_ptr;
 
-	unref_check(ko, id);
+	/* Dynamic objects are passed with lists_lock held */
+	unref_check(ko, id, true);
 }
 
 void z_thread_perms_all_clear(struct k_thread *thread)
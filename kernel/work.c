@@ -857,6 +857,16 @@ int k_work_delayable_busy_get(const struct k_work_delayable *dwork)
 	return ret;
 }
 
+#ifdef CONFIG_TIMEOUT_SLACK
+void k_work_delayable_slack_set(struct k_work_delayable *dwork,
+				k_timeout_t slack)
+{
+	__ASSERT_NO_MSG(dwork != NULL);
+
+	z_timeout_slack_set(&dwork->timeout, slack);
+}
+#endif
+
 /* Attempt to schedule a work item for future (maybe immediate)
  * submission.
  *
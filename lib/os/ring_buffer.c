@@ -263,3 +263,168 @@ int ring_buf_item_get(struct ring_buf *buf, uint16_t *type, uint8_t *value,
 
 	return 0;
 }
+
+/*
+ * Single producer, single consumer ring buffer.
+ *
+ * The producer owns the put state and the consumer the get state. The tail
+ * of each side is published with a release store once the data (or space)
+ * is handed over and read by the other side with an acquire load, so the
+ * buffer contents are ordered without a lock. Each side also keeps the last
+ * tail it has seen from the other one and only reloads it when that does
+ * not allow the request to be served, which keeps the other side's cache
+ * line out of the fast path.
+ */
+static inline uint32_t spsc_load(const uint32_t *idx)
+{
+	return __atomic_load_n(idx, __ATOMIC_ACQUIRE);
+}
+
+static inline void spsc_store(uint32_t *idx, uint32_t val)
+{
+	__atomic_store_n(idx, val, __ATOMIC_RELEASE);
+}
+
+uint32_t ring_buf_spsc_put_claim(struct ring_buf_spsc *buf, uint8_t **data,
+				 uint32_t size)
+{
+	uint32_t free_space, wrap_size, base;
+
+	base = buf->put.base;
+	wrap_size = buf->put.head - base;
+	if (unlikely(wrap_size >= buf->size)) {
+		/* put.base is not yet adjusted */
+		wrap_size -= buf->size;
+		base += buf->size;
+	}
+	wrap_size = buf->size - wrap_size;
+	size = MIN(size, wrap_size);
+
+	free_space = buf->size - (buf->put.head - buf->put.get_tail);
+	if (free_space < size) {
+		buf->put.get_tail = spsc_load(&buf->get.tail);
+		free_space = buf->size - (buf->put.head - buf->put.get_tail);
+		size = MIN(size, free_space);
+	}
+
+	*data = &buf->buffer[buf->put.head - base];
+	buf->put.head += size;
+
+	return size;
+}
+
+int ring_buf_spsc_put_finish(struct ring_buf_spsc *buf, uint32_t size)
+{
+	uint32_t tail;
+
+	if (unlikely(size > (buf->put.head - buf->put.tail))) {
+		return -EINVAL;
+	}
+
+	tail = buf->put.tail + size;
+	buf->put.head = tail;
+
+	if (unlikely((tail - buf->put.base) >= buf->size)) {
+		/* we wrapped: adjust put.base */
+		buf->put.base += buf->size;
+	}
+
+	spsc_store(&buf->put.tail, tail);
+
+	return 0;
+}
+
+uint32_t ring_buf_spsc_put(struct ring_buf_spsc *buf, const uint8_t *data,
+			   uint32_t size)
+{
+	uint8_t *dst;
+	uint32_t partial_size;
+	uint32_t total_size = 0U;
+	int err;
+
+	do {
+		partial_size = ring_buf_spsc_put_claim(buf, &dst, size);
+		memcpy(dst, data, partial_size);
+		total_size += partial_size;
+		size -= partial_size;
+		data += partial_size;
+	} while (size && partial_size);
+
+	err = ring_buf_spsc_put_finish(buf, total_size);
+	__ASSERT_NO_MSG(err == 0);
+
+	return total_size;
+}
+
+uint32_t ring_buf_spsc_get_claim(struct ring_buf_spsc *buf, uint8_t **data,
+				 uint32_t size)
+{
+	uint32_t available_size, wrap_size, base;
+
+	base = buf->get.base;
+	wrap_size = buf->get.head - base;
+	if (unlikely(wrap_size >= buf->size)) {
+		/* get.base is not yet adjusted */
+		wrap_size -= buf->size;
+		base += buf->size;
+	}
+	wrap_size = buf->size - wrap_size;
+	size = MIN(size, wrap_size);
+
+	available_size = buf->get.put_tail - buf->get.head;
+	if (available_size < size) {
+		buf->get.put_tail = spsc_load(&buf->put.tail);
+		available_size = buf->get.put_tail - buf->get.head;
+		size = MIN(size, available_size);
+	}
+
+	*data = &buf->buffer[buf->get.head - base];
+	buf->get.head += size;
+
+	return size;
+}
+
+int ring_buf_spsc_get_finish(struct ring_buf_spsc *buf, uint32_t size)
+{
+	uint32_t tail;
+
+	if (unlikely(size > (buf->get.head - buf->get.tail))) {
+		return -EINVAL;
+	}
+
+	tail = buf->get.tail + size;
+	buf->get.head = tail;
+
+	if (unlikely((tail - buf->get.base) >= buf->size)) {
+		/* we wrapped: adjust get.base */
+		buf->get.base += buf->size;
+	}
+
+	spsc_store(&buf->get.tail, tail);
+
+	return 0;
+}
+
+uint32_t ring_buf_spsc_get(struct ring_buf_spsc *buf, uint8_t *data,
+			   uint32_t size)
+{
+	uint8_t *src;
+	uint32_t partial_size;
+	uint32_t total_size = 0U;
+	int err;
+
+	do {
+		partial_size = ring_buf_spsc_get_claim(buf, &src, size);
+		if (data) {
+			memcpy(data, src, partial_size);
+			data += partial_size;
+		}
+		total_size += partial_size;
+		size -= partial_size;
+	} while (size && partial_size);
+
+	err = ring_buf_spsc_get_finish(buf, total_size);
+	__ASSERT_NO_MSG(err == 0);
+
+	return total_size;
+}
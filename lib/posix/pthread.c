@@ -37,6 +37,14 @@ static const pthread_attr_t init_pthread_attrs = {
 static struct posix_thread posix_thread_pool[CONFIG_MAX_PTHREAD_COUNT];
 PTHREAD_MUTEX_DEFINE(pthread_pool_lock);
 
+#ifdef CONFIG_PTHREAD_POOL
+static K_THREAD_STACK_ARRAY_DEFINE(posix_thread_stacks,
+				   CONFIG_MAX_PTHREAD_COUNT,
+				   CONFIG_PTHREAD_POOL_STACK_SIZE);
+Z_THREAD_POOL_DEFINE(posix_kernel_pool, posix_thread_pool,
+		     posix_thread_stacks);
+#endif
+
 static bool is_posix_prio_valid(uint32_t priority, int policy)
 {
 	if (priority >= sched_get_priority_min(policy) &&
@@ -120,11 +128,47 @@ static void zephyr_thread_wrapper(void *arg1, void *arg2, void *arg3)
 	pthread_exit(NULL);
 }
 
+static struct posix_thread *posix_thread_alloc(void)
+{
+#ifdef CONFIG_PTHREAD_POOL
+	return (struct posix_thread *)k_thread_pool_alloc(&posix_kernel_pool);
+#else
+	struct posix_thread *thread = NULL;
+	uint32_t pthread_num;
+
+	pthread_mutex_lock(&pthread_pool_lock);
+	for (pthread_num = 0;
+	    pthread_num < CONFIG_MAX_PTHREAD_COUNT; pthread_num++) {
+		if (posix_thread_pool[pthread_num].state == PTHREAD_TERMINATED) {
+			thread = &posix_thread_pool[pthread_num];
+			thread->state = PTHREAD_JOINABLE;
+			break;
+		}
+	}
+	pthread_mutex_unlock(&pthread_pool_lock);
+
+	return thread;
+#endif
+}
+
+/* Give back a thread that has been moved to the PTHREAD_TERMINATED state.
+ * The pool reuses it once the underlying thread has exited, so this must
+ * be called after the last access to it.
+ */
+static void posix_thread_free(struct posix_thread *thread)
+{
+#ifdef CONFIG_PTHREAD_POOL
+	k_thread_pool_free(&posix_kernel_pool, &thread->thread);
+#else
+	ARG_UNUSED(thread);
+#endif
+}
+
 /**
  * @brief Create a new thread.
  *
- * Pthread attribute should not be NULL. API will return Error on NULL
- * attribute value.
+ * Pthread attribute should not be NULL, unless CONFIG_PTHREAD_POOL is
+ * enabled. API will return Error on NULL attribute value.
  *
  * See IEEE 1003.1
  */
@@ -132,10 +176,22 @@ int pthread_create(pthread_t *newthread, const pthread_attr_t *attr,
 		   void *(*threadroutine)(void *), void *arg)
 {
 	int32_t prio;
-	uint32_t pthread_num;
 	pthread_condattr_t cond_attr;
 	struct posix_thread *thread;
+	k_thread_stack_t *stack;
+	size_t stacksize;
+
+#ifdef CONFIG_PTHREAD_POOL
+	/* Threads without a stack use the one from the pool */
+	if (attr == NULL) {
+		attr = &init_pthread_attrs;
+	}
 
+	if ((attr->initialized == 0U) ||
+	    ((attr->stack != NULL) && (attr->stacksize == 0))) {
+		return EINVAL;
+	}
+#else
 	/*
 	 * FIXME: Pthread attribute must be non-null and it provides stack
 	 * pointer and stack size. So even though POSIX 1003.1 spec accepts
@@ -145,25 +201,24 @@ int pthread_create(pthread_t *newthread, const pthread_attr_t *attr,
 	    || (attr->stack == NULL) || (attr->stacksize == 0)) {
 		return EINVAL;
 	}
+#endif
 
-	pthread_mutex_lock(&pthread_pool_lock);
-	for (pthread_num = 0;
-	    pthread_num < CONFIG_MAX_PTHREAD_COUNT; pthread_num++) {
-		thread = &posix_thread_pool[pthread_num];
-		if (thread->state == PTHREAD_TERMINATED) {
-			thread->state = PTHREAD_JOINABLE;
-			break;
-		}
-	}
-	pthread_mutex_unlock(&pthread_pool_lock);
-
-	if (pthread_num >= CONFIG_MAX_PTHREAD_COUNT) {
+	thread = posix_thread_alloc();
+	if (thread == NULL) {
 		return EAGAIN;
 	}
 
 	prio = posix_to_zephyr_priority(attr->priority, attr->schedpolicy);
 
-	thread = &posix_thread_pool[pthread_num];
+	stack = attr->stack;
+	stacksize = attr->stacksize;
+#ifdef CONFIG_PTHREAD_POOL
+	if (stack == NULL) {
+		stack = k_thread_pool_stack_get(&posix_kernel_pool,
+						&thread->thread, &stacksize);
+	}
+#endif
+
 	/*
 	 * Ignore return value, as we know that Zephyr implementation
 	 * cannot fail.
@@ -183,8 +238,8 @@ int pthread_create(pthread_t *newthread, const pthread_attr_t *attr,
 	pthread_cond_init(&thread->state_cond, &cond_attr);
 	sys_slist_init(&thread->key_list);
 
-	*newthread = (pthread_t) k_thread_create(&thread->thread, attr->stack,
-						 attr->stacksize,
+	*newthread = (pthread_t) k_thread_create(&thread->thread, stack,
+						 stacksize,
 						 (k_thread_entry_t)
 						 zephyr_thread_wrapper,
 						 (void *)arg, NULL,
@@ -242,9 +297,12 @@ int pthread_cancel(pthread_t pthread)
 	pthread_mutex_unlock(&thread->cancel_lock);
 
 	if (cancel_state == PTHREAD_CANCEL_ENABLE) {
+		bool terminated = false;
+
 		pthread_mutex_lock(&thread->state_lock);
 		if (thread->state == PTHREAD_DETACHED) {
 			thread->state = PTHREAD_TERMINATED;
+			terminated = true;
 		} else {
 			thread->retval = PTHREAD_CANCELED;
 			thread->state = PTHREAD_EXITED;
@@ -252,6 +310,9 @@ int pthread_cancel(pthread_t pthread)
 		}
 		pthread_mutex_unlock(&thread->state_lock);
 
+		if (terminated) {
+			posix_thread_free(thread);
+		}
 		k_thread_abort((k_tid_t) thread);
 	}
 
@@ -358,6 +419,7 @@ void pthread_exit(void *retval)
 	pthread_key_obj *key_obj;
 	pthread_thread_data *thread_spec_data;
 	sys_snode_t *node_l;
+	bool terminated = false;
 
 	/* Make a thread as cancelable before exiting */
 	pthread_mutex_lock(&self->cancel_lock);
@@ -375,6 +437,7 @@ void pthread_exit(void *retval)
 		pthread_cond_broadcast(&self->state_cond);
 	} else {
 		self->state = PTHREAD_TERMINATED;
+		terminated = true;
 	}
 
 	SYS_SLIST_FOR_EACH_NODE(&self->key_list, node_l) {
@@ -388,6 +451,10 @@ void pthread_exit(void *retval)
 	}
 
 	pthread_mutex_unlock(&self->state_lock);
+
+	if (terminated) {
+		posix_thread_free(self);
+	}
 	k_thread_abort((k_tid_t)self);
 }
 
@@ -399,6 +466,7 @@ void pthread_exit(void *retval)
 int pthread_join(pthread_t thread, void **status)
 {
 	struct posix_thread *pthread = (struct posix_thread *) thread;
+	bool terminated = false;
 	int ret = 0;
 
 	if (pthread == NULL) {
@@ -419,6 +487,11 @@ int pthread_join(pthread_t thread, void **status)
 		if (status != NULL) {
 			*status = pthread->retval;
 		}
+#ifdef CONFIG_PTHREAD_POOL
+		/* The pool only reuses the thread once it has exited */
+		pthread->state = PTHREAD_TERMINATED;
+		terminated = true;
+#endif
 	} else if (pthread->state == PTHREAD_DETACHED) {
 		ret = EINVAL;
 	} else {
@@ -426,6 +499,11 @@ int pthread_join(pthread_t thread, void **status)
 	}
 
 	pthread_mutex_unlock(&pthread->state_lock);
+
+	if (terminated) {
+		posix_thread_free(pthread);
+	}
+
 	return ret;
 }
 
@@ -437,6 +515,7 @@ int pthread_join(pthread_t thread, void **status)
 int pthread_detach(pthread_t thread)
 {
 	struct posix_thread *pthread = (struct posix_thread *) thread;
+	bool terminated = false;
 	int ret = 0;
 
 	if (pthread == NULL) {
@@ -455,6 +534,7 @@ int pthread_detach(pthread_t thread)
 		break;
 	case PTHREAD_EXITED:
 		pthread->state = PTHREAD_TERMINATED;
+		terminated = true;
 		/* THREAD has already exited.
 		 * Pthread remained to provide exit status.
 		 */
@@ -468,6 +548,11 @@ int pthread_detach(pthread_t thread)
 	}
 
 	pthread_mutex_unlock(&pthread->state_lock);
+
+	if (terminated) {
+		posix_thread_free(pthread);
+	}
+
 	return ret;
 }
 
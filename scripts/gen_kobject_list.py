@@ -107,7 +107,8 @@ kobjects = OrderedDict([
     ("sys_mutex", (None, True, False)),
     ("k_futex", (None, True, False)),
     ("k_condvar", (None, False, True)),
-    ("k_event", ("CONFIG_EVENTS", False, True))
+    ("k_event", ("CONFIG_EVENTS", False, True)),
+    ("k_rwlock", ("CONFIG_RWLOCK", False, True))
 ])
 
 def kobject_to_enum(kobj):
@@ -50,6 +50,27 @@ noweak = ["z_mrsh_k_object_release",
           "z_mrsh_k_object_access_grant",
           "z_mrsh_k_object_alloc"]
 
+# System calls that may be queued on a k_syscall_ring. They are executed one
+# after the other within k_syscall_ring_submit(), so they must return to
+# their caller and must not return 64-bit values, which are passed back
+# through an extra pointer argument.
+batchable = ["k_sem_give", "k_sem_take", "k_sem_reset", "k_sem_count_get",
+             "k_mutex_lock", "k_mutex_unlock",
+             "k_condvar_signal", "k_condvar_broadcast", "k_condvar_wait",
+             "k_msgq_put", "k_msgq_get", "k_msgq_peek", "k_msgq_purge",
+             "k_msgq_num_free_get", "k_msgq_num_used_get",
+             "k_queue_alloc_append", "k_queue_alloc_prepend",
+             "k_queue_get", "k_queue_is_empty",
+             "k_stack_push", "k_stack_pop",
+             "k_pipe_put", "k_pipe_get",
+             "k_event_post", "k_event_set",
+             "k_event_wait", "k_event_wait_all",
+             "k_poll_signal_raise", "k_poll_signal_reset",
+             "k_futex_wait", "k_futex_wake",
+             "k_yield", "k_wakeup",
+             "z_sys_mutex_kernel_lock", "z_sys_mutex_kernel_unlock",
+             "zsock_sendto", "zsock_recvfrom", "zsock_sendmsg"]
+
 table_template = """/* auto-generated by gen_syscalls.py, don't edit */
 
 /* Weak handler functions that get replaced by the real ones unless a system
@@ -60,6 +81,13 @@ table_template = """/* auto-generated by gen_syscalls.py, don't edit */
 const _k_syscall_handler_t _k_syscall_table[K_SYSCALL_LIMIT] = {
 \t%s
 };
+
+#ifdef CONFIG_SYSCALL_BATCH
+/* System calls that may be executed by k_syscall_ring_submit() */
+const bool _k_syscall_batchable[K_SYSCALL_LIMIT] = {
+\t%s
+};
+#endif
 """
 
 list_template = """/* auto-generated by gen_syscalls.py, don't edit */
@@ -419,6 +447,7 @@ def main():
     mrsh_includes = {}
     ids = []
     table_entries = []
+    batch_entries = []
     handlers = []
 
     for match_group, fn in syscalls:
@@ -432,6 +461,9 @@ def main():
         table_entries.append(entry)
         handlers.append(handler)
 
+        if typename_split(match_group[0])[1] in batchable:
+            batch_entries.append("[%s] = true" % sys_id)
+
         if mrsh:
             syscall = typename_split(match_group[0])[1]
             mrsh_defs[syscall] = mrsh
@@ -449,7 +481,8 @@ def main():
                                    % s for s in noweak])
 
         fp.write(table_template % (weak_defines,
-                                   ",\n\t".join(table_entries)))
+                                   ",\n\t".join(table_entries),
+                                   ",\n\t".join(batch_entries)))
 
     # Listing header emitted to stdout
     ids.sort()
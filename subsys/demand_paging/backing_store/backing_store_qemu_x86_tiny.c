@@ -66,6 +66,27 @@ void k_mem_paging_backing_store_page_in(uintptr_t location)
 		     CONFIG_MMU_PAGE_SIZE);
 }
 
+void k_mem_paging_backing_store_page_in_multi(const uintptr_t *locations,
+					       size_t count)
+{
+	size_t i = 0;
+
+	/* Data pages at consecutive locations are a single flash read */
+	while (i < count) {
+		size_t n = 1;
+
+		while (((i + n) < count) &&
+		       (locations[i + n] ==
+			locations[i] + (n * CONFIG_MMU_PAGE_SIZE))) {
+			n++;
+		}
+
+		(void)memcpy(Z_SCRATCH_PAGE_N(i), location_to_flash(locations[i]),
+			     n * CONFIG_MMU_PAGE_SIZE);
+		i += n;
+	}
+}
+
 void k_mem_paging_backing_store_page_finalize(struct z_page_frame *pf,
 					      uintptr_t location)
 {
@@ -121,6 +121,15 @@ void k_mem_paging_backing_store_page_in(uintptr_t location)
 		     CONFIG_MMU_PAGE_SIZE);
 }
 
+void k_mem_paging_backing_store_page_in_multi(const uintptr_t *locations,
+					       size_t count)
+{
+	for (size_t i = 0; i < count; i++) {
+		(void)memcpy(Z_SCRATCH_PAGE_N(i), location_to_slab(locations[i]),
+			     CONFIG_MMU_PAGE_SIZE);
+	}
+}
+
 void k_mem_paging_backing_store_page_finalize(struct z_page_frame *pf,
 					      uintptr_t location)
 {
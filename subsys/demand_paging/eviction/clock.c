@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Clock (second chance) eviction algorithm for demand paging
+ */
+#include <zephyr/kernel.h>
+#include <mmu.h>
+#include <kernel_arch_interface.h>
+
+/* The page frames are arranged in a circle with a hand pointing at the
+ * next eviction candidate. When a page frame needs to be evicted, the hand
+ * sweeps forward: a page that was accessed since the hand last passed over
+ * it gets its accessed state cleared and is given a second chance, the first
+ * page found not accessed is evicted.
+ *
+ * Unlike NRU, no periodic timer is needed, the accessed state is only
+ * sampled when an eviction actually takes place. The hand also remembers
+ * its position across evictions, so the scan cost is spread out instead of
+ * always starting from the first page frame.
+ */
+static size_t hand;
+
+struct z_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	struct z_page_frame *pf;
+	uintptr_t flags;
+
+	/* After one revolution all accessed states have been cleared, so a
+	 * victim is found within two unless every page frame is pinned.
+	 */
+	for (size_t n = 0; n < (2 * Z_NUM_PAGE_FRAMES); n++) {
+		pf = &z_page_frames[hand];
+		hand = (hand + 1) % Z_NUM_PAGE_FRAMES;
+
+		if (!z_page_frame_is_evictable(pf)) {
+			continue;
+		}
+
+		/* Fetch the state and clear the accessed bit in one go */
+		flags = arch_page_info_get(pf->addr, NULL, true);
+
+		/* Implies a mismatch with page frame ontology and page
+		 * tables
+		 */
+		__ASSERT((flags & ARCH_DATA_PAGE_LOADED) != 0U,
+			 "non-present page, %s",
+			 ((flags & ARCH_DATA_PAGE_NOT_MAPPED) != 0U) ?
+			 "un-mapped" : "paged out");
+
+		if ((flags & ARCH_DATA_PAGE_ACCESSED) == 0UL) {
+			*dirty_ptr = (flags & ARCH_DATA_PAGE_DIRTY) != 0UL;
+			return pf;
+		}
+	}
+
+	/* Shouldn't ever happen unless every page is pinned */
+	__ASSERT(false, "no page to evict");
+
+	return NULL;
+}
+
+void k_mem_paging_eviction_init(void)
+{
+	hand = 0;
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Approximate Least Recently Used (LRU) eviction algorithm for demand paging
+ */
+#include <zephyr/kernel.h>
+#include <mmu.h>
+#include <kernel_arch_interface.h>
+
+/* Each page frame has an 8-bit age, which approximates the time since its
+ * data page was last used with the aging algorithm: whenever a page frame
+ * needs to be evicted, the age of every evictable page frame is shifted
+ * right and its accessed state shifted in as the most significant bit, then
+ * the accessed state is cleared. The page frame with the lowest age, i.e.
+ * the one that went the most evictions without being accessed, is evicted,
+ * preferring clean pages among those of the same age.
+ *
+ * Sampling the accessed state at eviction time rather than from a periodic
+ * timer means no work is done while the working set fits in memory, and the
+ * history is measured in evictions, which is the time scale that matters
+ * for picking a victim.
+ */
+static uint8_t ages[Z_NUM_PAGE_FRAMES];
+
+struct z_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	unsigned int last_prec = UINT_MAX;
+	struct z_page_frame *last_pf = NULL, *pf;
+	bool last_dirty = false;
+	bool dirty;
+	uintptr_t flags, phys;
+	size_t idx;
+
+	Z_PAGE_FRAME_FOREACH(phys, pf) {
+		unsigned int prec;
+
+		if (!z_page_frame_is_evictable(pf)) {
+			continue;
+		}
+
+		/* Fetch the state and clear the accessed bit in one go */
+		flags = arch_page_info_get(pf->addr, NULL, true);
+		dirty = (flags & ARCH_DATA_PAGE_DIRTY) != 0UL;
+
+		/* Implies a mismatch with page frame ontology and page
+		 * tables
+		 */
+		__ASSERT((flags & ARCH_DATA_PAGE_LOADED) != 0U,
+			 "non-present page, %s",
+			 ((flags & ARCH_DATA_PAGE_NOT_MAPPED) != 0U) ?
+			 "un-mapped" : "paged out");
+
+		idx = pf - z_page_frames;
+		ages[idx] >>= 1;
+		if ((flags & ARCH_DATA_PAGE_ACCESSED) != 0UL) {
+			ages[idx] |= BIT(7);
+		}
+
+		/* All page frames must be aged, so no early exit */
+		prec = (ages[idx] << 1) + (dirty ? 1U : 0U);
+		if (prec < last_prec) {
+			last_prec = prec;
+			last_pf = pf;
+			last_dirty = dirty;
+		}
+	}
+	/* Shouldn't ever happen unless every page is pinned */
+	__ASSERT(last_pf != NULL, "no page to evict");
+
+	if (last_pf != NULL) {
+		/* The incoming data page is about to be accessed */
+		ages[last_pf - z_page_frames] = UINT8_MAX;
+	}
+
+	*dirty_ptr = last_dirty;
+
+	return last_pf;
+}
+
+void k_mem_paging_eviction_init(void)
+{
+}
@@ -0,0 +1,470 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Sector cache shared by all disks of the disk access layer.
+ *
+ * Cache slots are kept on a single LRU list, most recently used first,
+ * and are found through a small hash table keyed by disk and sector.
+ * Requests of up to CONFIG_DISK_CACHE_FILL_MAX sectors go through the
+ * cache; runs of missing sectors are read from the driver with a single
+ * request. Larger requests go to the driver directly and only keep the
+ * cached copies coherent.
+ *
+ * With CONFIG_DISK_CACHE_WRITE_BACK, writes only dirty the cache slots.
+ * Dirty sectors of a disk are written back, merged into contiguous runs,
+ * when a dirty slot has to be evicted or on DISK_IOCTL_CTRL_SYNC.
+ */
+
+#include <string.h>
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/slist.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/drivers/disk.h>
+
+#include "disk_cache.h"
+
+#define LOG_LEVEL CONFIG_DISK_LOG_LEVEL
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(disk);
+
+#define CACHE_SLOTS	CONFIG_DISK_CACHE_SECTORS
+#define CACHE_BUCKETS	CONFIG_DISK_CACHE_SECTORS
+
+struct disk_cache_entry {
+	/* LRU list node, the list head is the most recently used slot */
+	sys_dnode_t lru_node;
+	/* Hash bucket list node */
+	sys_snode_t hash_node;
+	/* Owning disk, NULL if the slot is free */
+	struct disk_info *disk;
+	uint32_t sector;
+	bool dirty;
+	uint8_t *data;
+};
+
+static struct disk_cache_entry cache_entries[CACHE_SLOTS];
+static uint8_t cache_data[CACHE_SLOTS][CONFIG_DISK_CACHE_SECTOR_SIZE] __aligned(4);
+static sys_slist_t cache_buckets[CACHE_BUCKETS];
+static sys_dlist_t lru_list;
+
+#ifdef CONFIG_DISK_CACHE_WRITE_BACK
+static uint8_t merge_buf[CONFIG_DISK_CACHE_MERGE_SECTORS *
+			 CONFIG_DISK_CACHE_SECTOR_SIZE] __aligned(4);
+#endif
+
+/* Protects all cache state, held across driver calls */
+static K_MUTEX_DEFINE(cache_lock);
+
+static inline sys_slist_t *cache_bucket(struct disk_info *disk, uint32_t sector)
+{
+	uint32_t hash = sector ^ (uint32_t)((uintptr_t)disk >> 2);
+
+	return &cache_buckets[hash % CACHE_BUCKETS];
+}
+
+static struct disk_cache_entry *cache_lookup(struct disk_info *disk,
+					     uint32_t sector)
+{
+	struct disk_cache_entry *entry;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(cache_bucket(disk, sector), entry,
+				     hash_node) {
+		if ((entry->disk == disk) && (entry->sector == sector)) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+static inline void cache_touch(struct disk_cache_entry *entry)
+{
+	sys_dlist_remove(&entry->lru_node);
+	sys_dlist_prepend(&lru_list, &entry->lru_node);
+}
+
+static void cache_drop(struct disk_cache_entry *entry)
+{
+	sys_slist_find_and_remove(cache_bucket(entry->disk, entry->sector),
+				  &entry->hash_node);
+	entry->disk = NULL;
+	entry->dirty = false;
+
+	/* Free slots are reused first */
+	sys_dlist_remove(&entry->lru_node);
+	sys_dlist_append(&lru_list, &entry->lru_node);
+}
+
+static void cache_invalidate(struct disk_info *disk)
+{
+	for (int i = 0; i < CACHE_SLOTS; i++) {
+		if (cache_entries[i].disk == disk) {
+			cache_drop(&cache_entries[i]);
+		}
+	}
+}
+
+static bool cache_range_valid(struct disk_info *disk, uint32_t start_sector,
+			      uint32_t num_sector)
+{
+	uint32_t last_sector = start_sector + num_sector;
+
+	return (last_sector >= start_sector) &&
+	       (last_sector <= disk->cache_sector_count);
+}
+
+#ifdef CONFIG_DISK_CACHE_WRITE_BACK
+static struct disk_cache_entry *cache_first_dirty(struct disk_info *disk)
+{
+	struct disk_cache_entry *first = NULL;
+
+	for (int i = 0; i < CACHE_SLOTS; i++) {
+		struct disk_cache_entry *entry = &cache_entries[i];
+
+		if ((entry->disk == disk) && entry->dirty &&
+		    ((first == NULL) || (entry->sector < first->sector))) {
+			first = entry;
+		}
+	}
+
+	return first;
+}
+
+static int cache_flush(struct disk_info *disk)
+{
+	struct disk_cache_entry *run[CONFIG_DISK_CACHE_MERGE_SECTORS];
+	struct disk_cache_entry *first;
+	uint32_t sector_size = disk->cache_sector_size;
+	uint32_t count;
+	int rc;
+
+	/* Write back in ascending sector order, one request per run */
+	while ((first = cache_first_dirty(disk)) != NULL) {
+		run[0] = first;
+		for (count = 1; count < ARRAY_SIZE(run); count++) {
+			struct disk_cache_entry *next =
+				cache_lookup(disk, first->sector + count);
+
+			if ((next == NULL) || !next->dirty) {
+				break;
+			}
+			run[count] = next;
+		}
+
+		if (count == 1) {
+			rc = disk->ops->write(disk, first->data,
+					      first->sector, 1);
+		} else {
+			for (uint32_t i = 0; i < count; i++) {
+				memcpy(&merge_buf[i * sector_size],
+				       run[i]->data, sector_size);
+			}
+			rc = disk->ops->write(disk, merge_buf,
+					      first->sector, count);
+		}
+
+		if (rc != 0) {
+			LOG_ERR("disk %s: write back of %u sectors at %u "
+				"failed (%d)", disk->name, count,
+				first->sector, rc);
+			return rc;
+		}
+
+		for (uint32_t i = 0; i < count; i++) {
+			run[i]->dirty = false;
+		}
+	}
+
+	return 0;
+}
+#else
+static inline int cache_flush(struct disk_info *disk)
+{
+	ARG_UNUSED(disk);
+
+	return 0;
+}
+#endif /* CONFIG_DISK_CACHE_WRITE_BACK */
+
+static struct disk_cache_entry *cache_alloc(struct disk_info *disk,
+					    uint32_t sector, int *rc)
+{
+	struct disk_cache_entry *entry;
+
+	entry = CONTAINER_OF(sys_dlist_peek_tail(&lru_list),
+			     struct disk_cache_entry, lru_node);
+
+	if (entry->disk != NULL) {
+		if (entry->dirty) {
+			/* Write back the whole dirty set of the owning
+			 * disk, so neighbours get merged into the same
+			 * requests instead of trickling out one by one.
+			 */
+			*rc = cache_flush(entry->disk);
+			if (*rc != 0) {
+				return NULL;
+			}
+		}
+		cache_drop(entry);
+	}
+
+	entry->disk = disk;
+	entry->sector = sector;
+	entry->dirty = false;
+	sys_slist_prepend(cache_bucket(disk, sector), &entry->hash_node);
+	cache_touch(entry);
+
+	return entry;
+}
+
+static int cache_read_direct(struct disk_info *disk, uint8_t *data_buf,
+			     uint32_t start_sector, uint32_t num_sector)
+{
+	uint32_t sector_size = disk->cache_sector_size;
+	int rc;
+
+	rc = disk->ops->read(disk, data_buf, start_sector, num_sector);
+	if (rc != 0) {
+		return rc;
+	}
+
+	/* Sectors not yet written back are newer than the disk content */
+	for (int i = 0; i < CACHE_SLOTS; i++) {
+		struct disk_cache_entry *entry = &cache_entries[i];
+
+		if ((entry->disk == disk) && entry->dirty &&
+		    (entry->sector - start_sector < num_sector)) {
+			memcpy(&data_buf[(entry->sector - start_sector) *
+					 sector_size],
+			       entry->data, sector_size);
+		}
+	}
+
+	return 0;
+}
+
+static int cache_write_direct(struct disk_info *disk, const uint8_t *data_buf,
+			      uint32_t start_sector, uint32_t num_sector)
+{
+	uint32_t sector_size = disk->cache_sector_size;
+	int rc;
+
+	rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
+	if (rc != 0) {
+		return rc;
+	}
+
+	for (int i = 0; i < CACHE_SLOTS; i++) {
+		struct disk_cache_entry *entry = &cache_entries[i];
+
+		if ((entry->disk == disk) &&
+		    (entry->sector - start_sector < num_sector)) {
+			memcpy(entry->data,
+			       &data_buf[(entry->sector - start_sector) *
+					 sector_size],
+			       sector_size);
+			entry->dirty = false;
+		}
+	}
+
+	return 0;
+}
+
+int disk_cache_read(struct disk_info *disk, uint8_t *data_buf,
+		    uint32_t start_sector, uint32_t num_sector)
+{
+	uint32_t sector_size = disk->cache_sector_size;
+	struct disk_cache_entry *entry;
+	uint32_t i = 0;
+	int rc = 0;
+
+	if (sector_size == 0U) {
+		return disk->ops->read(disk, data_buf, start_sector,
+				       num_sector);
+	}
+
+	if (!cache_range_valid(disk, start_sector, num_sector)) {
+		return -EIO;
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	if (num_sector > CONFIG_DISK_CACHE_FILL_MAX) {
+		rc = cache_read_direct(disk, data_buf, start_sector,
+				       num_sector);
+		goto out;
+	}
+
+	while (i < num_sector) {
+		uint32_t run;
+
+		entry = cache_lookup(disk, start_sector + i);
+		if (entry != NULL) {
+			memcpy(&data_buf[i * sector_size], entry->data,
+			       sector_size);
+			cache_touch(entry);
+			i++;
+			continue;
+		}
+
+		/* Fetch the whole run of missing sectors at once */
+		for (run = 1; i + run < num_sector; run++) {
+			if (cache_lookup(disk, start_sector + i + run) != NULL) {
+				break;
+			}
+		}
+
+		rc = disk->ops->read(disk, &data_buf[i * sector_size],
+				     start_sector + i, run);
+		if (rc != 0) {
+			goto out;
+		}
+
+		for (; run > 0; run--, i++) {
+			entry = cache_alloc(disk, start_sector + i, &rc);
+			if (entry == NULL) {
+				goto out;
+			}
+			memcpy(entry->data, &data_buf[i * sector_size],
+			       sector_size);
+		}
+	}
+
+out:
+	k_mutex_unlock(&cache_lock);
+
+	return rc;
+}
+
+int disk_cache_write(struct disk_info *disk, const uint8_t *data_buf,
+		     uint32_t start_sector, uint32_t num_sector)
+{
+	uint32_t sector_size = disk->cache_sector_size;
+	int rc = 0;
+
+	if (sector_size == 0U) {
+		return disk->ops->write(disk, data_buf, start_sector,
+					num_sector);
+	}
+
+	if (!cache_range_valid(disk, start_sector, num_sector)) {
+		return -EIO;
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	if (!IS_ENABLED(CONFIG_DISK_CACHE_WRITE_BACK) ||
+	    (num_sector > CONFIG_DISK_CACHE_FILL_MAX)) {
+		rc = cache_write_direct(disk, data_buf, start_sector,
+					num_sector);
+		goto out;
+	}
+
+	for (uint32_t i = 0; i < num_sector; i++) {
+		struct disk_cache_entry *entry;
+
+		entry = cache_lookup(disk, start_sector + i);
+		if (entry == NULL) {
+			entry = cache_alloc(disk, start_sector + i, &rc);
+			if (entry == NULL) {
+				goto out;
+			}
+		} else {
+			cache_touch(entry);
+		}
+
+		memcpy(entry->data, &data_buf[i * sector_size], sector_size);
+		entry->dirty = true;
+	}
+
+out:
+	k_mutex_unlock(&cache_lock);
+
+	return rc;
+}
+
+int disk_cache_sync(struct disk_info *disk)
+{
+	int rc = 0;
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+	if (disk->cache_sector_size != 0U) {
+		rc = cache_flush(disk);
+	}
+	k_mutex_unlock(&cache_lock);
+
+	return rc;
+}
+
+void disk_cache_attach(struct disk_info *disk)
+{
+	uint32_t sector_size = 0U;
+	uint32_t sector_count = 0U;
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	/* Re-initialization may follow a media change, start afresh */
+	if (disk->cache_sector_size != 0U) {
+		(void)cache_flush(disk);
+		cache_invalidate(disk);
+		disk->cache_sector_size = 0U;
+	}
+
+	if ((disk->ops->ioctl == NULL) ||
+	    (disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_SIZE,
+			      &sector_size) != 0) ||
+	    (disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_COUNT,
+			      &sector_count) != 0)) {
+		LOG_DBG("disk %s: geometry unknown, not cached", disk->name);
+	} else if ((sector_size == 0U) ||
+		   (sector_size > CONFIG_DISK_CACHE_SECTOR_SIZE)) {
+		LOG_DBG("disk %s: sector size %u not cacheable", disk->name,
+			sector_size);
+	} else {
+		disk->cache_sector_count = sector_count;
+		disk->cache_sector_size = sector_size;
+	}
+
+	k_mutex_unlock(&cache_lock);
+}
+
+int disk_cache_detach(struct disk_info *disk)
+{
+	int rc = 0;
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+	if (disk->cache_sector_size != 0U) {
+		rc = cache_flush(disk);
+		cache_invalidate(disk);
+		disk->cache_sector_size = 0U;
+	}
+	k_mutex_unlock(&cache_lock);
+
+	return rc;
+}
+
+static int disk_cache_init(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	sys_dlist_init(&lru_list);
+	for (int i = 0; i < CACHE_SLOTS; i++) {
+		cache_entries[i].data = cache_data[i];
+		sys_dlist_append(&lru_list, &cache_entries[i].lru_node);
+	}
+
+	for (int i = 0; i < CACHE_BUCKETS; i++) {
+		sys_slist_init(&cache_buckets[i]);
+	}
+
+	return 0;
+}
+
+SYS_INIT(disk_cache_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_SUBSYS_DISK_DISK_CACHE_H_
+#define ZEPHYR_SUBSYS_DISK_DISK_CACHE_H_
+
+#include <zephyr/drivers/disk.h>
+
+/*
+ * Internal interface between the disk access layer and the sector cache.
+ * The disk access layer calls these in place of the driver operations
+ * when CONFIG_DISK_CACHE is enabled.
+ */
+
+/* Query disk geometry and start caching it, called after driver init */
+void disk_cache_attach(struct disk_info *disk);
+
+/* Write back and drop every cached sector of the disk */
+int disk_cache_detach(struct disk_info *disk);
+
+int disk_cache_read(struct disk_info *disk, uint8_t *data_buf,
+		    uint32_t start_sector, uint32_t num_sector);
+
+int disk_cache_write(struct disk_info *disk, const uint8_t *data_buf,
+		     uint32_t start_sector, uint32_t num_sector);
+
+/* Write back all dirty sectors of the disk */
+int disk_cache_sync(struct disk_info *disk);
+
+#endif /* ZEPHYR_SUBSYS_DISK_DISK_CACHE_H_ */
@@ -172,6 +172,12 @@ fcb_init(int f_area_id, struct fcb *fcb)
 			break;
 		}
 	}
+
+	if (IS_ENABLED(CONFIG_FCB_ENTRY_INDEX) && rc == 0) {
+		/* A full index is not an error, FCB then reads flash */
+		(void)fcb_index_build(fcb);
+	}
+
 	k_mutex_init(&fcb->f_mtx);
 	return rc;
 }
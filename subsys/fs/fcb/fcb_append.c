@@ -64,6 +64,7 @@ fcb_append(struct fcb *fcb, uint16_t len, struct fcb_entry *append_loc)
 	int cnt;
 	int rc;
 	uint8_t tmp_str[8];
+	uint16_t data_len = len;
 
 	cnt = fcb_put_len(fcb, tmp_str, len);
 	if (cnt < 0) {
@@ -106,6 +107,10 @@ fcb_append(struct fcb *fcb, uint16_t len, struct fcb_entry *append_loc)
 
 	active->fe_elem_off = append_loc->fe_data_off + len;
 
+	if (IS_ENABLED(CONFIG_FCB_ENTRY_INDEX)) {
+		fcb_index_append(fcb, append_loc, data_len);
+	}
+
 	k_mutex_unlock(&fcb->f_mtx);
 
 	return 0;
@@ -133,5 +138,15 @@ fcb_append_finish(struct fcb *fcb, struct fcb_entry *loc)
 	if (rc) {
 		return -EIO;
 	}
+
+	if (IS_ENABLED(CONFIG_FCB_ENTRY_INDEX)) {
+		rc = k_mutex_lock(&fcb->f_mtx, K_FOREVER);
+		if (rc) {
+			return -EINVAL;
+		}
+		fcb_index_finish(fcb, loc);
+		k_mutex_unlock(&fcb->f_mtx);
+	}
+
 	return 0;
 }
@@ -45,6 +45,15 @@ fcb_getnext_nolock(struct fcb *fcb, struct fcb_entry *loc)
 {
 	int rc;
 
+#ifdef CONFIG_FCB_ENTRY_INDEX
+	if (fcb->f_index_ok) {
+		rc = fcb_index_getnext(fcb, loc);
+		if (rc != -EAGAIN) {
+			return rc;
+		}
+	}
+#endif
+
 	if (loc->fe_sector == NULL) {
 		/*
 		 * Find the first one we have in flash.
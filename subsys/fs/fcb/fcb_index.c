@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * RAM index of the FCB elements.
+ *
+ * The index is a ring buffer of the elements ordered from the oldest to the
+ * newest one, which is the order of fcb_getnext(). Elements are appended when
+ * space for them is reserved and marked valid once fcb_append_finish() has
+ * written their CRC; fcb_rotate() drops the elements of the erased sector
+ * from the head. Entries with a CRC that does not match are not indexed at
+ * all, as iterators skip them anyway.
+ */
+
+#include <errno.h>
+
+#include <zephyr/fs/fcb.h>
+#include "fcb_priv.h"
+
+static inline uint8_t sector_idx(const struct fcb *fcb,
+				 const struct flash_sector *sector)
+{
+	return sector - fcb->f_sectors;
+}
+
+/* Position of a sector in the circular buffer, the oldest one being 0 */
+static inline uint16_t sector_pos(const struct fcb *fcb, uint8_t idx)
+{
+	return (idx + fcb->f_sector_cnt - sector_idx(fcb, fcb->f_oldest)) %
+	       fcb->f_sector_cnt;
+}
+
+/* Index entry of the n-th element, counting from the oldest one */
+static inline struct fcb_index_entry *index_at(struct fcb *fcb, uint16_t n)
+{
+	return &fcb->f_index[(fcb->f_index_head + n) %
+			     CONFIG_FCB_ENTRY_INDEX_SIZE];
+}
+
+static int index_add(struct fcb *fcb, const struct fcb_entry *loc,
+		     uint16_t len, bool valid)
+{
+	struct fcb_index_entry *ent;
+
+	if (fcb->f_index_cnt == CONFIG_FCB_ENTRY_INDEX_SIZE) {
+		/* Out of room: iterators read flash until rebuilt */
+		fcb->f_index_ok = false;
+		return -ENOMEM;
+	}
+
+	ent = index_at(fcb, fcb->f_index_cnt++);
+	ent->fi_elem_off = loc->fe_elem_off;
+	ent->fi_data_len = len;
+	ent->fi_sector = sector_idx(fcb, loc->fe_sector);
+	ent->fi_valid = valid;
+
+	return 0;
+}
+
+/* True if element n is located after elem_off of the sector at position pos */
+static inline bool index_after(struct fcb *fcb, uint16_t n, uint16_t pos,
+			       uint32_t elem_off)
+{
+	struct fcb_index_entry *ent = index_at(fcb, n);
+	uint16_t ent_pos = sector_pos(fcb, ent->fi_sector);
+
+	return (ent_pos > pos) ||
+	       ((ent_pos == pos) && (ent->fi_elem_off > elem_off));
+}
+
+int fcb_index_build(struct fcb *fcb)
+{
+	struct fcb_entry loc;
+	int rc;
+
+	fcb->f_index_head = 0U;
+	fcb->f_index_cnt = 0U;
+	fcb->f_index_hint = 0U;
+	fcb->f_index_ok = true;
+
+	loc.fe_sector = fcb->f_oldest;
+	while (1) {
+		loc.fe_elem_off = sizeof(struct fcb_disk_area);
+		while (1) {
+			rc = fcb_elem_info(fcb, &loc);
+			if (rc == 0) {
+				rc = index_add(fcb, &loc, loc.fe_data_len,
+					       true);
+				if (rc) {
+					return rc;
+				}
+			} else if (rc != -EBADMSG) {
+				break;
+			}
+			loc.fe_elem_off = loc.fe_data_off +
+			  fcb_len_in_flash(fcb, loc.fe_data_len) +
+			  fcb_len_in_flash(fcb, FCB_CRC_SZ);
+		}
+
+		if (loc.fe_sector == fcb->f_active.fe_sector) {
+			break;
+		}
+		loc.fe_sector = fcb_getnext_sector(fcb, loc.fe_sector);
+	}
+
+	return 0;
+}
+
+void fcb_index_append(struct fcb *fcb, const struct fcb_entry *loc,
+		      uint16_t len)
+{
+	if (fcb->f_index_ok) {
+		(void)index_add(fcb, loc, len, false);
+	}
+}
+
+void fcb_index_finish(struct fcb *fcb, const struct fcb_entry *loc)
+{
+	struct fcb_index_entry *ent;
+	uint8_t idx = sector_idx(fcb, loc->fe_sector);
+
+	if (!fcb->f_index_ok) {
+		return;
+	}
+
+	/* Elements are usually finished in the order they were appended */
+	for (int n = fcb->f_index_cnt - 1; n >= 0; n--) {
+		ent = index_at(fcb, n);
+		if ((ent->fi_sector == idx) &&
+		    (ent->fi_elem_off == loc->fe_elem_off)) {
+			ent->fi_valid = true;
+			break;
+		}
+	}
+}
+
+void fcb_index_rotate(struct fcb *fcb, const struct flash_sector *sector)
+{
+	uint8_t idx = sector_idx(fcb, sector);
+
+	if (!fcb->f_index_ok) {
+		(void)fcb_index_build(fcb);
+		return;
+	}
+
+	while ((fcb->f_index_cnt > 0U) && (index_at(fcb, 0)->fi_sector == idx)) {
+		fcb->f_index_head = (fcb->f_index_head + 1U) %
+				    CONFIG_FCB_ENTRY_INDEX_SIZE;
+		fcb->f_index_cnt--;
+	}
+	fcb->f_index_hint = 0U;
+}
+
+int fcb_index_getnext(struct fcb *fcb, struct fcb_entry *loc)
+{
+	struct fcb_index_entry *ent;
+	uint16_t n = 0U;
+
+	if (loc->fe_sector != NULL) {
+		uint16_t pos = sector_pos(fcb, sector_idx(fcb, loc->fe_sector));
+		uint16_t lo = 0U;
+		uint16_t hi = fcb->f_index_cnt;
+
+		if (pos > sector_pos(fcb, sector_idx(fcb,
+						     fcb->f_active.fe_sector))) {
+			/* Sector not in use, leave it to the flash walk */
+			return -EAGAIN;
+		}
+
+		ent = index_at(fcb, fcb->f_index_hint);
+		if ((fcb->f_index_hint < fcb->f_index_cnt) &&
+		    (loc->fe_elem_off != 0U) &&
+		    (ent->fi_sector == sector_idx(fcb, loc->fe_sector)) &&
+		    (ent->fi_elem_off == loc->fe_elem_off)) {
+			/* Iterating: continue after the previous element */
+			lo = fcb->f_index_hint + 1U;
+		} else {
+			/* Find the first element after the location */
+			while (lo < hi) {
+				uint16_t mid = lo + (hi - lo) / 2U;
+
+				if (index_after(fcb, mid, pos,
+						loc->fe_elem_off)) {
+					hi = mid;
+				} else {
+					lo = mid + 1U;
+				}
+			}
+		}
+		n = lo;
+	}
+
+	for (; n < fcb->f_index_cnt; n++) {
+		ent = index_at(fcb, n);
+		if (!ent->fi_valid) {
+			continue;
+		}
+
+		loc->fe_sector = &fcb->f_sectors[ent->fi_sector];
+		loc->fe_elem_off = ent->fi_elem_off;
+		loc->fe_data_off = ent->fi_elem_off +
+			fcb_len_in_flash(fcb, (ent->fi_data_len < 0x80) ? 1 : 2);
+		loc->fe_data_len = ent->fi_data_len;
+		fcb->f_index_hint = n;
+
+		return 0;
+	}
+
+	return -ENOTSUP;
+}
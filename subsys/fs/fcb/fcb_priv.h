@@ -76,6 +76,13 @@ int fcb_sector_hdr_init(struct fcb *fcb, struct flash_sector *sector, uint16_t i
 int fcb_sector_hdr_read(struct fcb *fcb, struct flash_sector *sector,
 			struct fcb_disk_area *fdap);
 
+int fcb_index_build(struct fcb *fcb);
+void fcb_index_append(struct fcb *fcb, const struct fcb_entry *loc,
+		      uint16_t len);
+void fcb_index_finish(struct fcb *fcb, const struct fcb_entry *loc);
+void fcb_index_rotate(struct fcb *fcb, const struct flash_sector *sector);
+int fcb_index_getnext(struct fcb *fcb, struct fcb_entry *loc);
+
 #ifdef __cplusplus
 }
 #endif
@@ -38,7 +38,12 @@ fcb_rotate(struct fcb *fcb)
 		fcb->f_active.fe_elem_off = sizeof(struct fcb_disk_area);
 		fcb->f_active_id++;
 	}
+	sector = fcb->f_oldest;
 	fcb->f_oldest = fcb_getnext_sector(fcb, fcb->f_oldest);
+
+	if (IS_ENABLED(CONFIG_FCB_ENTRY_INDEX)) {
+		fcb_index_rotate(fcb, sector);
+	}
 out:
 	k_mutex_unlock(&fcb->f_mtx);
 	return rc;
@@ -15,6 +15,8 @@
 #include <zephyr/fs/fs_sys.h>
 #include <zephyr/sys/check.h>
 
+#include "fs_async.h"
+
 
 #define LOG_LEVEL CONFIG_FS_LOG_LEVEL
 #include <zephyr/logging/log.h>
@@ -184,6 +186,10 @@ int fs_close(struct fs_file_t *zfp)
 		return -ENOTSUP;
 	}
 
+	if (IS_ENABLED(CONFIG_FILE_SYSTEM_ASYNC)) {
+		fs_async_mount_drain((struct fs_mount_t *)zfp->mp);
+	}
+
 	rc = zfp->mp->fs->close(zfp);
 	if (rc < 0) {
 		LOG_ERR("file close error (%d)", rc);
@@ -706,6 +712,10 @@ int fs_mount(struct fs_mount_t *mp)
 	mp->mountp_len = len;
 	mp->fs = fs;
 
+	if (IS_ENABLED(CONFIG_FILE_SYSTEM_ASYNC)) {
+		fs_async_mount_init(mp);
+	}
+
 	sys_dlist_append(&fs_mnt_list, &mp->node);
 	LOG_DBG("fs mounted at %s", log_strdup(mp->mnt_point));
 
@@ -736,12 +746,20 @@ int fs_unmount(struct fs_mount_t *mp)
 		goto unmount_err;
 	}
 
+	if (IS_ENABLED(CONFIG_FILE_SYSTEM_ASYNC)) {
+		fs_async_mount_drain(mp);
+	}
+
 	rc = mp->fs->unmount(mp);
 	if (rc < 0) {
 		LOG_ERR("fs unmount error (%d)", rc);
 		goto unmount_err;
 	}
 
+	if (IS_ENABLED(CONFIG_FILE_SYSTEM_ASYNC)) {
+		fs_async_mount_release(mp);
+	}
+
 	/* clear file system interface */
 	mp->fs = NULL;
 
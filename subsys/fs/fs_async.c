@@ -0,0 +1,370 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Asynchronous file requests.
+ *
+ * Every mount point has a request queue and a work item, run by a work
+ * queue dedicated to file I/O, so that producers do not block for the
+ * duration of file system operations like flash erase cycles. Requests of
+ * a mount point are executed in submission order; a run of writes to the
+ * same file is copied into the merge buffer of the worker and handed to
+ * the file system as one write, followed by at most one sync.
+ *
+ * Each mount point is bound to its own worker when it is mounted, so that
+ * a slow medium does not delay requests to the other ones. Workers are
+ * allocated statically; once CONFIG_FILE_SYSTEM_ASYNC_WORKERS mount points
+ * are active, further ones share the least loaded worker.
+ */
+
+#include <string.h>
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/fs/fs_sys.h>
+#include <zephyr/sys/check.h>
+
+#include "fs_async.h"
+
+#define LOG_LEVEL CONFIG_FS_LOG_LEVEL
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(fs);
+
+struct fs_async_worker {
+	struct k_work_q workq;
+#if CONFIG_FILE_SYSTEM_ASYNC_MERGE_SIZE > 0
+	/* Only used from the work queue thread */
+	uint8_t merge_buf[CONFIG_FILE_SYSTEM_ASYNC_MERGE_SIZE] __aligned(4);
+#endif
+	/* Number of mount points bound to the worker, under the fs mutex */
+	uint8_t mounts;
+};
+
+static K_KERNEL_STACK_ARRAY_DEFINE(fs_async_stacks,
+				   CONFIG_FILE_SYSTEM_ASYNC_WORKERS,
+				   CONFIG_FILE_SYSTEM_ASYNC_STACK_SIZE);
+static struct fs_async_worker fs_async_workers[CONFIG_FILE_SYSTEM_ASYNC_WORKERS];
+
+/* File objects only keep a const pointer to their mount point */
+static inline struct fs_mount_t *req_mount(struct fs_async_req *req)
+{
+	return (struct fs_mount_t *)req->zfp->mp;
+}
+
+static struct fs_async_req *queue_get(struct fs_mount_t *mp)
+{
+	k_spinlock_key_t key = k_spin_lock(&mp->async_lock);
+	sys_snode_t *node = sys_slist_get(&mp->async_queue);
+
+	k_spin_unlock(&mp->async_lock, key);
+
+	return SYS_SLIST_CONTAINER(node, (struct fs_async_req *)NULL, node);
+}
+
+#if CONFIG_FILE_SYSTEM_ASYNC_MERGE_SIZE > 0
+/* Dequeue the next request if it can be folded into the current write
+ * batch: a write to the same file that still fits the merge buffer, or a
+ * sync of the same file.
+ */
+static struct fs_async_req *queue_get_mergeable(struct fs_mount_t *mp,
+						struct fs_file_t *zfp,
+						size_t merged)
+{
+	struct fs_async_req *next = NULL;
+	k_spinlock_key_t key = k_spin_lock(&mp->async_lock);
+	sys_snode_t *node = sys_slist_peek_head(&mp->async_queue);
+
+	if (node != NULL) {
+		next = CONTAINER_OF(node, struct fs_async_req, node);
+
+		if ((next->zfp != zfp) ||
+		    ((next->op == FS_ASYNC_WRITE) &&
+		     (merged + next->size > CONFIG_FILE_SYSTEM_ASYNC_MERGE_SIZE)) ||
+		    (next->op == FS_ASYNC_READ)) {
+			next = NULL;
+		} else {
+			(void)sys_slist_get(&mp->async_queue);
+		}
+	}
+
+	k_spin_unlock(&mp->async_lock, key);
+
+	return next;
+}
+#endif
+
+static void req_complete(struct fs_async_req *req, ssize_t result)
+{
+	req->result = result;
+
+#if defined(CONFIG_POLL)
+	if (req->signal != NULL) {
+		k_poll_signal_raise(req->signal, (int)result);
+	}
+#endif
+
+	if (req->cb != NULL) {
+		req->cb(req);
+	}
+}
+
+static void process_write(struct fs_mount_t *mp, struct fs_async_req *req)
+{
+	struct fs_file_t *zfp = req->zfp;
+#if CONFIG_FILE_SYSTEM_ASYNC_MERGE_SIZE > 0
+	uint8_t *merge_buf = mp->async_worker->merge_buf;
+#endif
+	sys_slist_t batch;
+	sys_snode_t *node;
+	struct fs_async_req *next;
+	const void *data = req->buf;
+	size_t merged = req->size;
+	bool sync = (req->flags & FS_ASYNC_FLAG_SYNC) != 0U;
+	ssize_t wrc;
+	int src = 0;
+
+	sys_slist_init(&batch);
+	sys_slist_append(&batch, &req->node);
+
+#if CONFIG_FILE_SYSTEM_ASYNC_MERGE_SIZE > 0
+	if (merged < CONFIG_FILE_SYSTEM_ASYNC_MERGE_SIZE) {
+		while ((next = queue_get_mergeable(mp, zfp, merged)) != NULL) {
+			if (next->op == FS_ASYNC_SYNC) {
+				sync = true;
+			} else {
+				if (data != merge_buf) {
+					memcpy(merge_buf, req->buf, req->size);
+					data = merge_buf;
+				}
+				memcpy(&merge_buf[merged], next->buf, next->size);
+				merged += next->size;
+				sync |= (next->flags & FS_ASYNC_FLAG_SYNC) != 0U;
+			}
+			sys_slist_append(&batch, &next->node);
+		}
+	}
+#endif
+
+	wrc = mp->fs->write(zfp, data, merged);
+	if (wrc < 0) {
+		LOG_ERR("file write error (%zd)", wrc);
+	} else if (sync && (mp->fs->sync != NULL)) {
+		src = mp->fs->sync(zfp);
+		if (src < 0) {
+			LOG_ERR("file sync error (%d)", src);
+		}
+	}
+
+	/* Distribute the bytes written over the batch, in order */
+	while ((node = sys_slist_get(&batch)) != NULL) {
+		ssize_t result;
+
+		next = CONTAINER_OF(node, struct fs_async_req, node);
+
+		if (wrc < 0) {
+			result = wrc;
+		} else if (next->op == FS_ASYNC_SYNC) {
+			result = src;
+		} else {
+			result = MIN((size_t)wrc, next->size);
+			wrc -= result;
+			if ((next->flags & FS_ASYNC_FLAG_SYNC) && (src < 0)) {
+				result = src;
+			}
+		}
+
+		req_complete(next, result);
+	}
+}
+
+static void async_work_handler(struct k_work *work)
+{
+	struct fs_mount_t *mp = CONTAINER_OF(work, struct fs_mount_t,
+					     async_work);
+	struct fs_async_req *req;
+	ssize_t rc;
+
+	while ((req = queue_get(mp)) != NULL) {
+		switch (req->op) {
+		case FS_ASYNC_WRITE:
+			process_write(mp, req);
+			continue;
+		case FS_ASYNC_READ:
+			rc = mp->fs->read(req->zfp, req->buf, req->size);
+			if (rc < 0) {
+				LOG_ERR("file read error (%zd)", rc);
+			}
+			break;
+		case FS_ASYNC_SYNC:
+			rc = mp->fs->sync(req->zfp);
+			if (rc < 0) {
+				LOG_ERR("file sync error (%zd)", rc);
+			}
+			break;
+		default:
+			rc = -EINVAL;
+			break;
+		}
+
+		req_complete(req, rc);
+	}
+}
+
+static int async_submit(struct fs_file_t *zfp, struct fs_async_req *req,
+			enum fs_async_op op, void *buf, size_t size,
+			uint8_t flags)
+{
+	struct fs_mount_t *mp;
+	k_spinlock_key_t key;
+
+	CHECKIF(req == NULL) {
+		return -EINVAL;
+	}
+
+	if (zfp->mp == NULL) {
+		return -EBADF;
+	}
+
+	req->zfp = zfp;
+	req->op = op;
+	req->buf = buf;
+	req->size = size;
+	req->flags = flags;
+	req->result = -EINPROGRESS;
+
+#if defined(CONFIG_POLL)
+	if (req->signal != NULL) {
+		k_poll_signal_reset(req->signal);
+	}
+#endif
+
+	mp = req_mount(req);
+
+	key = k_spin_lock(&mp->async_lock);
+	sys_slist_append(&mp->async_queue, &req->node);
+	k_spin_unlock(&mp->async_lock, key);
+
+	(void)k_work_submit_to_queue(&mp->async_worker->workq,
+				     &mp->async_work);
+
+	return 0;
+}
+
+int fs_read_async(struct fs_file_t *zfp, void *ptr, size_t size,
+		  struct fs_async_req *req)
+{
+	if (zfp->mp == NULL) {
+		return -EBADF;
+	}
+
+	CHECKIF(zfp->mp->fs->read == NULL) {
+		return -ENOTSUP;
+	}
+
+	return async_submit(zfp, req, FS_ASYNC_READ, ptr, size, 0);
+}
+
+int fs_write_async(struct fs_file_t *zfp, const void *ptr, size_t size,
+		   uint8_t flags, struct fs_async_req *req)
+{
+	if (zfp->mp == NULL) {
+		return -EBADF;
+	}
+
+	CHECKIF(zfp->mp->fs->write == NULL) {
+		return -ENOTSUP;
+	}
+
+	return async_submit(zfp, req, FS_ASYNC_WRITE, (void *)ptr, size,
+			    flags);
+}
+
+int fs_sync_async(struct fs_file_t *zfp, struct fs_async_req *req)
+{
+	if (zfp->mp == NULL) {
+		return -EBADF;
+	}
+
+	CHECKIF(zfp->mp->fs->sync == NULL) {
+		return -ENOTSUP;
+	}
+
+	return async_submit(zfp, req, FS_ASYNC_SYNC, NULL, 0, 0);
+}
+
+int fs_async_flush(struct fs_file_t *zfp)
+{
+	if (zfp->mp == NULL) {
+		return -EBADF;
+	}
+
+	fs_async_mount_drain((struct fs_mount_t *)zfp->mp);
+
+	return 0;
+}
+
+void fs_async_mount_init(struct fs_mount_t *mp)
+{
+	struct fs_async_worker *worker = &fs_async_workers[0];
+
+	for (int i = 1; i < ARRAY_SIZE(fs_async_workers); i++) {
+		if (fs_async_workers[i].mounts < worker->mounts) {
+			worker = &fs_async_workers[i];
+		}
+	}
+
+	if (worker->mounts > 0U) {
+		LOG_WRN("%s shares an async worker with %u mount point(s)",
+			log_strdup(mp->mnt_point), worker->mounts);
+	}
+
+	worker->mounts++;
+	mp->async_worker = worker;
+
+	k_work_init(&mp->async_work, async_work_handler);
+	sys_slist_init(&mp->async_queue);
+}
+
+void fs_async_mount_release(struct fs_mount_t *mp)
+{
+	mp->async_worker->mounts--;
+	mp->async_worker = NULL;
+}
+
+void fs_async_mount_drain(struct fs_mount_t *mp)
+{
+	struct k_work_sync sync;
+
+	/* Completion callbacks run in the work queue, which processes the
+	 * requests in order anyway.
+	 */
+	if (k_current_get() == &mp->async_worker->workq.thread) {
+		return;
+	}
+
+	(void)k_work_flush(&mp->async_work, &sync);
+}
+
+static int fs_async_init(const struct device *dev)
+{
+	const struct k_work_queue_config cfg = {
+		.name = "fs_async",
+	};
+
+	ARG_UNUSED(dev);
+
+	for (int i = 0; i < ARRAY_SIZE(fs_async_workers); i++) {
+		k_work_queue_start(&fs_async_workers[i].workq,
+				   fs_async_stacks[i],
+				   K_KERNEL_STACK_SIZEOF(fs_async_stacks[i]),
+				   CONFIG_FILE_SYSTEM_ASYNC_PRIORITY, &cfg);
+	}
+
+	return 0;
+}
+
+SYS_INIT(fs_async_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Hooks of the asynchronous request queue into the file system core. */
+
+#ifndef ZEPHYR_SUBSYS_FS_FS_ASYNC_H_
+#define ZEPHYR_SUBSYS_FS_FS_ASYNC_H_
+
+#include <zephyr/fs/fs.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Prepare the request queue of a newly mounted file system and bind it
+ * to a worker
+ */
+void fs_async_mount_init(struct fs_mount_t *mp);
+
+/* Unbind an unmounted file system from its worker */
+void fs_async_mount_release(struct fs_mount_t *mp);
+
+/* Wait until all requests queued on the mount point have completed */
+void fs_async_mount_drain(struct fs_mount_t *mp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_SUBSYS_FS_FS_ASYNC_H_ */
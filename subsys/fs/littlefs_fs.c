@@ -81,6 +81,13 @@ static inline void fc_release(void *buf)
 static inline void fs_lock(struct fs_littlefs *fs)
 {
 	k_mutex_lock(&fs->mutex, K_FOREVER);
+
+#ifdef CONFIG_FS_LITTLEFS_BACKGROUND_MOUNT
+	/* Hold off the first accesses until the background mount is done */
+	while (fs->mount_pending) {
+		(void)k_condvar_wait(&fs->mount_cv, &fs->mutex, K_FOREVER);
+	}
+#endif
 }
 
 static inline void fs_unlock(struct fs_littlefs *fs)
@@ -88,6 +95,33 @@ static inline void fs_unlock(struct fs_littlefs *fs)
 	k_mutex_unlock(&fs->mutex);
 }
 
+/* Lock for an operation that does not act on an open file or directory,
+ * which fails if the file system could not be mounted in the background.
+ */
+static inline int fs_lock_mounted(struct fs_littlefs *fs)
+{
+	fs_lock(fs);
+
+#ifdef CONFIG_FS_LITTLEFS_BACKGROUND_MOUNT
+	int ret = fs->mount_rc;
+
+	if (ret < 0) {
+		fs_unlock(fs);
+		return ret;
+	}
+#endif
+
+	return 0;
+}
+
+/* Called with the lock held by operations that may allocate or free blocks */
+static inline void usage_changed(struct fs_littlefs *fs)
+{
+#ifdef CONFIG_FS_LITTLEFS_STATVFS_CACHE
+	fs->used_blocks = -1;
+#endif
+}
+
 static int lfs_to_errno(int error)
 {
 	if (error >= 0) {
@@ -277,7 +311,6 @@ static int littlefs_open(struct fs_file_t *fp, const char *path,
 			 fs_mode_t zflags)
 {
 	struct fs_littlefs *fs = fp->mp->fs_data;
-	struct lfs *lfs = &fs->lfs;
 	int flags = lfs_flags_from_zephyr(zflags);
 	int ret = k_mem_slab_alloc(&file_data_pool, &fp->filep, K_NO_WAIT);
 
@@ -289,7 +322,7 @@ static int littlefs_open(struct fs_file_t *fp, const char *path,
 
 	memset(fdp, 0, sizeof(*fdp));
 
-	fdp->cache_block = fc_allocate(lfs->cfg->cache_size);
+	fdp->cache_block = fc_allocate(fs->cfg.cache_size);
 	if (fdp->cache_block == NULL) {
 		ret = -ENOMEM;
 		goto out;
@@ -298,10 +331,16 @@ static int littlefs_open(struct fs_file_t *fp, const char *path,
 	fdp->config.buffer = fdp->cache_block;
 	path = fs_impl_strip_prefix(path, fp->mp);
 
-	fs_lock(fs);
+	ret = fs_lock_mounted(fs);
+	if (ret < 0) {
+		goto out;
+	}
 
 	ret = lfs_file_opencfg(&fs->lfs, &fdp->file,
 			       path, flags, &fdp->config);
+	if ((flags & LFS_O_CREAT) != 0) {
+		usage_changed(fs);
+	}
 
 	fs_unlock(fs);
 out:
@@ -320,6 +359,7 @@ static int littlefs_close(struct fs_file_t *fp)
 
 	int ret = lfs_file_close(&fs->lfs, LFS_FILEP(fp));
 
+	usage_changed(fs);
 	fs_unlock(fs);
 
 	release_file_data(fp);
@@ -333,10 +373,15 @@ static int littlefs_unlink(struct fs_mount_t *mountp, const char *path)
 
 	path = fs_impl_strip_prefix(path, mountp);
 
-	fs_lock(fs);
+	int ret = fs_lock_mounted(fs);
+
+	if (ret < 0) {
+		return ret;
+	}
 
-	int ret = lfs_remove(&fs->lfs, path);
+	ret = lfs_remove(&fs->lfs, path);
 
+	usage_changed(fs);
 	fs_unlock(fs);
 	return lfs_to_errno(ret);
 }
@@ -349,10 +394,15 @@ static int littlefs_rename(struct fs_mount_t *mountp, const char *from,
 	from = fs_impl_strip_prefix(from, mountp);
 	to = fs_impl_strip_prefix(to, mountp);
 
-	fs_lock(fs);
+	int ret = fs_lock_mounted(fs);
+
+	if (ret < 0) {
+		return ret;
+	}
 
-	int ret = lfs_rename(&fs->lfs, from, to);
+	ret = lfs_rename(&fs->lfs, from, to);
 
+	usage_changed(fs);
 	fs_unlock(fs);
 	return lfs_to_errno(ret);
 }
@@ -377,6 +427,7 @@ static ssize_t littlefs_write(struct fs_file_t *fp, const void *ptr, size_t len)
 
 	ssize_t ret = lfs_file_write(&fs->lfs, LFS_FILEP(fp), ptr, len);
 
+	usage_changed(fs);
 	fs_unlock(fs);
 	return lfs_to_errno(ret);
 }
@@ -422,6 +473,7 @@ static int littlefs_truncate(struct fs_file_t *fp, off_t length)
 
 	int ret = lfs_file_truncate(&fs->lfs, LFS_FILEP(fp), length);
 
+	usage_changed(fs);
 	fs_unlock(fs);
 	return lfs_to_errno(ret);
 }
@@ -434,6 +486,7 @@ static int littlefs_sync(struct fs_file_t *fp)
 
 	int ret = lfs_file_sync(&fs->lfs, LFS_FILEP(fp));
 
+	usage_changed(fs);
 	fs_unlock(fs);
 	return lfs_to_errno(ret);
 }
@@ -443,10 +496,16 @@ static int littlefs_mkdir(struct fs_mount_t *mountp, const char *path)
 	struct fs_littlefs *fs = mountp->fs_data;
 
 	path = fs_impl_strip_prefix(path, mountp);
-	fs_lock(fs);
 
-	int ret = lfs_mkdir(&fs->lfs, path);
+	int ret = fs_lock_mounted(fs);
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = lfs_mkdir(&fs->lfs, path);
 
+	usage_changed(fs);
 	fs_unlock(fs);
 	return lfs_to_errno(ret);
 }
@@ -463,11 +522,12 @@ static int littlefs_opendir(struct fs_dir_t *dp, const char *path)
 
 	path = fs_impl_strip_prefix(path, dp->mp);
 
-	fs_lock(fs);
-
-	int ret = lfs_dir_open(&fs->lfs, dp->dirp, path);
+	int ret = fs_lock_mounted(fs);
 
-	fs_unlock(fs);
+	if (ret == 0) {
+		ret = lfs_dir_open(&fs->lfs, dp->dirp, path);
+		fs_unlock(fs);
+	}
 
 	if (ret < 0) {
 		k_mem_slab_free(&lfs_dir_pool, &dp->dirp);
@@ -528,10 +588,15 @@ static int littlefs_stat(struct fs_mount_t *mountp,
 
 	path = fs_impl_strip_prefix(path, mountp);
 
-	fs_lock(fs);
+	int ret = fs_lock_mounted(fs);
+
+	if (ret < 0) {
+		return ret;
+	}
 
 	struct lfs_info info;
-	int ret = lfs_stat(&fs->lfs, path, &info);
+
+	ret = lfs_stat(&fs->lfs, path, &info);
 
 	fs_unlock(fs);
 
@@ -547,17 +612,27 @@ static int littlefs_statvfs(struct fs_mount_t *mountp,
 			    const char *path, struct fs_statvfs *stat)
 {
 	struct fs_littlefs *fs = mountp->fs_data;
-	struct lfs *lfs = &fs->lfs;
 
-	stat->f_bsize = lfs->cfg->prog_size;
-	stat->f_frsize = lfs->cfg->block_size;
-	stat->f_blocks = lfs->cfg->block_count;
+	stat->f_bsize = fs->cfg.prog_size;
+	stat->f_frsize = fs->cfg.block_size;
+	stat->f_blocks = fs->cfg.block_count;
 
 	path = fs_impl_strip_prefix(path, mountp);
 
-	fs_lock(fs);
+	ssize_t ret = fs_lock_mounted(fs);
+
+	if (ret < 0) {
+		return ret;
+	}
 
-	ssize_t ret = lfs_fs_size(lfs);
+#ifdef CONFIG_FS_LITTLEFS_STATVFS_CACHE
+	if (fs->used_blocks < 0) {
+		fs->used_blocks = lfs_fs_size(&fs->lfs);
+	}
+	ret = fs->used_blocks;
+#else
+	ret = lfs_fs_size(&fs->lfs);
+#endif
 
 	fs_unlock(fs);
 
@@ -648,6 +723,83 @@ static int littlefs_flash_init(struct fs_mount_t *mountp)
 	return 0;
 }
 
+/* Mount it, formatting if needed. */
+static int littlefs_mount_lfs(struct fs_mount_t *mountp)
+{
+	struct fs_littlefs *fs = mountp->fs_data;
+	int ret = lfs_mount(&fs->lfs, &fs->cfg);
+
+	if (ret < 0 &&
+	    (mountp->flags & FS_MOUNT_FLAG_NO_FORMAT) == 0) {
+		LOG_WRN("can't mount (LFS %d); formatting", ret);
+		if ((mountp->flags & FS_MOUNT_FLAG_READ_ONLY) == 0) {
+			ret = lfs_format(&fs->lfs, &fs->cfg);
+			if (ret < 0) {
+				LOG_ERR("format failed (LFS %d)", ret);
+				return lfs_to_errno(ret);
+			}
+		} else {
+			LOG_ERR("can not format read-only system");
+			return -EROFS;
+		}
+
+		ret = lfs_mount(&fs->lfs, &fs->cfg);
+		if (ret < 0) {
+			LOG_ERR("remount after format failed (LFS %d)", ret);
+			return lfs_to_errno(ret);
+		}
+	}
+
+	LOG_INF("%s mounted", log_strdup(mountp->mnt_point));
+
+	return ret;
+}
+
+#ifdef CONFIG_FS_LITTLEFS_BACKGROUND_MOUNT
+BUILD_ASSERT(CONFIG_FS_LITTLEFS_BACKGROUND_MOUNT_PRIORITY >= 0 &&
+	     CONFIG_FS_LITTLEFS_BACKGROUND_MOUNT_PRIORITY >
+	     CONFIG_MAIN_THREAD_PRIORITY,
+	     "background mount must be preemptible and below main");
+
+static K_KERNEL_STACK_DEFINE(mount_workq_stack,
+			     CONFIG_FS_LITTLEFS_BACKGROUND_MOUNT_STACK_SIZE);
+static struct k_work_q mount_workq;
+
+static void background_mount_handler(struct k_work *work)
+{
+	struct fs_littlefs *fs = CONTAINER_OF(work, struct fs_littlefs,
+					      mount_work);
+	uint32_t start = k_uptime_get_32();
+	int ret;
+
+	/* Not fs_lock(), which would wait for this very mount */
+	k_mutex_lock(&fs->mutex, K_FOREVER);
+
+	ret = littlefs_mount_lfs(fs->mountp);
+
+#ifdef CONFIG_FS_LITTLEFS_STATVFS_CACHE
+	/* Validate the tree once while nobody is waiting for it yet */
+	if (ret == 0) {
+		fs->used_blocks = lfs_fs_size(&fs->lfs);
+	}
+#endif
+
+	if (ret < 0) {
+		LOG_ERR("background mount of %s failed: %d",
+			log_strdup(fs->mountp->mnt_point), ret);
+	} else {
+		LOG_INF("background mount took %u ms",
+			k_uptime_get_32() - start);
+	}
+
+	fs->mount_rc = ret;
+	fs->mount_pending = false;
+	k_condvar_broadcast(&fs->mount_cv);
+
+	k_mutex_unlock(&fs->mutex);
+}
+#endif /* CONFIG_FS_LITTLEFS_BACKGROUND_MOUNT */
+
 static int littlefs_mount(struct fs_mount_t *mountp)
 {
 	int ret = 0;
@@ -662,6 +814,14 @@ static int littlefs_mount(struct fs_mount_t *mountp)
 		return -EBUSY;
 	}
 
+#ifdef CONFIG_FS_LITTLEFS_BACKGROUND_MOUNT
+	fs->mount_pending = false;
+	fs->mount_rc = 0;
+#endif
+#ifdef CONFIG_FS_LITTLEFS_STATVFS_CACHE
+	fs->used_blocks = -1;
+#endif
+
 	/* Create and take mutex. */
 	k_mutex_init(&fs->mutex);
 	fs_lock(fs);
@@ -822,33 +982,21 @@ static int littlefs_mount(struct fs_mount_t *mountp)
 	lcp->block_count = block_count;
 	lcp->block_cycles = block_cycles;
 
-	/* Mount it, formatting if needed. */
-	ret = lfs_mount(&fs->lfs, &fs->cfg);
-	if (ret < 0 &&
-	    (mountp->flags & FS_MOUNT_FLAG_NO_FORMAT) == 0) {
-		LOG_WRN("can't mount (LFS %d); formatting", ret);
-		if ((mountp->flags & FS_MOUNT_FLAG_READ_ONLY) == 0) {
-			ret = lfs_format(&fs->lfs, &fs->cfg);
-			if (ret < 0) {
-				LOG_ERR("format failed (LFS %d)", ret);
-				ret = lfs_to_errno(ret);
-				goto out;
-			}
-		} else {
-			LOG_ERR("can not format read-only system");
-			ret = -EROFS;
-			goto out;
-		}
+#ifdef CONFIG_FS_LITTLEFS_BACKGROUND_MOUNT
+	if ((mountp->flags & FS_MOUNT_FLAG_AUTOMOUNT) != 0) {
+		fs->mountp = mountp;
+		fs->mount_pending = true;
+		k_condvar_init(&fs->mount_cv);
+		k_work_init(&fs->mount_work, background_mount_handler);
+		(void)k_work_submit_to_queue(&mount_workq, &fs->mount_work);
 
-		ret = lfs_mount(&fs->lfs, &fs->cfg);
-		if (ret < 0) {
-			LOG_ERR("remount after format failed (LFS %d)", ret);
-			ret = lfs_to_errno(ret);
-			goto out;
-		}
+		LOG_INF("%s mounting in background",
+			log_strdup(mountp->mnt_point));
+		goto out;
 	}
+#endif
 
-	LOG_INF("%s mounted", log_strdup(mountp->mnt_point));
+	ret = littlefs_mount_lfs(mountp);
 
 out:
 	if (ret < 0) {
@@ -866,7 +1014,14 @@ static int littlefs_unmount(struct fs_mount_t *mountp)
 
 	fs_lock(fs);
 
+#ifdef CONFIG_FS_LITTLEFS_BACKGROUND_MOUNT
+	/* A failed background mount left nothing to unmount */
+	if (fs->mount_rc == 0) {
+		lfs_unmount(&fs->lfs);
+	}
+#else
 	lfs_unmount(&fs->lfs);
+#endif
 
 	if (!littlefs_on_blkdev(mountp)) {
 		flash_area_close(fs->backend);
@@ -971,6 +1126,17 @@ static int littlefs_init(const struct device *dev)
 
 	int rc = fs_register(FS_LITTLEFS, &littlefs_fs);
 
+#ifdef CONFIG_FS_LITTLEFS_BACKGROUND_MOUNT
+	const struct k_work_queue_config cfg = {
+		.name = "littlefs_mount",
+	};
+
+	k_work_queue_start(&mount_workq, mount_workq_stack,
+			   K_KERNEL_STACK_SIZEOF(mount_workq_stack),
+			   K_PRIO_PREEMPT(CONFIG_FS_LITTLEFS_BACKGROUND_MOUNT_PRIORITY),
+			   &cfg);
+#endif
+
 	if (rc == 0) {
 		struct fs_mount_t **mpi = partitions;
 
@@ -31,6 +31,31 @@ static int file_ctr, newest, oldest;
 static int allocate_new_file(struct fs_file_t *file);
 static int del_oldest_log(void);
 static int get_log_file_id(struct fs_dirent *ent);
+
+#ifdef CONFIG_LOG_BACKEND_FS_ASYNC
+/* Log data queued for writing. Output buffer content is copied here, so
+ * that formatting of the next messages can go on while the file system
+ * writes the data in the background.
+ */
+struct async_chunk {
+	struct fs_async_req req;
+	uint8_t data[MAX_FLASH_WRITE_SIZE];
+};
+
+enum async_status_bits {
+	ASYNC_STATUS_ERROR,
+	ASYNC_STATUS_FULL,
+};
+
+K_MEM_SLAB_DEFINE_STATIC(async_slab, sizeof(struct async_chunk),
+			 CONFIG_LOG_BACKEND_FS_ASYNC_BUFFERS, 4);
+
+/* Set from completion callbacks, consumed by the logging thread */
+static atomic_t async_status;
+#endif
+
+/* Size of the current log file, including queued writes, in async mode */
+static size_t async_file_size;
 #ifndef CONFIG_LOG_BACKEND_FS_TESTSUITE
 static uint32_t log_format_current = CONFIG_LOG_BACKEND_FS_OUTPUT_DEFAULT;
 #endif
@@ -146,6 +171,62 @@ close_dir:
 	return rc;
 }
 
+#ifdef CONFIG_LOG_BACKEND_FS_ASYNC
+static void async_write_done(struct fs_async_req *req)
+{
+	struct async_chunk *chunk = CONTAINER_OF(req, struct async_chunk, req);
+
+	if (req->result < 0) {
+		atomic_set_bit(&async_status, ASYNC_STATUS_ERROR);
+	} else if (req->result != req->size) {
+		atomic_set_bit(&async_status, ASYNC_STATUS_FULL);
+	}
+
+	k_mem_slab_free(&async_slab, (void **)&chunk);
+}
+
+static int write_log_async(struct fs_file_t *f, uint8_t *data, size_t length)
+{
+	struct async_chunk *chunk;
+	atomic_val_t status = atomic_clear(&async_status);
+	int rc;
+
+	if (status & BIT(ASYNC_STATUS_ERROR)) {
+		return -EIO;
+	}
+
+	if (IS_ENABLED(CONFIG_LOG_BACKEND_FS_OVERWRITE) &&
+	    (status & BIT(ASYNC_STATUS_FULL))) {
+		/* Data of the short write is lost, make room for the next */
+		(void)fs_async_flush(f);
+		del_oldest_log();
+	}
+
+	/* Only blocks when all buffers are waiting for the file system */
+	(void)k_mem_slab_alloc(&async_slab, (void **)&chunk, K_FOREVER);
+
+	length = MIN(length, sizeof(chunk->data));
+	memcpy(chunk->data, data, length);
+	fs_async_req_init(&chunk->req, async_write_done, NULL);
+
+	rc = fs_write_async(f, chunk->data, length, FS_ASYNC_FLAG_SYNC,
+			    &chunk->req);
+	if (rc < 0) {
+		k_mem_slab_free(&async_slab, (void **)&chunk);
+		return rc;
+	}
+
+	async_file_size += length;
+
+	return length;
+}
+#else
+static int write_log_async(struct fs_file_t *f, uint8_t *data, size_t length)
+{
+	return -ENOTSUP;
+}
+#endif /* CONFIG_LOG_BACKEND_FS_ASYNC */
+
 int write_log_to_file(uint8_t *data, size_t length, void *ctx)
 {
 	int rc;
@@ -167,7 +248,8 @@ int write_log_to_file(uint8_t *data, size_t length, void *ctx)
 		/* Check if new data overwrites max file size.
 		 * If so, create new log file.
 		 */
-		int size = fs_tell(f);
+		int size = IS_ENABLED(CONFIG_LOG_BACKEND_FS_ASYNC) ?
+			   (int)async_file_size : fs_tell(f);
 
 		if (size < 0) {
 			backend_state = BACKEND_FS_CORRUPTED;
@@ -181,40 +263,49 @@ int write_log_to_file(uint8_t *data, size_t length, void *ctx)
 			}
 		}
 
-		rc = fs_write(f, data, length);
-		if (rc >= 0) {
-			if (IS_ENABLED(CONFIG_LOG_BACKEND_FS_OVERWRITE) &&
-			    (rc != length)) {
-				del_oldest_log();
-
-				return 0;
+		if (IS_ENABLED(CONFIG_LOG_BACKEND_FS_ASYNC)) {
+			rc = write_log_async(f, data, length);
+			if (rc < 0) {
+				goto on_error;
 			}
-			/* If overwrite is disabled, full memory
-			 * cause the log record abandonment.
-			 */
+
 			length = rc;
 		} else {
-			rc = check_log_file_exist(newest);
-			if (rc == 0) {
-				/* file was lost somehow
-				 * try to get a new one
+			rc = fs_write(f, data, length);
+			if (rc >= 0) {
+				if (IS_ENABLED(CONFIG_LOG_BACKEND_FS_OVERWRITE) &&
+				    (rc != length)) {
+					del_oldest_log();
+
+					return 0;
+				}
+				/* If overwrite is disabled, full memory
+				 * cause the log record abandonment.
 				 */
-				file_ctr--;
-				rc = allocate_new_file(f);
-				if (rc < 0) {
+				length = rc;
+			} else {
+				rc = check_log_file_exist(newest);
+				if (rc == 0) {
+					/* file was lost somehow
+					 * try to get a new one
+					 */
+					file_ctr--;
+					rc = allocate_new_file(f);
+					if (rc < 0) {
+						goto on_error;
+					}
+				} else if (rc < 0) {
+					/* fs is corrupted*/
 					goto on_error;
 				}
-			} else if (rc < 0) {
-				/* fs is corrupted*/
-				goto on_error;
+				length = 0;
 			}
-			length = 0;
-		}
 
-		rc = fs_sync(f);
-		if (rc < 0) {
-			/* Something is wrong */
-			goto on_error;
+			rc = fs_sync(f);
+			if (rc < 0) {
+				/* Something is wrong */
+				goto on_error;
+			}
 		}
 	}
 
@@ -390,6 +481,7 @@ static int allocate_new_file(struct fs_file_t *file)
 	if (rc < 0) {
 		goto out;
 	}
+	async_file_size = 0;
 	++file_ctr;
 	newest = curr_file_num;
 
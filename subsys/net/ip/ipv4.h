@@ -204,4 +204,96 @@ static inline int net_ipv4_parse_hdr_options(struct net_pkt *pkt,
 }
 #endif
 
+#if defined(CONFIG_NET_IPV4_FRAGMENT)
+/** Store pending IPv4 fragment information that is needed for reassembly. */
+struct net_ipv4_reassembly {
+	/** IPv4 source address of the fragment */
+	struct in_addr src;
+
+	/** IPv4 destination address of the fragment */
+	struct in_addr dst;
+
+	/**
+	 * Timeout for cancelling the reassembly. The timer is used
+	 * also to detect if this reassembly slot is used or not.
+	 */
+	struct k_work_delayable timer;
+
+	/** Pointers to pending fragments */
+	struct net_pkt *pkt[CONFIG_NET_IPV4_FRAGMENT_MAX_PKT];
+
+	/** IPv4 fragment identification */
+	uint16_t id;
+
+	/** IPv4 protocol of the fragment */
+	uint8_t protocol;
+};
+#else
+struct net_ipv4_reassembly;
+#endif
+
+/**
+ * @typedef net_ipv4_frag_cb_t
+ * @brief Callback used while iterating over pending IPv4 fragments.
+ *
+ * @param reass IPv4 fragment reassembly struct
+ * @param user_data A valid pointer on some user data or NULL
+ */
+typedef void (*net_ipv4_frag_cb_t)(struct net_ipv4_reassembly *reass,
+				   void *user_data);
+
+/**
+ * @brief Go through all the currently pending IPv4 fragments.
+ *
+ * @param cb Callback to call for each pending IPv4 fragment.
+ * @param user_data User specified data or NULL.
+ */
+void net_ipv4_frag_foreach(net_ipv4_frag_cb_t cb, void *user_data);
+
+/**
+ * @brief Handles IPv4 fragmented packets.
+ *
+ * The fragment is kept until all the fragments of the packet are
+ * received. The reassembled packet is then fed back to the IP stack.
+ *
+ * @param pkt Network head packet.
+ * @param hdr The IPv4 header of the current packet
+ *
+ * @return NET_OK if the fragment was consumed, NET_DROP otherwise.
+ */
+#if defined(CONFIG_NET_IPV4_FRAGMENT) && defined(CONFIG_NET_NATIVE_IPV4)
+enum net_verdict net_ipv4_handle_fragment_hdr(struct net_pkt *pkt,
+					      struct net_ipv4_hdr *hdr);
+#else
+static inline
+enum net_verdict net_ipv4_handle_fragment_hdr(struct net_pkt *pkt,
+					      struct net_ipv4_hdr *hdr)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(hdr);
+
+	return NET_DROP;
+}
+#endif /* CONFIG_NET_IPV4_FRAGMENT */
+
+/**
+ * @brief Split an IPv4 packet which does not fit the MTU of its network
+ * interface into fragments, and send them.
+ *
+ * @param pkt Network packet
+ *
+ * @return NET_OK if the packet can be sent as is, NET_CONTINUE if it was
+ * sent as fragments, NET_DROP if it cannot be sent.
+ */
+#if defined(CONFIG_NET_IPV4_FRAGMENT) && defined(CONFIG_NET_NATIVE_IPV4)
+enum net_verdict net_ipv4_prepare_for_send(struct net_pkt *pkt);
+#else
+static inline enum net_verdict net_ipv4_prepare_for_send(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return NET_OK;
+}
+#endif /* CONFIG_NET_IPV4_FRAGMENT */
+
 #endif /* __IPV4_H */
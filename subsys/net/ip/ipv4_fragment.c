@@ -0,0 +1,714 @@
+/** @file
+ * @brief IPv4 Fragment related functions
+ */
+
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_ipv4, CONFIG_NET_IPV4_LOG_LEVEL);
+
+#include <errno.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/net_stats.h>
+#include <zephyr/net/net_context.h>
+#include <zephyr/random/rand32.h>
+#include "net_private.h"
+#include "connection.h"
+#include "icmpv4.h"
+#include "ipv4.h"
+#include "net_stats.h"
+
+#define IPV4_REASSEMBLY_TIMEOUT K_SECONDS(CONFIG_NET_IPV4_FRAGMENT_TIMEOUT)
+
+#define BUF_ALLOC_TIMEOUT K_MSEC(100)
+
+/* Largest IPv4 packet, header included */
+#define IPV4_MAX_PKT_LEN 0xffff
+
+static void reassembly_timeout(struct k_work *work);
+static bool reassembly_init_done;
+
+/* Protects the reassembly slots from the timeout handler, which runs in
+ * the system work queue.
+ */
+static K_MUTEX_DEFINE(reassembly_lock);
+
+static struct net_ipv4_reassembly
+reassembly[CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT];
+
+/* A reassembly slot is in use as long as its timer is scheduled, or its
+ * timeout handler is running.
+ */
+static bool reassembly_in_use(struct net_ipv4_reassembly *reass)
+{
+	return k_work_delayable_is_pending(&reass->timer);
+}
+
+static struct net_ipv4_reassembly *reassembly_get(uint16_t id,
+						  struct in_addr *src,
+						  struct in_addr *dst,
+						  uint8_t protocol)
+{
+	int i, avail = -1;
+
+	for (i = 0; i < CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT; i++) {
+		if (!reassembly_in_use(&reassembly[i])) {
+			if (avail < 0) {
+				avail = i;
+			}
+
+			continue;
+		}
+
+		if (reassembly[i].id == id &&
+		    reassembly[i].protocol == protocol &&
+		    net_ipv4_addr_cmp(src, &reassembly[i].src) &&
+		    net_ipv4_addr_cmp(dst, &reassembly[i].dst)) {
+			return &reassembly[i];
+		}
+	}
+
+	if (avail < 0) {
+		return NULL;
+	}
+
+	k_work_reschedule(&reassembly[avail].timer, IPV4_REASSEMBLY_TIMEOUT);
+
+	net_ipaddr_copy(&reassembly[avail].src, src);
+	net_ipaddr_copy(&reassembly[avail].dst, dst);
+
+	reassembly[avail].id = id;
+	reassembly[avail].protocol = protocol;
+
+	return &reassembly[avail];
+}
+
+static void reassembly_cancel(struct net_ipv4_reassembly *reass)
+{
+	int i;
+
+	NET_DBG("Cancel 0x%x", reass->id);
+
+	k_work_cancel_delayable(&reass->timer);
+
+	for (i = 0; i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT; i++) {
+		if (!reass->pkt[i]) {
+			continue;
+		}
+
+		NET_DBG("[%d] IPv4 reassembly pkt %p %zd bytes data",
+			i, reass->pkt[i], net_pkt_get_len(reass->pkt[i]));
+
+		net_pkt_unref(reass->pkt[i]);
+		reass->pkt[i] = NULL;
+	}
+}
+
+static void reassembly_info(char *str, struct net_ipv4_reassembly *reass)
+{
+	NET_DBG("%s id 0x%x src %s dst %s remain %d ms", str, reass->id,
+		log_strdup(net_sprint_ipv4_addr(&reass->src)),
+		log_strdup(net_sprint_ipv4_addr(&reass->dst)),
+		k_ticks_to_ms_ceil32(
+			k_work_delayable_remaining_get(&reass->timer)));
+}
+
+static void reassembly_timeout(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct net_ipv4_reassembly *reass =
+		CONTAINER_OF(dwork, struct net_ipv4_reassembly, timer);
+
+	k_mutex_lock(&reassembly_lock, K_FOREVER);
+
+	/* The reassembly might have completed while we were waiting */
+	if (reass->pkt[0]) {
+		reassembly_info("Reassembly cancelled", reass);
+
+		/* Send an ICMPv4 Time Exceeded only if we received the first
+		 * fragment (RFC 792).
+		 */
+		if (net_pkt_ipv4_fragment_offset(reass->pkt[0]) == 0) {
+			net_icmpv4_send_error(reass->pkt[0],
+					      NET_ICMPV4_TIME_EXCEEDED,
+					      NET_ICMPV4_TIME_EXCEEDED_FRAG);
+		}
+
+		reassembly_cancel(reass);
+	}
+
+	k_mutex_unlock(&reassembly_lock);
+}
+
+static size_t fragment_hdr_len(struct net_pkt *pkt)
+{
+	return net_pkt_ip_hdr_len(pkt) + net_pkt_ipv4_opts_len(pkt);
+}
+
+/* Remove the IPv4 header from a fragment by moving the start of its
+ * buffers, so that the payload is not moved.
+ */
+static int strip_header(struct net_pkt *pkt, size_t len)
+{
+	while (len && pkt->buffer) {
+		struct net_buf *buf = pkt->buffer;
+
+		if (buf->len > len) {
+			net_buf_pull(buf, len);
+			return 0;
+		}
+
+		len -= buf->len;
+		pkt->buffer = buf->frags;
+		buf->frags = NULL;
+		net_buf_unref(buf);
+	}
+
+	return len ? -ENOBUFS : 0;
+}
+
+static void reassemble_packet(struct net_ipv4_reassembly *reass)
+{
+	NET_PKT_DATA_ACCESS_CONTIGUOUS_DEFINE(ipv4_access, struct net_ipv4_hdr);
+	struct net_ipv4_hdr *hdr;
+	uint16_t flag, new_flag;
+	struct net_pkt *pkt;
+	struct net_buf *last;
+	uint16_t len;
+	int i;
+
+	k_work_cancel_delayable(&reass->timer);
+
+	NET_ASSERT(reass->pkt[0]);
+
+	last = net_buf_frag_last(reass->pkt[0]->buffer);
+
+	/* We start from 2nd packet which is then appended to
+	 * the first one. The buffers of the fragments are chained,
+	 * their data is not copied.
+	 */
+	for (i = 1; i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT; i++) {
+		pkt = reass->pkt[i];
+		if (!pkt) {
+			break;
+		}
+
+		if (strip_header(pkt, fragment_hdr_len(pkt)) ||
+		    !pkt->buffer) {
+			NET_ERR("Failed to pull headers");
+			reassembly_cancel(reass);
+			return;
+		}
+
+		/* Attach the data to previous pkt */
+		last->frags = pkt->buffer;
+		last = net_buf_frag_last(pkt->buffer);
+
+		pkt->buffer = NULL;
+		reass->pkt[i] = NULL;
+
+		net_pkt_unref(pkt);
+	}
+
+	pkt = reass->pkt[0];
+	reass->pkt[0] = NULL;
+
+	/* Then we turn the header of the first fragment into the header
+	 * of the whole packet.
+	 */
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	hdr = (struct net_ipv4_hdr *)net_pkt_get_data(pkt, &ipv4_access);
+	if (!hdr) {
+		goto error;
+	}
+
+	len = htons(net_pkt_get_len(pkt));
+	flag = (hdr->offset[0] << 8) | hdr->offset[1];
+	new_flag = flag & ~(NET_IPV4_MORE_FRAG_MASK |
+			    NET_IPV4_FRAGH_OFFSET_MASK);
+
+	/* The checksum of the header is updated for the rewritten fields */
+	hdr->chksum = net_chksum_update(hdr->chksum, hdr->len, len);
+	hdr->chksum = net_chksum_update(hdr->chksum, htons(flag),
+					htons(new_flag));
+
+	hdr->len = len;
+	hdr->offset[0] = new_flag >> 8;
+	hdr->offset[1] = new_flag;
+
+	if (net_pkt_set_data(pkt, &ipv4_access)) {
+		goto error;
+	}
+
+	NET_DBG("New pkt %p IPv4 len is %zd bytes", pkt, net_pkt_get_len(pkt));
+
+	/* We need to use the queue when feeding the packet back into the
+	 * IP stack as we might run out of stack if we call processing_data()
+	 * directly. As the packet does not contain link layer header, we
+	 * MUST NOT pass it to L2 so there will be a special check for that
+	 * in process_data() when handling the packet: the fragment flags of
+	 * the first fragment, which has the MF flag set, are kept in it.
+	 */
+	if (net_recv_data(net_pkt_iface(pkt), pkt) >= 0) {
+		return;
+	}
+error:
+	net_pkt_unref(pkt);
+}
+
+void net_ipv4_frag_foreach(net_ipv4_frag_cb_t cb, void *user_data)
+{
+	int i;
+
+	k_mutex_lock(&reassembly_lock, K_FOREVER);
+
+	for (i = 0; reassembly_init_done &&
+		     i < CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT; i++) {
+		if (!reassembly_in_use(&reassembly[i])) {
+			continue;
+		}
+
+		cb(&reassembly[i], user_data);
+	}
+
+	k_mutex_unlock(&reassembly_lock);
+}
+
+/* Verify that we have all the fragments received and in correct order.
+ * Identical duplicates are discarded before being stored, so any fragment
+ * starting before the end of the previous one is a real overlap.
+ * Return:
+ * - a negative value if the fragments are erroneous and must be dropped
+ * - zero if we are expecting more fragments
+ * - a positive value if we can proceed with the reassembly
+ */
+static int fragments_are_ready(struct net_ipv4_reassembly *reass)
+{
+	unsigned int expected_offset = 0;
+	bool more = true;
+	int i;
+
+	for (i = 0; i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT; i++) {
+		struct net_pkt *pkt = reass->pkt[i];
+		unsigned int offset;
+
+		if (!pkt) {
+			break;
+		}
+
+		offset = net_pkt_ipv4_fragment_offset(pkt);
+
+		if (offset < expected_offset) {
+			/* Overlapping, drop it like RFC 8200 requires for
+			 * IPv6.
+			 */
+			return -EBADMSG;
+		} else if (offset != expected_offset) {
+			/* Not contiguous, let's wait for fragments */
+			return 0;
+		}
+
+		expected_offset += net_pkt_get_len(pkt) -
+				   fragment_hdr_len(pkt);
+		more = net_pkt_ipv4_fragment_more(pkt);
+	}
+
+	if (more) {
+		return 0;
+	}
+
+	return 1;
+}
+
+/* A retransmitted fragment covers the same data as the stored one */
+static bool fragment_is_duplicate(struct net_pkt *stored, struct net_pkt *pkt)
+{
+	return net_pkt_ipv4_fragment_offset(stored) ==
+		net_pkt_ipv4_fragment_offset(pkt) &&
+	       net_pkt_ipv4_fragment_more(stored) ==
+		net_pkt_ipv4_fragment_more(pkt) &&
+	       net_pkt_get_len(stored) - fragment_hdr_len(stored) ==
+		net_pkt_get_len(pkt) - fragment_hdr_len(pkt);
+}
+
+static int shift_packets(struct net_ipv4_reassembly *reass, int pos)
+{
+	int i;
+
+	for (i = pos + 1; i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT; i++) {
+		if (!reass->pkt[i]) {
+			NET_DBG("Moving [%d] %p (offset 0x%x) to [%d]",
+				pos, reass->pkt[pos],
+				net_pkt_ipv4_fragment_offset(reass->pkt[pos]),
+				pos + 1);
+
+			/* pkt[i] is free, so shift everything between
+			 * [pos] and [i - 1] by one element
+			 */
+			memmove(&reass->pkt[pos + 1], &reass->pkt[pos],
+				sizeof(void *) * (i - pos));
+
+			/* pkt[pos] is now free */
+			reass->pkt[pos] = NULL;
+
+			return 0;
+		}
+	}
+
+	/* We do not have free space left in the array */
+	return -ENOMEM;
+}
+
+enum net_verdict net_ipv4_handle_fragment_hdr(struct net_pkt *pkt,
+					      struct net_ipv4_hdr *hdr)
+{
+	struct net_ipv4_reassembly *reass;
+	size_t payload_len;
+	uint16_t flag;
+	uint16_t id;
+	int ret;
+	int i;
+
+	k_mutex_lock(&reassembly_lock, K_FOREVER);
+
+	if (!reassembly_init_done) {
+		/* Static initializing does not work here because of the array
+		 * so we must do it at runtime.
+		 */
+		for (i = 0; i < CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT; i++) {
+			k_work_init_delayable(&reassembly[i].timer,
+					      reassembly_timeout);
+		}
+
+		reassembly_init_done = true;
+	}
+
+	flag = (hdr->offset[0] << 8) | hdr->offset[1];
+	id = (hdr->id[0] << 8) | hdr->id[1];
+
+	net_pkt_set_ipv4_fragment_flags(pkt, flag);
+
+	payload_len = net_pkt_get_len(pkt) - fragment_hdr_len(pkt);
+
+	if (net_pkt_ipv4_fragment_more(pkt) && payload_len % 8) {
+		/* Only the last fragment may have a length which is not
+		 * a multiple of 8 bytes.
+		 */
+		NET_DBG("DROP: fragment length %zd is not a multiple of 8",
+			payload_len);
+		goto drop;
+	}
+
+	if (net_pkt_ipv4_fragment_offset(pkt) + payload_len +
+	    NET_IPV4H_LEN > IPV4_MAX_PKT_LEN) {
+		NET_DBG("DROP: fragment exceeds the maximum packet length");
+		goto drop;
+	}
+
+	reass = reassembly_get(id, (struct in_addr *)hdr->src,
+			       (struct in_addr *)hdr->dst, hdr->proto);
+	if (!reass) {
+		NET_DBG("Cannot get reassembly slot, dropping pkt %p", pkt);
+		goto drop;
+	}
+
+	/* The fragments might come in wrong order so place them
+	 * in reassembly chain in correct order.
+	 */
+	for (i = 0; i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT; i++) {
+		if (reass->pkt[i]) {
+			if (net_pkt_ipv4_fragment_offset(reass->pkt[i]) <
+			    net_pkt_ipv4_fragment_offset(pkt)) {
+				continue;
+			}
+
+			if (fragment_is_duplicate(reass->pkt[i], pkt)) {
+				/* Keep the reassembly going with the fragment
+				 * received first.
+				 */
+				NET_DBG("Duplicate fragment offset %d, dropping "
+					"pkt %p", net_pkt_ipv4_fragment_offset(pkt),
+					pkt);
+				goto drop;
+			}
+
+			/* Make room for this fragment. If there is no room,
+			 * then it will discard the whole reassembly.
+			 */
+			if (shift_packets(reass, i)) {
+				i = CONFIG_NET_IPV4_FRAGMENT_MAX_PKT;
+			}
+		}
+
+		break;
+	}
+
+	if (i == CONFIG_NET_IPV4_FRAGMENT_MAX_PKT) {
+		/* We could not add this fragment into our saved fragment
+		 * list. We must discard the whole packet at this point.
+		 */
+		NET_DBG("No slots available for 0x%x", reass->id);
+		reassembly_cancel(reass);
+		goto drop;
+	}
+
+	NET_DBG("Storing pkt %p to slot %d offset %d",
+		pkt, i, net_pkt_ipv4_fragment_offset(pkt));
+	reass->pkt[i] = pkt;
+
+	ret = fragments_are_ready(reass);
+	if (ret < 0) {
+		NET_DBG("Reassembled IPv4 verify failed, dropping id %u",
+			reass->id);
+
+		/* Let the caller release the already inserted pkt */
+		reass->pkt[i] = NULL;
+		reassembly_cancel(reass);
+		goto drop;
+	} else if (ret == 0) {
+		reassembly_info("Reassembly nth pkt", reass);
+
+		NET_DBG("More fragments to be received");
+		goto accept;
+	}
+
+	reassembly_info("Reassembly last pkt", reass);
+
+	/* The last fragment received, reassemble the packet */
+	reassemble_packet(reass);
+
+accept:
+	k_mutex_unlock(&reassembly_lock);
+
+	return NET_OK;
+
+drop:
+	k_mutex_unlock(&reassembly_lock);
+
+	return NET_DROP;
+}
+
+static int finalize_fragment(struct net_pkt *pkt, uint16_t id,
+			     uint16_t offset, bool more)
+{
+	NET_PKT_DATA_ACCESS_CONTIGUOUS_DEFINE(ipv4_access, struct net_ipv4_hdr);
+	struct net_ipv4_hdr *hdr;
+	uint16_t flag;
+
+	flag = offset / 8U;
+	if (more) {
+		flag |= NET_IPV4_MORE_FRAG_MASK;
+	}
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	hdr = (struct net_ipv4_hdr *)net_pkt_get_data(pkt, &ipv4_access);
+	if (!hdr) {
+		return -ENOBUFS;
+	}
+
+	hdr->len = htons(net_pkt_get_len(pkt));
+	hdr->id[0] = id >> 8;
+	hdr->id[1] = id;
+	hdr->offset[0] = flag >> 8;
+	hdr->offset[1] = flag;
+	hdr->chksum = 0U;
+
+	if (net_pkt_set_data(pkt, &ipv4_access)) {
+		return -ENOBUFS;
+	}
+
+	if (net_if_need_calc_tx_checksum(net_pkt_iface(pkt))) {
+		net_pkt_cursor_init(pkt);
+
+		hdr = (struct net_ipv4_hdr *)net_pkt_get_data(pkt,
+							      &ipv4_access);
+		if (!hdr) {
+			return -ENOBUFS;
+		}
+
+		hdr->chksum = net_calc_chksum_ipv4(pkt);
+
+		return net_pkt_set_data(pkt, &ipv4_access);
+	}
+
+	return 0;
+}
+
+/* Cut the packet after its first len bytes, and return a new packet made
+ * of the given IPv4 header followed by the data after the cut. The buffers
+ * following the cut are moved to the new packet, only the end of the buffer
+ * in which the cut happens, if any, is copied.
+ */
+static struct net_pkt *split_fragment(struct net_pkt *pkt, size_t len,
+				      struct net_ipv4_hdr *hdr)
+{
+	struct net_buf *buf = pkt->buffer;
+	struct net_buf *prev = NULL;
+	struct net_pkt *next;
+	size_t carry;
+
+	while (buf && buf->len <= len) {
+		len -= buf->len;
+		prev = buf;
+		buf = buf->frags;
+	}
+
+	if (!buf || (!prev && !len)) {
+		return NULL;
+	}
+
+	carry = len ? buf->len - len : 0;
+
+	next = net_pkt_alloc_with_buffer(net_pkt_iface(pkt),
+					 sizeof(*hdr) + carry, AF_UNSPEC, 0,
+					 BUF_ALLOC_TIMEOUT);
+	if (!next) {
+		return NULL;
+	}
+
+	if (net_pkt_write(next, hdr, sizeof(*hdr)) ||
+	    net_pkt_write(next, buf->data + len, carry)) {
+		net_pkt_unref(next);
+		return NULL;
+	}
+
+	if (len) {
+		buf->len = len;
+		prev = buf;
+		buf = buf->frags;
+	}
+
+	prev->frags = NULL;
+
+	if (buf) {
+		net_pkt_append_buffer(next, buf);
+	}
+
+	net_pkt_set_family(next, AF_INET);
+	net_pkt_set_ip_hdr_len(next, sizeof(*hdr));
+	net_pkt_set_ipv4_ttl(next, net_pkt_ipv4_ttl(pkt));
+	net_pkt_set_priority(next, net_pkt_priority(pkt));
+	net_pkt_set_vlan_tci(next, net_pkt_vlan_tci(pkt));
+
+	return next;
+}
+
+enum net_verdict net_ipv4_prepare_for_send(struct net_pkt *pkt)
+{
+	NET_PKT_DATA_ACCESS_CONTIGUOUS_DEFINE(ipv4_access, struct net_ipv4_hdr);
+	struct net_pkt *frag = pkt;
+	struct net_ipv4_hdr hdr;
+	struct net_ipv4_hdr *ip_hdr;
+	uint16_t offset = 0U;
+	uint16_t mtu;
+	uint16_t id;
+	int ret;
+
+	mtu = net_if_get_mtu(net_pkt_iface(pkt));
+	if (mtu == 0U) {
+		mtu = NET_IPV4_MTU;
+	}
+
+	if (net_pkt_get_len(pkt) <= mtu) {
+		return NET_OK;
+	}
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	ip_hdr = (struct net_ipv4_hdr *)net_pkt_get_data(pkt, &ipv4_access);
+	if (!ip_hdr) {
+		return NET_DROP;
+	}
+
+	if (ip_hdr->offset[0] & (NET_IPV4_DO_NOT_FRAG_MASK >> 8)) {
+		NET_DBG("DROP: pkt %p len %zd exceeds MTU %d, DF set", pkt,
+			net_pkt_get_len(pkt), mtu);
+		return NET_DROP;
+	}
+
+	if (fragment_hdr_len(pkt) + 8 > mtu) {
+		NET_DBG("DROP: MTU %d too small to fragment pkt %p", mtu, pkt);
+		return NET_DROP;
+	}
+
+	/* The header options, if any, are kept in the first fragment only */
+	memcpy(&hdr, ip_hdr, sizeof(hdr));
+	hdr.vhl = 0x45;
+
+	id = (hdr.id[0] << 8) | hdr.id[1];
+	if (id == 0U) {
+		id = sys_rand32_get();
+	}
+
+	/* The original packet is reused as the first fragment, the next
+	 * fragments take over the buffers which follow it.
+	 */
+	while (frag) {
+		size_t hdr_len = fragment_hdr_len(frag);
+		size_t len = net_pkt_get_len(frag) - hdr_len;
+		size_t fit_len = (mtu - hdr_len) & ~7U;
+		struct net_pkt *next = NULL;
+
+		if (len > fit_len) {
+			next = split_fragment(frag, hdr_len + fit_len, &hdr);
+			if (!next) {
+				ret = -ENOMEM;
+				goto fail;
+			}
+
+			len = fit_len;
+		}
+
+		/* The datagram has been accounted for by net_send_data()
+		 * already, so the fragments go straight to the interface.
+		 */
+		ret = finalize_fragment(frag, id, offset, next != NULL);
+		if (ret == 0) {
+			net_pkt_cursor_init(frag);
+			if (net_if_send_data(net_pkt_iface(frag), frag) ==
+			    NET_DROP) {
+				ret = -EIO;
+			}
+		}
+
+		if (ret < 0) {
+			if (next) {
+				net_pkt_unref(next);
+			}
+
+			goto fail;
+		}
+
+		offset += len;
+		frag = next;
+	}
+
+	return NET_CONTINUE;
+
+fail:
+	NET_DBG("Cannot send fragment (%d)", ret);
+
+	if (frag == pkt && offset == 0U && ret == -ENOMEM) {
+		/* Nothing has been modified yet, let the caller drop the
+		 * packet and report the error.
+		 */
+		return NET_DROP;
+	}
+
+	/* The fragments which were sent already cannot be recalled, so
+	 * the packet is lost.
+	 */
+	net_pkt_unref(frag);
+
+	return NET_CONTINUE;
+}
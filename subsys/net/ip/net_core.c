@@ -78,6 +78,15 @@ static inline enum net_verdict process_data(struct net_pkt *pkt,
 	}
 #endif
 
+#if defined(CONFIG_NET_IPV4_FRAGMENT)
+	/* Same as above for a reassembled IPv4 packet, which keeps the
+	 * fragment flags of its first fragment.
+	 */
+	if (net_pkt_ipv4_fragment_more(pkt)) {
+		locally_routed = true;
+	}
+#endif
+
 	/* If there is no data, then drop the packet. */
 	if (!pkt->frags) {
 		NET_DBG("Corrupted packet (frags %p)", pkt->frags);
@@ -23,6 +23,7 @@ LOG_MODULE_REGISTER(net_if, CONFIG_NET_IF_LOG_LEVEL);
 #include <zephyr/net/virtual.h>
 
 #include "net_private.h"
+#include "ipv4.h"
 #include "ipv6.h"
 #include "ipv4_autoconf_internal.h"
 
@@ -440,8 +441,21 @@ enum net_verdict net_if_send_data(struct net_if *iface, struct net_pkt *pkt)
 	enum net_verdict verdict = NET_OK;
 	int status = -EIO;
 
+	/* IPv4 packets larger than the MTU are split into fragments, which
+	 * are sent separately through this function. This applies to the
+	 * loopback interface too. It is done before taking the lock, as
+	 * allocating the fragments may block.
+	 */
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
+		verdict = net_ipv4_prepare_for_send(pkt);
+	}
+
 	k_mutex_lock(&lock, K_FOREVER);
 
+	if (verdict != NET_OK) {
+		goto done;
+	}
+
 	if (!net_if_flag_is_set(iface, NET_IF_UP) ||
 	    net_if_flag_is_set(iface, NET_IF_SUSPENDED)) {
 		/* Drop packet if interface is not up */
@@ -3976,8 +3990,13 @@ void net_if_call_link_cb(struct net_if *iface, struct net_linkaddr *lladdr,
 	k_mutex_unlock(&lock);
 }
 
-static bool need_calc_checksum(struct net_if *iface, enum ethernet_hw_caps caps)
+static bool need_calc_checksum(struct net_if *iface, enum net_if_flag flag,
+			       enum ethernet_hw_caps caps)
 {
+	if (net_if_flag_is_set(iface, flag)) {
+		return false;
+	}
+
 #if defined(CONFIG_NET_L2_ETHERNET)
 	if (net_if_l2(iface) != &NET_L2_GET_NAME(ETHERNET)) {
 		return true;
@@ -3994,12 +4013,14 @@ static bool need_calc_checksum(struct net_if *iface, enum ethernet_hw_caps caps)
 
 bool net_if_need_calc_tx_checksum(struct net_if *iface)
 {
-	return need_calc_checksum(iface, ETHERNET_HW_TX_CHKSUM_OFFLOAD);
+	return need_calc_checksum(iface, NET_IF_TX_CHKSUM_OFFLOAD,
+				  ETHERNET_HW_TX_CHKSUM_OFFLOAD);
 }
 
 bool net_if_need_calc_rx_checksum(struct net_if *iface)
 {
-	return need_calc_checksum(iface, ETHERNET_HW_RX_CHKSUM_OFFLOAD);
+	return need_calc_checksum(iface, NET_IF_RX_CHKSUM_OFFLOAD,
+				  ETHERNET_HW_RX_CHKSUM_OFFLOAD);
 }
 
 int net_if_get_by_iface(struct net_if *iface)
@@ -144,6 +144,32 @@ extern char *net_sprint_ll_addr_buf(const uint8_t *ll, uint8_t ll_len,
 				    char *buf, int buflen);
 extern uint16_t net_calc_chksum(struct net_pkt *pkt, uint8_t proto);
 
+/**
+ * @brief Update an Internet checksum after a 16-bit field it covers has
+ *        been rewritten, without going over the data again (RFC 1624).
+ *
+ * @param chksum	Checksum field value
+ * @param old_val	Previous value of the rewritten field
+ * @param new_val	New value of the rewritten field
+ *
+ * All the values are taken as they are stored in the packet, so they are
+ * in network byte order. The caller must turn a result of 0 into 0xffff
+ * for UDP.
+ *
+ * @return Updated checksum field value
+ */
+static inline uint16_t net_chksum_update(uint16_t chksum, uint16_t old_val,
+					 uint16_t new_val)
+{
+	uint32_t sum;
+
+	sum = (uint16_t)~chksum + (uint32_t)(uint16_t)~old_val + new_val;
+	sum = (sum & 0xffff) + (sum >> 16);
+	sum = (sum & 0xffff) + (sum >> 16);
+
+	return ~sum;
+}
+
 /**
  * @brief Deliver the incoming packet through the recv_cb of the net_context
  *        to the upper layers
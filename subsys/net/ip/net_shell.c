@@ -38,6 +38,7 @@ LOG_MODULE_REGISTER(net_shell, LOG_LEVEL_DBG);
 #include <zephyr/sys/slist.h>
 #endif
 
+#include "ipv4.h"
 #include "ipv6.h"
 
 #if defined(CONFIG_NET_ARP)
@@ -287,7 +288,8 @@ static const char *iface_flags2str(struct net_if *iface)
 	static char str[sizeof("POINTOPOINT") + sizeof("PROMISC") +
 			sizeof("NO_AUTO_START") + sizeof("SUSPENDED") +
 			sizeof("MCAST_FORWARD") + sizeof("IPv4") +
-			sizeof("IPv6")];
+			sizeof("IPv6") + sizeof("TX_CHKSUM_OFFLOAD") +
+			sizeof("RX_CHKSUM_OFFLOAD")];
 	int pos = 0;
 
 	if (net_if_flag_is_set(iface, NET_IF_POINTOPOINT)) {
@@ -323,6 +325,16 @@ static const char *iface_flags2str(struct net_if *iface)
 				"IPv6,");
 	}
 
+	if (net_if_flag_is_set(iface, NET_IF_TX_CHKSUM_OFFLOAD)) {
+		pos += snprintk(str + pos, sizeof(str) - pos,
+				"TX_CHKSUM_OFFLOAD,");
+	}
+
+	if (net_if_flag_is_set(iface, NET_IF_RX_CHKSUM_OFFLOAD)) {
+		pos += snprintk(str + pos, sizeof(str) - pos,
+				"RX_CHKSUM_OFFLOAD,");
+	}
+
 	/* get rid of last ',' character */
 	str[pos - 1] = '\0';
 
@@ -1556,6 +1568,50 @@ static void tcp_sent_list_cb(struct tcp *conn, void *user_data)
 #endif /* CONFIG_NET_TCP_LOG_LEVEL >= LOG_LEVEL_DBG */
 #endif /* TCP */
 
+#if defined(CONFIG_NET_IPV4_FRAGMENT)
+static void ipv4_frag_cb(struct net_ipv4_reassembly *reass,
+			 void *user_data)
+{
+	struct net_shell_user_data *data = user_data;
+	const struct shell *shell = data->shell;
+	int *count = data->user_data;
+	char src[ADDR_LEN];
+	int i;
+
+	if (!*count) {
+		PR("\nIPv4 reassembly Id     Remain "
+		   "Src             \tDst\n");
+	}
+
+	snprintk(src, ADDR_LEN, "%s", net_sprint_ipv4_addr(&reass->src));
+
+	PR("%p      0x%04x  %5d %16s\t%16s\n", reass, reass->id,
+	   k_ticks_to_ms_ceil32(k_work_delayable_remaining_get(&reass->timer)),
+	   src, net_sprint_ipv4_addr(&reass->dst));
+
+	for (i = 0; i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT; i++) {
+		if (reass->pkt[i]) {
+			struct net_buf *frag = reass->pkt[i]->frags;
+
+			PR("[%d] pkt %p->", i, reass->pkt[i]);
+
+			while (frag) {
+				PR("%p", frag);
+
+				frag = frag->frags;
+				if (frag) {
+					PR("->");
+				}
+			}
+
+			PR("\n");
+		}
+	}
+
+	(*count)++;
+}
+#endif /* CONFIG_NET_IPV4_FRAGMENT */
+
 #if defined(CONFIG_NET_IPV6_FRAGMENT)
 static void ipv6_frag_cb(struct net_ipv6_reassembly *reass,
 			 void *user_data)
@@ -2066,6 +2122,15 @@ static int cmd_net_conn(const struct shell *shell, size_t argc, char *argv[])
 
 #endif
 
+#if defined(CONFIG_NET_IPV4_FRAGMENT)
+	count = 0;
+	user_data.user_data = &count;
+
+	net_ipv4_frag_foreach(ipv4_frag_cb, &user_data);
+
+	/* Do not print anything if no fragments are pending atm */
+#endif
+
 #if defined(CONFIG_NET_IPV6_FRAGMENT)
 	count = 0;
 
@@ -2225,6 +2290,47 @@ static int cmd_net_dns_cancel(const struct shell *shell, size_t argc,
 	return 0;
 }
 
+static int cmd_net_dns_cache(const struct shell *shell, size_t argc,
+			     char *argv[])
+{
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+	struct dns_resolve_cache_stats stats;
+	uint32_t lookups;
+
+	if (argv[1]) {
+		if (strcmp(argv[1], "flush") != 0) {
+			PR_WARNING("Unknown argument '%s'\n", argv[1]);
+			return -ENOEXEC;
+		}
+
+		dns_resolve_cache_flush();
+		PR("DNS cache flushed.\n");
+
+		return 0;
+	}
+
+	(void)dns_resolve_cache_stats_get(&stats);
+
+	lookups = stats.hits + stats.misses;
+
+	PR("Entries        : %u\n", stats.entries);
+	PR("Hits           : %u (%u negative)\n", stats.hits,
+	   stats.negative_hits);
+	PR("Misses         : %u (%u coalesced)\n", stats.misses,
+	   stats.coalesced);
+	PR("Hit rate       : %u%%\n",
+	   lookups ? (uint32_t)((uint64_t)stats.hits * 100U / lookups) : 0U);
+#else
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	PR_INFO("Set %s to enable %s support.\n", "CONFIG_DNS_RESOLVER_CACHE",
+		"DNS cache");
+#endif
+
+	return 0;
+}
+
 static int cmd_net_dns_query(const struct shell *shell, size_t argc,
 			     char *argv[])
 {
@@ -5690,6 +5796,10 @@ SHELL_STATIC_SUBCMD_SET_CREATE(net_cmd_capture,
 );
 
 SHELL_STATIC_SUBCMD_SET_CREATE(net_cmd_dns,
+	SHELL_CMD(cache, NULL,
+		  "'net dns cache' shows DNS cache statistics.\n"
+		  "'net dns cache flush' removes all cached answers.",
+		  cmd_net_dns_cache),
 	SHELL_CMD(cancel, NULL, "Cancel all pending requests.",
 		  cmd_net_dns_cancel),
 	SHELL_CMD(query, NULL,
@@ -487,37 +487,89 @@ int z_vrfy_net_addr_pton(sa_family_t family, const char *src,
 #include <syscalls/net_addr_pton_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
-static uint16_t calc_chksum(uint16_t sum, const uint8_t *data, size_t len)
+static inline uint16_t chksum_add(uint16_t sum, uint16_t val)
 {
-	const uint8_t *end;
-	uint16_t tmp;
+	uint32_t tmp = (uint32_t)sum + val;
 
-	end = data + len - 1;
+	return (tmp & 0xffff) + (tmp >> 16);
+}
 
-	while (data < end) {
-		tmp = (data[0] << 8) + data[1];
-		sum += tmp;
-		if (sum < tmp) {
-			sum++;
-		}
+/* One's complement sum of the data taken as 16-bit words in host byte
+ * order. Once the data is aligned, 32-bit words are accumulated into a
+ * 64-bit sum, whose carries are folded back at the end.
+ */
+static uint16_t calc_chksum_words(const uint8_t *data, size_t len)
+{
+	const uint32_t *words;
+	uint64_t sum = 0U;
+	uint16_t tmp = 0U;
+	bool odd = false;
+
+	if (len && ((uintptr_t)data & 1)) {
+		/* Sum the data from the preceding even address, with a zero
+		 * byte there, and swap the bytes of the result at the end.
+		 */
+		((uint8_t *)&tmp)[1] = *data++;
+		sum = tmp;
+		odd = true;
+		len--;
+	}
+
+	if (len >= 2 && ((uintptr_t)data & 2)) {
+		sum += *(const uint16_t *)data;
+		data += 2;
+		len -= 2;
+	}
+
+	words = (const uint32_t *)data;
+
+	while (len >= 4 * sizeof(uint32_t)) {
+		sum += (uint64_t)words[0] + words[1] + words[2] + words[3];
+		words += 4;
+		len -= 4 * sizeof(uint32_t);
+	}
+
+	while (len >= sizeof(uint32_t)) {
+		sum += *words++;
+		len -= sizeof(uint32_t);
+	}
+
+	data = (const uint8_t *)words;
 
+	if (len >= 2) {
+		sum += *(const uint16_t *)data;
 		data += 2;
+		len -= 2;
 	}
 
-	if (data == end) {
-		tmp = data[0] << 8;
+	if (len) {
+		tmp = 0U;
+		((uint8_t *)&tmp)[0] = *data;
 		sum += tmp;
-		if (sum < tmp) {
-			sum++;
-		}
+	}
+
+	sum = (sum & 0xffffffff) + (sum >> 32);
+	sum = (sum & 0xffffffff) + (sum >> 32);
+	sum = (sum & 0xffff) + (sum >> 16);
+	sum = (sum & 0xffff) + (sum >> 16);
+
+	if (odd) {
+		return __bswap_16((uint16_t)sum);
 	}
 
 	return sum;
 }
 
+static uint16_t calc_chksum(uint16_t sum, const uint8_t *data, size_t len)
+{
+	return chksum_add(sum, ntohs(calc_chksum_words(data, len)));
+}
+
 static inline uint16_t pkt_calc_chksum(struct net_pkt *pkt, uint16_t sum)
 {
 	struct net_pkt_cursor *cur = &pkt->cursor;
+	bool odd = false;
+	uint16_t tmp;
 	size_t len;
 
 	if (!cur->buf || !cur->pos) {
@@ -527,7 +579,17 @@ static inline uint16_t pkt_calc_chksum(struct net_pkt *pkt, uint16_t sum)
 	len = cur->buf->len - (cur->pos - cur->buf->data);
 
 	while (cur->buf) {
-		sum = calc_chksum(sum, cur->pos, len);
+		tmp = calc_chksum(0U, cur->pos, len);
+
+		/* The data of this buffer starts in the middle of a 16-bit
+		 * word if the previous buffers had an odd length.
+		 */
+		if (odd) {
+			tmp = __bswap_16(tmp);
+		}
+
+		sum = chksum_add(sum, tmp);
+		odd ^= len & 1;
 
 		cur->buf = cur->buf->frags;
 		if (!cur->buf || !cur->buf->len) {
@@ -535,18 +597,7 @@ static inline uint16_t pkt_calc_chksum(struct net_pkt *pkt, uint16_t sum)
 		}
 
 		cur->pos = cur->buf->data;
-
-		if (len % 2) {
-			sum += *cur->pos;
-			if (sum < *cur->pos) {
-				sum++;
-			}
-
-			cur->pos++;
-			len = cur->buf->len - 1;
-		} else {
-			len = cur->buf->len;
-		}
+		len = cur->buf->len;
 	}
 
 	return sum;
@@ -849,6 +849,22 @@ static bool is_request(const struct coap_packet *cpkt)
 	return !(code & ~COAP_REQUEST_MASK);
 }
 
+static int handle_resource(struct coap_resource *resource,
+			   struct coap_packet *cpkt,
+			   struct sockaddr *addr, socklen_t addr_len)
+{
+	coap_method_t method;
+	uint8_t code;
+
+	code = coap_header_get_code(cpkt);
+	method = method_from_code(resource, code);
+	if (!method) {
+		return -EPERM;
+	}
+
+	return method(resource, cpkt, addr, addr_len);
+}
+
 int coap_handle_request(struct coap_packet *cpkt,
 			struct coap_resource *resources,
 			struct coap_option *options,
@@ -863,26 +879,160 @@ int coap_handle_request(struct coap_packet *cpkt,
 
 	/* FIXME: deal with hierarchical resources */
 	for (resource = resources; resource && resource->path; resource++) {
-		coap_method_t method;
-		uint8_t code;
-
 		if (!uri_path_eq(cpkt, resource->path, options, opt_num)) {
 			continue;
 		}
 
-		code = coap_header_get_code(cpkt);
-		method = method_from_code(resource, code);
-		if (!method) {
-			return -EPERM;
-		}
-
-		return method(resource, cpkt, addr, addr_len);
+		return handle_resource(resource, cpkt, addr, addr_len);
 	}
 
 	NET_DBG("%d", __LINE__);
 	return -ENOENT;
 }
 
+/* FNV-1a, with the length of each path segment hashed before its value so
+ * that e.g. "a/bc" and "ab/c" give different hashes.
+ */
+#define PATH_HASH_INIT 2166136261U
+#define PATH_HASH_PRIME 16777619U
+
+static uint32_t path_hash_update(uint32_t hash, const uint8_t *seg,
+				 size_t len)
+{
+	size_t i;
+
+	hash = (hash ^ (uint8_t)len) * PATH_HASH_PRIME;
+
+	for (i = 0; i < len; i++) {
+		hash = (hash ^ seg[i]) * PATH_HASH_PRIME;
+	}
+
+	return hash;
+}
+
+static bool path_has_wildcard(const char * const *path)
+{
+	if (!IS_ENABLED(CONFIG_COAP_URI_WILDCARD)) {
+		return false;
+	}
+
+	for (; *path; path++) {
+		if (!strcmp(*path, "+") || !strcmp(*path, "#")) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+int coap_resource_index_init(struct coap_resource_index *index,
+			     struct coap_resource *resources)
+{
+	uint16_t count = 0U;
+	uint16_t i;
+
+	for (; resources && resources[count].path; count++) {
+		if (count == index->max_resources) {
+			return -ENOMEM;
+		}
+	}
+
+	index->resources = resources;
+	index->wildcards = 0U;
+	(void)memset(index->buckets, 0,
+		     index->num_buckets * sizeof(index->buckets[0]));
+
+	/* Insert the resources backwards, at the head of their list, so
+	 * that each list has them in the same order as the array. Resources
+	 * with wildcards in their path cannot be hashed, they are kept in a
+	 * list of their own.
+	 */
+	for (i = count; i > 0; i--) {
+		const char * const *path = resources[i - 1].path;
+		uint32_t hash = PATH_HASH_INIT;
+		uint16_t *head;
+
+		if (path_has_wildcard(path)) {
+			head = &index->wildcards;
+		} else {
+			for (; *path; path++) {
+				hash = path_hash_update(hash,
+							(const uint8_t *)*path,
+							strlen(*path));
+			}
+
+			head = &index->buckets[hash % index->num_buckets];
+		}
+
+		index->next[i - 1] = *head;
+		*head = i;
+	}
+
+	return 0;
+}
+
+struct coap_resource *coap_resource_index_find(
+	const struct coap_resource_index *index,
+	const struct coap_packet *cpkt,
+	struct coap_option *options, uint8_t opt_num)
+{
+	uint32_t hash = PATH_HASH_INIT;
+	uint16_t found = 0U;
+	uint16_t i;
+	uint8_t j;
+
+	for (j = 0U; j < opt_num; j++) {
+		if (options[j].delta == COAP_OPTION_URI_PATH) {
+			hash = path_hash_update(hash, options[j].value,
+						options[j].len);
+		}
+	}
+
+	for (i = index->buckets[hash % index->num_buckets]; i;
+	     i = index->next[i - 1]) {
+		if (uri_path_eq(cpkt, index->resources[i - 1].path,
+				options, opt_num)) {
+			found = i;
+			break;
+		}
+	}
+
+	/* A resource with wildcards that comes first in the array takes
+	 * precedence, as with coap_handle_request().
+	 */
+	for (i = index->wildcards; i && (!found || i < found);
+	     i = index->next[i - 1]) {
+		if (uri_path_eq(cpkt, index->resources[i - 1].path,
+				options, opt_num)) {
+			found = i;
+			break;
+		}
+	}
+
+	return found ? &index->resources[found - 1] : NULL;
+}
+
+int coap_handle_request_index(struct coap_packet *cpkt,
+			      const struct coap_resource_index *index,
+			      struct coap_option *options,
+			      uint8_t opt_num,
+			      struct sockaddr *addr, socklen_t addr_len)
+{
+	struct coap_resource *resource;
+
+	if (!is_request(cpkt)) {
+		return 0;
+	}
+
+	resource = coap_resource_index_find(index, cpkt, options, opt_num);
+	if (!resource) {
+		NET_DBG("%d", __LINE__);
+		return -ENOENT;
+	}
+
+	return handle_resource(resource, cpkt, addr, addr_len);
+}
+
 int coap_block_transfer_init(struct coap_block_context *ctx,
 			      enum coap_block_size block_size,
 			      size_t total_size)
@@ -1489,6 +1639,27 @@ struct coap_observer *coap_find_observer_by_addr(
 	return NULL;
 }
 
+struct coap_observer *coap_resource_find_observer(
+	struct coap_resource *resource, const struct sockaddr *addr,
+	const uint8_t *token, uint8_t tkl)
+{
+	struct coap_observer *o;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&resource->observers, o, list) {
+		if (!sockaddr_equal(&o->addr, addr)) {
+			continue;
+		}
+
+		if (token && (o->tkl != tkl || memcmp(o->token, token, tkl))) {
+			continue;
+		}
+
+		return o;
+	}
+
+	return NULL;
+}
+
 /**
  * @brief Internal initialization function for CoAP library.
  *
@@ -0,0 +1,247 @@
+/** @file
+ * @brief DNS answer cache
+ *
+ * Positive and negative answers received by the DNS resolver, kept until
+ * their time to live expires.
+ */
+
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_dns_resolve, CONFIG_DNS_RESOLVER_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <string.h>
+#include <errno.h>
+
+#include <zephyr/net/dns_resolve.h>
+#include "dns_cache.h"
+
+#define DNS_CACHE_ENTRIES	CONFIG_DNS_RESOLVER_CACHE_MAX_ENTRIES
+#define DNS_CACHE_NAME_LEN	CONFIG_DNS_RESOLVER_CACHE_MAX_NAME_LEN
+
+struct dns_cache_entry {
+	/** Answer address, unused for a negative answer */
+	struct dns_addrinfo info;
+
+	/** Uptime in ms at which the entry expires */
+	int64_t expiry;
+
+	/** Name that was queried */
+	char query[DNS_CACHE_NAME_LEN + 1];
+
+	/** Query type */
+	enum dns_query_type query_type;
+
+	/** 0 for an address, DNS_EAI_* status of a negative answer */
+	int status;
+
+	/** Is this entry in use */
+	bool in_use;
+};
+
+static struct dns_cache_entry dns_cache[DNS_CACHE_ENTRIES];
+static struct dns_resolve_cache_stats dns_cache_stats;
+static K_MUTEX_DEFINE(dns_cache_lock);
+
+/* Must be invoked with cache lock held */
+static bool entry_matches(struct dns_cache_entry *entry, const char *query,
+			  enum dns_query_type type, int64_t now)
+{
+	if (!entry->in_use) {
+		return false;
+	}
+
+	if (entry->expiry <= now) {
+		entry->in_use = false;
+		return false;
+	}
+
+	return entry->query_type == type && strcmp(entry->query, query) == 0;
+}
+
+/* Must be invoked with cache lock held */
+static struct dns_cache_entry *entry_alloc(const char *query,
+					   enum dns_query_type type,
+					   int status, uint32_t ttl)
+{
+	struct dns_cache_entry *entry = NULL;
+	int i;
+
+	/* Take a free entry if any, else the one that expires first */
+	for (i = 0; i < DNS_CACHE_ENTRIES; i++) {
+		if (!dns_cache[i].in_use) {
+			entry = &dns_cache[i];
+			break;
+		}
+
+		if (entry == NULL || dns_cache[i].expiry < entry->expiry) {
+			entry = &dns_cache[i];
+		}
+	}
+
+	(void)memset(entry, 0, sizeof(*entry));
+	strcpy(entry->query, query);
+	entry->query_type = type;
+	entry->status = status;
+	entry->expiry = k_uptime_get() + (int64_t)ttl * MSEC_PER_SEC;
+	entry->in_use = true;
+
+	return entry;
+}
+
+int dns_cache_find(const char *query, enum dns_query_type type,
+		   struct dns_addrinfo *info, int info_len, int *status)
+{
+	int64_t now = k_uptime_get();
+	int count = 0;
+	int ret = -ENOENT;
+	int i;
+
+	k_mutex_lock(&dns_cache_lock, K_FOREVER);
+
+	for (i = 0; i < DNS_CACHE_ENTRIES; i++) {
+		if (!entry_matches(&dns_cache[i], query, type, now)) {
+			continue;
+		}
+
+		if (dns_cache[i].status != 0) {
+			*status = dns_cache[i].status;
+			dns_cache_stats.negative_hits++;
+			ret = 0;
+			break;
+		}
+
+		if (count < info_len) {
+			info[count++] = dns_cache[i].info;
+		}
+
+		*status = DNS_EAI_ALLDONE;
+		ret = count;
+	}
+
+	if (ret < 0) {
+		dns_cache_stats.misses++;
+	} else {
+		dns_cache_stats.hits++;
+	}
+
+	k_mutex_unlock(&dns_cache_lock);
+
+	NET_DBG("%s %s type %d", ret < 0 ? "Miss" : "Hit", log_strdup(query),
+		type);
+
+	return ret;
+}
+
+void dns_cache_add(const char *query, enum dns_query_type type,
+		   const struct dns_addrinfo *info, uint32_t ttl)
+{
+	int64_t now = k_uptime_get();
+	struct dns_cache_entry *entry;
+	int i;
+
+	if (ttl == 0U || strlen(query) > DNS_CACHE_NAME_LEN) {
+		return;
+	}
+
+	k_mutex_lock(&dns_cache_lock, K_FOREVER);
+
+	for (i = 0; i < DNS_CACHE_ENTRIES; i++) {
+		entry = &dns_cache[i];
+
+		if (!entry_matches(entry, query, type, now)) {
+			continue;
+		}
+
+		/* An address replaces a negative answer, and refreshes a
+		 * cached copy of itself.
+		 */
+		if (entry->status != 0 ||
+		    (entry->info.ai_addrlen == info->ai_addrlen &&
+		     memcmp(&entry->info.ai_addr, &info->ai_addr,
+			    info->ai_addrlen) == 0)) {
+			entry->in_use = false;
+		}
+	}
+
+	entry = entry_alloc(query, type, 0, ttl);
+	entry->info = *info;
+
+	k_mutex_unlock(&dns_cache_lock);
+}
+
+void dns_cache_add_negative(const char *query, enum dns_query_type type,
+			    int status)
+{
+	if (CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL == 0 ||
+	    strlen(query) > DNS_CACHE_NAME_LEN) {
+		return;
+	}
+
+	dns_cache_remove(query, type);
+
+	k_mutex_lock(&dns_cache_lock, K_FOREVER);
+	(void)entry_alloc(query, type, status,
+			  CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL);
+	k_mutex_unlock(&dns_cache_lock);
+}
+
+void dns_cache_remove(const char *query, enum dns_query_type type)
+{
+	int64_t now = k_uptime_get();
+	int i;
+
+	k_mutex_lock(&dns_cache_lock, K_FOREVER);
+
+	for (i = 0; i < DNS_CACHE_ENTRIES; i++) {
+		if (entry_matches(&dns_cache[i], query, type, now)) {
+			dns_cache[i].in_use = false;
+		}
+	}
+
+	k_mutex_unlock(&dns_cache_lock);
+}
+
+void dns_cache_coalesced(void)
+{
+	k_mutex_lock(&dns_cache_lock, K_FOREVER);
+	dns_cache_stats.coalesced++;
+	k_mutex_unlock(&dns_cache_lock);
+}
+
+void dns_resolve_cache_flush(void)
+{
+	k_mutex_lock(&dns_cache_lock, K_FOREVER);
+	(void)memset(dns_cache, 0, sizeof(dns_cache));
+	k_mutex_unlock(&dns_cache_lock);
+}
+
+int dns_resolve_cache_stats_get(struct dns_resolve_cache_stats *stats)
+{
+	int64_t now = k_uptime_get();
+	int i;
+
+	if (!stats) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&dns_cache_lock, K_FOREVER);
+
+	*stats = dns_cache_stats;
+	stats->entries = 0U;
+
+	for (i = 0; i < DNS_CACHE_ENTRIES; i++) {
+		if (dns_cache[i].in_use && dns_cache[i].expiry > now) {
+			stats->entries++;
+		}
+	}
+
+	k_mutex_unlock(&dns_cache_lock);
+
+	return 0;
+}
@@ -0,0 +1,69 @@
+/** @file
+ * @brief DNS answer cache
+ *
+ * Internal API of the DNS resolver answer cache.
+ */
+
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef __DNS_CACHE_H
+#define __DNS_CACHE_H
+
+#include <zephyr/types.h>
+#include <zephyr/net/dns_resolve.h>
+
+/**
+ * @brief Look up the answer to a query in the cache.
+ *
+ * @param query Name that was queried.
+ * @param type Query type.
+ * @param info Array where the cached addresses are copied.
+ * @param info_len Number of elements in the info array.
+ * @param status Set to DNS_EAI_ALLDONE if addresses are found, or to the
+ *        status of a cached negative answer.
+ *
+ * @return Number of addresses copied to info, or -ENOENT if there is no
+ *         answer in the cache.
+ */
+int dns_cache_find(const char *query, enum dns_query_type type,
+		   struct dns_addrinfo *info, int info_len, int *status);
+
+/**
+ * @brief Add an address to the answer of a query.
+ *
+ * @param query Name that was queried.
+ * @param type Query type.
+ * @param info Address of the answer.
+ * @param ttl Time to live of the address, in seconds.
+ */
+void dns_cache_add(const char *query, enum dns_query_type type,
+		   const struct dns_addrinfo *info, uint32_t ttl);
+
+/**
+ * @brief Record that a query has no answer.
+ *
+ * @param query Name that was queried.
+ * @param type Query type.
+ * @param status Status returned for the query, e.g. DNS_EAI_NODATA.
+ */
+void dns_cache_add_negative(const char *query, enum dns_query_type type,
+			    int status);
+
+/**
+ * @brief Remove the answer to a query from the cache.
+ *
+ * @param query Name that was queried.
+ * @param type Query type.
+ */
+void dns_cache_remove(const char *query, enum dns_query_type type);
+
+/**
+ * @brief Count a query that was coalesced with an identical pending one.
+ */
+void dns_cache_coalesced(void);
+
+#endif /* __DNS_CACHE_H */
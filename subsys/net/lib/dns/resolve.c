@@ -26,6 +26,7 @@ LOG_MODULE_REGISTER(net_dns_resolve, CONFIG_DNS_RESOLVER_LOG_LEVEL);
 #include <zephyr/net/dns_resolve.h>
 #include "dns_pack.h"
 #include "dns_internal.h"
+#include "dns_cache.h"
 
 #define DNS_SERVER_COUNT CONFIG_DNS_RESOLVER_MAX_SERVERS
 #define SERVER_COUNT     (DNS_SERVER_COUNT + DNS_MAX_MCAST_SERVERS)
@@ -416,6 +417,18 @@ static inline void invoke_query_callback(int status,
 	if (pending_query->query != NULL)  {
 		pending_query->cb(status, info, pending_query->user_data);
 	}
+
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+	/* Queries coalesced with this one get the same results */
+	for (int i = 0; i < CONFIG_DNS_NUM_CONCUR_QUERIES; i++) {
+		struct dns_pending_query *query =
+			&pending_query->ctx->queries[i];
+
+		if (query->leader == pending_query && query->query != NULL) {
+			query->cb(status, info, query->user_data);
+		}
+	}
+#endif
 }
 
 /* Release a query slot reserved by get_cb_slot().
@@ -426,7 +439,24 @@ static inline void invoke_query_callback(int status,
  */
 static void release_query(struct dns_pending_query *pending_query)
 {
-	int busy = k_work_cancel_delayable(&pending_query->timer);
+	int busy;
+
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+	/* Queries coalesced with this one are done as well */
+	for (int i = 0; i < CONFIG_DNS_NUM_CONCUR_QUERIES; i++) {
+		struct dns_pending_query *query =
+			&pending_query->ctx->queries[i];
+
+		if (query->leader == pending_query) {
+			query->leader = NULL;
+			release_query(query);
+		}
+	}
+
+	pending_query->leader = NULL;
+#endif
+
+	busy = k_work_cancel_delayable(&pending_query->timer);
 
 	/* If the work item is no longer pending we're done. */
 	if (busy == 0) {
@@ -473,6 +503,7 @@ int dns_validate_msg(struct dns_resolve_context *ctx,
 {
 	struct dns_addrinfo info = { 0 };
 	uint32_t ttl; /* RR ttl, so far it is not passed to caller */
+	uint32_t min_ttl = UINT32_MAX; /* lowest ttl of the CNAME chain */
 	uint8_t *src, *addr;
 	const char *query_name;
 	int address_size;
@@ -556,6 +587,8 @@ int dns_validate_msg(struct dns_resolve_context *ctx,
 			goto quit;
 		}
 
+		min_ttl = MIN(min_ttl, ttl);
+
 		switch (dns_msg->response_type) {
 		case DNS_RESPONSE_IP:
 			if (*query_idx >= 0) {
@@ -633,6 +666,17 @@ query_known:
 			src = dns_msg->msg + dns_msg->response_position;
 			memcpy(addr, src, address_size);
 
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+			/* The address is valid as long as the CNAME records
+			 * leading to it are.
+			 */
+			if (ctx->queries[*query_idx].query != NULL) {
+				dns_cache_add(ctx->queries[*query_idx].query,
+					      ctx->queries[*query_idx].query_type,
+					      &info, min_ttl);
+			}
+#endif
+
 			invoke_query_callback(DNS_EAI_INPROGRESS, &info,
 					      &ctx->queries[*query_idx]);
 			items++;
@@ -852,6 +896,13 @@ quit:
 		goto free_buf;
 	}
 
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+	if (ret == DNS_EAI_NODATA && ctx->queries[i].query != NULL) {
+		dns_cache_add_negative(ctx->queries[i].query,
+				       ctx->queries[i].query_type, ret);
+	}
+#endif
+
 	invoke_query_callback(ret, NULL, &ctx->queries[i]);
 
 	/* Marks the end of the results */
@@ -1104,6 +1155,39 @@ static void query_timeout(struct k_work *work)
 	k_mutex_unlock(&pending_query->ctx->lock);
 }
 
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+/* Answer the query from the cache. This is done without holding the
+ * context lock, so that the callback can start another query.
+ */
+static int dns_resolve_cached(const char *query,
+			      enum dns_query_type type,
+			      uint16_t *dns_id,
+			      dns_resolve_cb_t cb,
+			      void *user_data)
+{
+	struct dns_addrinfo info[CONFIG_DNS_RESOLVER_AI_MAX_ENTRIES];
+	int status;
+	int ret, i;
+
+	ret = dns_cache_find(query, type, info, ARRAY_SIZE(info), &status);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (dns_id) {
+		*dns_id = 0U;
+	}
+
+	for (i = 0; i < ret; i++) {
+		cb(DNS_EAI_INPROGRESS, &info[i], user_data);
+	}
+
+	cb(status, NULL, user_data);
+
+	return 0;
+}
+#endif
+
 int dns_resolve_name(struct dns_resolve_context *ctx,
 		     const char *query,
 		     enum dns_query_type type,
@@ -1181,6 +1265,12 @@ int dns_resolve_name(struct dns_resolve_context *ctx,
 	}
 
 try_resolve:
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+	if (dns_resolve_cached(query, type, dns_id, cb, user_data) == 0) {
+		return 0;
+	}
+#endif
+
 	k_mutex_lock(&ctx->lock, K_FOREVER);
 
 	if (ctx->state != DNS_RESOLVE_CONTEXT_ACTIVE) {
@@ -1204,6 +1294,39 @@ try_resolve:
 
 	k_work_init_delayable(&ctx->queries[i].timer, query_timeout);
 
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+	ctx->queries[i].leader = NULL;
+
+	/* If the same name is being resolved already, let that query pass
+	 * its results to this one instead of sending the query again.
+	 */
+	for (j = 0; j < CONFIG_DNS_NUM_CONCUR_QUERIES; j++) {
+		struct dns_pending_query *pending = &ctx->queries[j];
+
+		if (j == i || !check_query_active(pending, false) ||
+		    pending->query == NULL || pending->leader != NULL ||
+		    pending->query_type != type ||
+		    strcmp(pending->query, query) != 0) {
+			continue;
+		}
+
+		ctx->queries[i].leader = pending;
+		ctx->queries[i].id = sys_rand32_get();
+
+		if (dns_id) {
+			*dns_id = ctx->queries[i].id;
+		}
+
+		ret = k_work_reschedule(&ctx->queries[i].timer, tout);
+		if (ret >= 0) {
+			dns_cache_coalesced();
+			ret = 0;
+		}
+
+		goto quit;
+	}
+#endif
+
 	dns_data = net_buf_alloc(&dns_msg_pool, ctx->buf_timeout);
 	if (!dns_data) {
 		ret = -ENOMEM;
@@ -93,6 +93,7 @@ struct observe_node {
 	bool resource_update : 1;	/* Resource is updated */
 	bool composite : 1;		/* Composite Observation */
 	bool active_tx_operation : 1;	/* Active Notification  process ongoing */
+	bool batched : 1;		/* Reported by the pending Send operation */
 };
 
 struct notification_attrs {
@@ -114,6 +115,21 @@ static struct lwm2m_obj_path_list observe_paths[LWM2M_ENGINE_MAX_OBSERVER_PATH];
 static sys_slist_t obs_obj_path_list;
 static struct observe_node observe_node_data[CONFIG_LWM2M_ENGINE_MAX_OBSERVER];
 
+/* Observation paths of resources and resource instances, one entry per
+ * element of observe_paths, hashed on their object, instance and resource
+ * IDs so that the observers of an updated resource are found directly.
+ */
+struct observe_index_entry {
+	sys_snode_t node;
+	struct observe_node *obs;
+	struct lwm2m_ctx *ctx;
+};
+
+#define LOOKUP_TABLE_SIZE CONFIG_LWM2M_ENGINE_LOOKUP_TABLE_SIZE
+
+static struct observe_index_entry observe_index_entries[LWM2M_ENGINE_MAX_OBSERVER_PATH];
+static sys_slist_t observe_index[LOOKUP_TABLE_SIZE];
+
 #define MAX_PERIODIC_SERVICE	10
 
 struct service_node {
@@ -129,6 +145,17 @@ static sys_slist_t engine_obj_list;
 static sys_slist_t engine_obj_inst_list;
 static sys_slist_t engine_service_list;
 
+/* Lookup tables of the objects and object instances, by ID */
+static sys_slist_t engine_obj_table[LOOKUP_TABLE_SIZE];
+static sys_slist_t engine_obj_inst_table[LOOKUP_TABLE_SIZE];
+
+static inline uint32_t lookup_hash(uint16_t obj_id, uint16_t obj_inst_id,
+				   uint16_t res_id)
+{
+	return ((obj_id * 31U + obj_inst_id) * 31U + res_id) %
+	       LOOKUP_TABLE_SIZE;
+}
+
 #define LWM2M_DP_CLIENT_URI "dp"
 
 static K_KERNEL_STACK_DEFINE(engine_thread_stack,
@@ -177,6 +204,10 @@ static int do_composite_observe_read_path_op(struct lwm2m_message *msg, uint16_t
 					     sys_slist_t *lwm2m_path_list,
 					     sys_slist_t *lwm2m_path_free_list);
 static void lwm2m_engine_free_list(sys_slist_t *path_list, sys_slist_t *free_list);
+#if defined(CONFIG_LWM2M_SERVER_OBJECT_VERSION_1_1)
+static int engine_send_path_list(struct lwm2m_ctx *ctx, sys_slist_t *lwm2m_path_list,
+				 bool confirmation_request);
+#endif
 
 /* for debugging: to print IP addresses */
 char *lwm2m_sprint_ip_addr(const struct sockaddr *addr)
@@ -382,7 +413,8 @@ static void clear_attrs(void *ref)
 	}
 }
 
-static bool lwm2m_observer_path_compare(struct lwm2m_obj_path *o_p, struct lwm2m_obj_path *p)
+static bool lwm2m_observer_path_compare(const struct lwm2m_obj_path *o_p,
+					const struct lwm2m_obj_path *p)
 {
 	/* updated path is deeper than obs node, skip */
 	if (p->level > o_p->level) {
@@ -585,10 +617,40 @@ int engine_observe_attribute_list_get(sys_slist_t *path_list, struct notificatio
 	return 0;
 }
 
-int lwm2m_notify_observer_path(struct lwm2m_obj_path *path)
+/* Hold a notification for the batching window, but never past pmax */
+static int64_t engine_observe_notify_window(const struct observe_node *obs,
+					    const struct notification_attrs *attrs,
+					    int64_t timestamp)
+{
+	int64_t window_end;
+	int64_t pmax_end;
+
+	if (CONFIG_LWM2M_ENGINE_NOTIFY_WINDOW == 0) {
+		return timestamp;
+	}
+
+	window_end = k_uptime_get() + CONFIG_LWM2M_ENGINE_NOTIFY_WINDOW;
+	if (timestamp >= window_end) {
+		return timestamp;
+	}
+
+	if (attrs->pmax) {
+		pmax_end = obs->last_timestamp + (int64_t)MSEC_PER_SEC * attrs->pmax;
+		if (pmax_end < window_end) {
+			return MAX(timestamp, pmax_end);
+		}
+	}
+
+	return window_end;
+}
+
+int lwm2m_notify_observer_path(const struct lwm2m_obj_path *path)
 {
+	struct observe_index_entry *entry;
 	struct observe_node *obs;
 	struct notification_attrs nattrs = { 0 };
+	bool notified[CONFIG_LWM2M_ENGINE_MAX_OBSERVER] = { 0 };
+	sys_slist_t *bucket;
 	int64_t timestamp;
 	int ret = 0;
 	int i;
@@ -598,40 +660,82 @@ int lwm2m_notify_observer_path(struct lwm2m_obj_path *path)
 	}
 
 	/* look for observers which match our resource */
-	for (i = 0; i < sock_nfds; ++i) {
-		SYS_SLIST_FOR_EACH_CONTAINER(&sock_ctx[i]->observer, obs, node) {
-			if (lwm2m_notify_observer_list(&obs->path_list, path)) {
-				/* update the event time for this observer */
-				ret = engine_observe_attribute_list_get(&obs->path_list, &nattrs,
-								    sock_ctx[i]->srv_obj_inst);
-				if (ret < 0) {
-					return ret;
-				}
+	bucket = &observe_index[lookup_hash(path->obj_id, path->obj_inst_id,
+					    path->res_id)];
 
-				if (nattrs.pmin) {
-					timestamp =
-						obs->last_timestamp + MSEC_PER_SEC * nattrs.pmin;
-				} else {
-					/* Trig immediately */
-					timestamp = k_uptime_get();
-				}
+	SYS_SLIST_FOR_EACH_CONTAINER(bucket, entry, node) {
+		i = entry - observe_index_entries;
+		obs = entry->obs;
 
-				if (!obs->event_timestamp || obs->event_timestamp > timestamp) {
-					obs->resource_update = true;
-					obs->event_timestamp = timestamp;
-				}
+		/* a composite observation may have several matching paths */
+		if (notified[obs - observe_node_data] ||
+		    !lwm2m_observer_path_compare(&observe_paths[i].path, path)) {
+			continue;
+		}
 
-				LOG_DBG("NOTIFY EVENT %u/%u/%u", path->obj_id, path->obj_inst_id,
-					path->res_id);
-				ret++;
-			}
+		notified[obs - observe_node_data] = true;
+
+		/* update the event time for this observer */
+		ret = engine_observe_attribute_list_get(&obs->path_list, &nattrs,
+							entry->ctx->srv_obj_inst);
+		if (ret < 0) {
+			return ret;
+		}
+
+		if (nattrs.pmin) {
+			timestamp = obs->last_timestamp + MSEC_PER_SEC * nattrs.pmin;
+		} else {
+			/* Trig immediately */
+			timestamp = k_uptime_get();
+		}
+
+		timestamp = engine_observe_notify_window(obs, &nattrs, timestamp);
+
+		if (!obs->event_timestamp || obs->event_timestamp > timestamp) {
+			obs->resource_update = true;
+			obs->event_timestamp = timestamp;
 		}
+
+		LOG_DBG("NOTIFY EVENT %u/%u/%u", path->obj_id, path->obj_inst_id,
+			path->res_id);
+		ret++;
 	}
 
 	return ret;
 
 }
 
+static void observe_index_add(struct lwm2m_ctx *ctx, struct observe_node *obs,
+			      struct lwm2m_obj_path_list *o_p)
+{
+	struct observe_index_entry *entry;
+
+	/* only updates of resources are notified */
+	if (o_p->path.level < LWM2M_PATH_LEVEL_RESOURCE) {
+		return;
+	}
+
+	entry = &observe_index_entries[o_p - observe_paths];
+	entry->obs = obs;
+	entry->ctx = ctx;
+	sys_slist_append(&observe_index[lookup_hash(o_p->path.obj_id,
+						    o_p->path.obj_inst_id,
+						    o_p->path.res_id)],
+			 &entry->node);
+}
+
+static void observe_index_remove(struct lwm2m_obj_path_list *o_p)
+{
+	if (o_p->path.level < LWM2M_PATH_LEVEL_RESOURCE) {
+		return;
+	}
+
+	sys_slist_find_and_remove(&observe_index[lookup_hash(o_p->path.obj_id,
+							     o_p->path.obj_inst_id,
+							     o_p->path.res_id)],
+				  &observe_index_entries[o_p - observe_paths].node);
+}
+
 static struct observe_node *engine_allocate_observer(sys_slist_t *path_list, bool composite)
 {
 	int i;
@@ -699,6 +803,8 @@ static void engine_observe_node_init(struct observe_node *obs, const uint8_t *to
 		LOG_DBG("OBSERVER ADDED %u/%u/%u/%u(%u)", tmp->path.obj_id, tmp->path.obj_inst_id,
 			tmp->path.res_id, tmp->path.res_inst_id, tmp->path.level);
 
+		observe_index_add(ctx, obs, tmp);
+
 		if (ctx->observe_cb) {
 			ctx->observe_cb(LWM2M_OBSERVE_EVENT_OBSERVER_ADDED, &tmp->path, NULL);
 		}
@@ -717,6 +823,8 @@ static void remove_observer_path_from_list(struct lwm2m_ctx *ctx, struct observe
 	if (ctx->observe_cb) {
 		ctx->observe_cb(LWM2M_OBSERVE_EVENT_OBSERVER_REMOVED, &o_p->path, NULL);
 	}
+	observe_index_remove(o_p);
+
 	/* Remove from the list and add to free list */
 	sys_slist_remove(&obs->path_list, prev_node, &o_p->node);
 	sys_slist_append(&obs_obj_path_list, &o_p->node);
@@ -1087,19 +1195,24 @@ static void engine_remove_observer_by_id(uint16_t obj_id, int32_t obj_inst_id)
 void lwm2m_register_obj(struct lwm2m_engine_obj *obj)
 {
 	sys_slist_append(&engine_obj_list, &obj->node);
+	sys_slist_append(&engine_obj_table[lookup_hash(obj->obj_id, 0, 0)],
+			 &obj->lookup_node);
 }
 
 void lwm2m_unregister_obj(struct lwm2m_engine_obj *obj)
 {
 	engine_remove_observer_by_id(obj->obj_id, -1);
 	sys_slist_find_and_remove(&engine_obj_list, &obj->node);
+	sys_slist_find_and_remove(&engine_obj_table[lookup_hash(obj->obj_id, 0, 0)],
+				  &obj->lookup_node);
 }
 
 static struct lwm2m_engine_obj *get_engine_obj(int obj_id)
 {
 	struct lwm2m_engine_obj *obj;
 
-	SYS_SLIST_FOR_EACH_CONTAINER(&engine_obj_list, obj, node) {
+	SYS_SLIST_FOR_EACH_CONTAINER(&engine_obj_table[lookup_hash(obj_id, 0, 0)],
+				     obj, lookup_node) {
 		if (obj->obj_id == obj_id) {
 			return obj;
 		}
@@ -1126,9 +1239,17 @@ lwm2m_get_engine_obj_field(struct lwm2m_engine_obj *obj, int res_id)
 
 /* engine object instance */
 
+static inline sys_slist_t *obj_inst_bucket(int obj_id, int obj_inst_id)
+{
+	return &engine_obj_inst_table[lookup_hash(obj_id, obj_inst_id, 0)];
+}
+
 static void engine_register_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
 {
 	sys_slist_append(&engine_obj_inst_list, &obj_inst->node);
+	sys_slist_append(obj_inst_bucket(obj_inst->obj->obj_id,
+					 obj_inst->obj_inst_id),
+			 &obj_inst->lookup_node);
 }
 
 static void engine_unregister_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
@@ -1136,6 +1257,9 @@ static void engine_unregister_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
 	engine_remove_observer_by_id(
 			obj_inst->obj->obj_id, obj_inst->obj_inst_id);
 	sys_slist_find_and_remove(&engine_obj_inst_list, &obj_inst->node);
+	sys_slist_find_and_remove(obj_inst_bucket(obj_inst->obj->obj_id,
+						  obj_inst->obj_inst_id),
+				  &obj_inst->lookup_node);
 }
 
 static struct lwm2m_engine_obj_inst *get_engine_obj_inst(int obj_id,
@@ -1143,8 +1267,8 @@ static struct lwm2m_engine_obj_inst *get_engine_obj_inst(int obj_id,
 {
 	struct lwm2m_engine_obj_inst *obj_inst;
 
-	SYS_SLIST_FOR_EACH_CONTAINER(&engine_obj_inst_list, obj_inst,
-				     node) {
+	SYS_SLIST_FOR_EACH_CONTAINER(obj_inst_bucket(obj_id, obj_inst_id),
+				     obj_inst, lookup_node) {
 		if (obj_inst->obj->obj_id == obj_id &&
 		    obj_inst->obj_inst_id == obj_inst_id) {
 			return obj_inst;
@@ -1792,10 +1916,17 @@ static int path_to_objs(const struct lwm2m_obj_path *path,
 		return -ENOENT;
 	}
 
-	for (i = 0; i < oi->resource_count; i++) {
+	/* Objects usually initialize their resources in the order of their
+	 * fields, try the resource at the position of the field first.
+	 */
+	i = of - oi->obj->fields;
+	if (i < oi->resource_count && oi->resources[i].res_id == path->res_id) {
+		r = &oi->resources[i];
+	}
+
+	for (i = 0; !r && i < oi->resource_count; i++) {
 		if (oi->resources[i].res_id == path->res_id) {
 			r = &oi->resources[i];
-			break;
 		}
 	}
 
@@ -1963,9 +2094,8 @@ int lwm2m_engine_set_res_data(const char *pathstr, void *data_ptr, uint16_t data
 	return ret;
 }
 
-static int lwm2m_engine_set(const char *pathstr, void *value, uint16_t len)
+static int engine_set(const struct lwm2m_obj_path *path, void *value, uint16_t len)
 {
-	struct lwm2m_obj_path path;
 	struct lwm2m_engine_obj_inst *obj_inst;
 	struct lwm2m_engine_obj_field *obj_field;
 	struct lwm2m_engine_res *res = NULL;
@@ -1975,34 +2105,30 @@ static int lwm2m_engine_set(const char *pathstr, void *value, uint16_t len)
 	int ret = 0;
 	bool changed = false;
 
-	LOG_DBG("path:%s, value:%p, len:%d", log_strdup(pathstr), value, len);
-
-	/* translate path -> path_obj */
-	ret = lwm2m_string_to_path(pathstr, &path, '/');
-	if (ret < 0) {
-		return ret;
-	}
+	LOG_DBG("path:%u/%u/%u/%u(%u), value:%p, len:%d", path->obj_id,
+		path->obj_inst_id, path->res_id, path->res_inst_id, path->level,
+		value, len);
 
-	if (path.level < 3) {
+	if (path->level < 3) {
 		LOG_ERR("path must have at least 3 parts");
 		return -EINVAL;
 	}
 
 	/* look up resource obj */
-	ret = path_to_objs(&path, &obj_inst, &obj_field, &res, &res_inst);
+	ret = path_to_objs(path, &obj_inst, &obj_field, &res, &res_inst);
 	if (ret < 0) {
 		return ret;
 	}
 
 	if (!res_inst) {
-		LOG_ERR("res instance %d not found", path.res_inst_id);
+		LOG_ERR("res instance %d not found", path->res_inst_id);
 		return -ENOENT;
 	}
 
 	if (LWM2M_HAS_RES_FLAG(res_inst, LWM2M_RES_DATA_FLAG_RO)) {
 		LOG_ERR("res instance data pointer is read-only "
-			"[%u/%u/%u/%u:%u]", path.obj_id, path.obj_inst_id,
-			path.res_id, path.res_inst_id, path.level);
+			"[%u/%u/%u/%u:%u]", path->obj_id, path->obj_inst_id,
+			path->res_id, path->res_inst_id, path->level);
 		return -EACCES;
 	}
 
@@ -2019,8 +2145,8 @@ static int lwm2m_engine_set(const char *pathstr, void *value, uint16_t len)
 
 	if (!data_ptr) {
 		LOG_ERR("res instance data pointer is NULL [%u/%u/%u/%u:%u]",
-			path.obj_id, path.obj_inst_id, path.res_id,
-			path.res_inst_id, path.level);
+			path->obj_id, path->obj_inst_id, path->res_id,
+			path->res_inst_id, path->level);
 		return -EINVAL;
 	}
 
@@ -2028,7 +2154,7 @@ static int lwm2m_engine_set(const char *pathstr, void *value, uint16_t len)
 	if (len > max_data_len -
 		(obj_field->data_type == LWM2M_RES_TYPE_STRING ? 1 : 0)) {
 		LOG_ERR("length %u is too long for res instance %d data",
-			len, path.res_id);
+			len, path->res_id);
 		return -ENOMEM;
 	}
 
@@ -2115,12 +2241,26 @@ static int lwm2m_engine_set(const char *pathstr, void *value, uint16_t len)
 	}
 
 	if (changed && LWM2M_HAS_PERM(obj_field, LWM2M_PERM_R)) {
-		NOTIFY_OBSERVER_PATH(&path);
+		NOTIFY_OBSERVER_PATH(path);
 	}
 
 	return ret;
 }
 
+static int lwm2m_engine_set(const char *pathstr, void *value, uint16_t len)
+{
+	struct lwm2m_obj_path path;
+	int ret;
+
+	/* translate path -> path_obj */
+	ret = lwm2m_string_to_path(pathstr, &path, '/');
+	if (ret < 0) {
+		return ret;
+	}
+
+	return engine_set(&path, value, len);
+}
+
 int lwm2m_engine_set_opaque(const char *pathstr, char *data_ptr, uint16_t data_len)
 {
 	return lwm2m_engine_set(pathstr, data_ptr, data_len);
@@ -2188,6 +2328,73 @@ int lwm2m_engine_set_objlnk(const char *pathstr, struct lwm2m_objlnk *value)
 	return lwm2m_engine_set(pathstr, value, sizeof(struct lwm2m_objlnk));
 }
 
+int lwm2m_set_opaque(const struct lwm2m_obj_path *path, char *data_ptr, uint16_t data_len)
+{
+	return engine_set(path, data_ptr, data_len);
+}
+
+int lwm2m_set_string(const struct lwm2m_obj_path *path, char *data_ptr)
+{
+	return engine_set(path, data_ptr, strlen(data_ptr));
+}
+
+int lwm2m_set_u8(const struct lwm2m_obj_path *path, uint8_t value)
+{
+	return engine_set(path, &value, 1);
+}
+
+int lwm2m_set_u16(const struct lwm2m_obj_path *path, uint16_t value)
+{
+	return engine_set(path, &value, 2);
+}
+
+int lwm2m_set_u32(const struct lwm2m_obj_path *path, uint32_t value)
+{
+	return engine_set(path, &value, 4);
+}
+
+int lwm2m_set_u64(const struct lwm2m_obj_path *path, uint64_t value)
+{
+	return engine_set(path, &value, 8);
+}
+
+int lwm2m_set_s8(const struct lwm2m_obj_path *path, int8_t value)
+{
+	return engine_set(path, &value, 1);
+}
+
+int lwm2m_set_s16(const struct lwm2m_obj_path *path, int16_t value)
+{
+	return engine_set(path, &value, 2);
+}
+
+int lwm2m_set_s32(const struct lwm2m_obj_path *path, int32_t value)
+{
+	return engine_set(path, &value, 4);
+}
+
+int lwm2m_set_s64(const struct lwm2m_obj_path *path, int64_t value)
+{
+	return engine_set(path, &value, 8);
+}
+
+int lwm2m_set_bool(const struct lwm2m_obj_path *path, bool value)
+{
+	uint8_t temp = (value != 0 ? 1 : 0);
+
+	return engine_set(path, &temp, 1);
+}
+
+int lwm2m_set_float(const struct lwm2m_obj_path *path, double *value)
+{
+	return engine_set(path, value, sizeof(double));
+}
+
+int lwm2m_set_objlnk(const struct lwm2m_obj_path *path, struct lwm2m_objlnk *value)
+{
+	return engine_set(path, value, sizeof(struct lwm2m_objlnk));
+}
+
 /* user data getter functions */
 
 int lwm2m_engine_get_res_data(const char *pathstr, void **data_ptr, uint16_t *data_len,
@@ -2226,10 +2433,9 @@ int lwm2m_engine_get_res_data(const char *pathstr, void **data_ptr, uint16_t *da
 	return 0;
 }
 
-static int lwm2m_engine_get(const char *pathstr, void *buf, uint16_t buflen)
+static int engine_get(const struct lwm2m_obj_path *path, void *buf, uint16_t buflen)
 {
 	int ret = 0;
-	struct lwm2m_obj_path path;
 	struct lwm2m_engine_obj_inst *obj_inst;
 	struct lwm2m_engine_obj_field *obj_field;
 	struct lwm2m_engine_res *res = NULL;
@@ -2237,27 +2443,23 @@ static int lwm2m_engine_get(const char *pathstr, void *buf, uint16_t buflen)
 	void *data_ptr = NULL;
 	size_t data_len = 0;
 
-	LOG_DBG("path:%s, buf:%p, buflen:%d", log_strdup(pathstr), buf, buflen);
+	LOG_DBG("path:%u/%u/%u/%u(%u), buf:%p, buflen:%d", path->obj_id,
+		path->obj_inst_id, path->res_id, path->res_inst_id, path->level,
+		buf, buflen);
 
-	/* translate path -> path_obj */
-	ret = lwm2m_string_to_path(pathstr, &path, '/');
-	if (ret < 0) {
-		return ret;
-	}
-
-	if (path.level < 3) {
+	if (path->level < 3) {
 		LOG_ERR("path must have at least 3 parts");
 		return -EINVAL;
 	}
 
 	/* look up resource obj */
-	ret = path_to_objs(&path, &obj_inst, &obj_field, &res, &res_inst);
+	ret = path_to_objs(path, &obj_inst, &obj_field, &res, &res_inst);
 	if (ret < 0) {
 		return ret;
 	}
 
 	if (!res_inst) {
-		LOG_ERR("res instance %d not found", path.res_inst_id);
+		LOG_ERR("res instance %d not found", path->res_inst_id);
 		return -ENOENT;
 	}
 
@@ -2342,6 +2544,20 @@ static int lwm2m_engine_get(const char *pathstr, void *buf, uint16_t buflen)
 	return 0;
 }
 
+static int lwm2m_engine_get(const char *pathstr, void *buf, uint16_t buflen)
+{
+	struct lwm2m_obj_path path;
+	int ret;
+
+	/* translate path -> path_obj */
+	ret = lwm2m_string_to_path(pathstr, &path, '/');
+	if (ret < 0) {
+		return ret;
+	}
+
+	return engine_get(&path, buf, buflen);
+}
+
 int lwm2m_engine_get_opaque(const char *pathstr, void *buf, uint16_t buflen)
 {
 	return lwm2m_engine_get(pathstr, buf, buflen);
@@ -2415,6 +2631,79 @@ int lwm2m_engine_get_objlnk(const char *pathstr, struct lwm2m_objlnk *buf)
 	return lwm2m_engine_get(pathstr, buf, sizeof(struct lwm2m_objlnk));
 }
 
+int lwm2m_get_opaque(const struct lwm2m_obj_path *path, void *buf, uint16_t buflen)
+{
+	return engine_get(path, buf, buflen);
+}
+
+int lwm2m_get_string(const struct lwm2m_obj_path *path, void *buf, uint16_t buflen)
+{
+	return engine_get(path, buf, buflen);
+}
+
+int lwm2m_get_u8(const struct lwm2m_obj_path *path, uint8_t *value)
+{
+	return engine_get(path, value, 1);
+}
+
+int lwm2m_get_u16(const struct lwm2m_obj_path *path, uint16_t *value)
+{
+	return engine_get(path, value, 2);
+}
+
+int lwm2m_get_u32(const struct lwm2m_obj_path *path, uint32_t *value)
+{
+	return engine_get(path, value, 4);
+}
+
+int lwm2m_get_u64(const struct lwm2m_obj_path *path, uint64_t *value)
+{
+	return engine_get(path, value, 8);
+}
+
+int lwm2m_get_s8(const struct lwm2m_obj_path *path, int8_t *value)
+{
+	return engine_get(path, value, 1);
+}
+
+int lwm2m_get_s16(const struct lwm2m_obj_path *path, int16_t *value)
+{
+	return engine_get(path, value, 2);
+}
+
+int lwm2m_get_s32(const struct lwm2m_obj_path *path, int32_t *value)
+{
+	return engine_get(path, value, 4);
+}
+
+int lwm2m_get_s64(const struct lwm2m_obj_path *path, int64_t *value)
+{
+	return engine_get(path, value, 8);
+}
+
+int lwm2m_get_bool(const struct lwm2m_obj_path *path, bool *value)
+{
+	int ret = 0;
+	int8_t temp = 0;
+
+	ret = lwm2m_get_s8(path, &temp);
+	if (!ret) {
+		*value = temp != 0;
+	}
+
+	return ret;
+}
+
+int lwm2m_get_float(const struct lwm2m_obj_path *path, double *buf)
+{
+	return engine_get(path, buf, sizeof(double));
+}
+
+int lwm2m_get_objlnk(const struct lwm2m_obj_path *path, struct lwm2m_objlnk *buf)
+{
+	return engine_get(path, buf, sizeof(struct lwm2m_objlnk));
+}
+
 int lwm2m_engine_get_resource(const char *pathstr, struct lwm2m_engine_res **res)
 {
 	int ret;
@@ -5618,16 +5907,116 @@ static int64_t engine_observe_shedule_next_event(struct observe_node *obs, uint1
 	return t_s;
 }
 
+#if defined(CONFIG_LWM2M_ENGINE_NOTIFY_SEND)
+/* Path list of the Send operation reporting the due observations */
+static struct lwm2m_obj_path_list notify_send_path_buf[CONFIG_LWM2M_COMPOSITE_PATH_LIST_SIZE];
+
+static int path_list_len(sys_slist_t *path_list)
+{
+	sys_snode_t *node;
+	int len = 0;
+
+	SYS_SLIST_FOR_EACH_NODE(path_list, node) {
+		len++;
+	}
+
+	return len;
+}
+
+/* Observations with more paths than a Send can carry are notified one by one */
+static bool notify_send_fits(struct observe_node *obs)
+{
+	return path_list_len(&obs->path_list) <= CONFIG_LWM2M_COMPOSITE_PATH_LIST_SIZE;
+}
+
+static int generate_notify_send_message(struct lwm2m_ctx *ctx,
+					const int64_t timestamp)
+{
+	struct lwm2m_obj_path_list *entry;
+	struct observe_node *obs;
+	sys_slist_t path_list;
+	sys_slist_t free_list;
+	int count = 0;
+	int ret;
+
+	lwm2m_engine_path_list_init(&path_list, &free_list, notify_send_path_buf,
+				    CONFIG_LWM2M_COMPOSITE_PATH_LIST_SIZE);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&ctx->observer, obs, node) {
+		obs->batched = false;
+
+		if (!obs->event_timestamp || timestamp < obs->event_timestamp ||
+		    !notify_send_fits(obs)) {
+			continue;
+		}
+
+		/* The remaining observations go with the next Send */
+		if (path_list_len(&obs->path_list) > path_list_len(&free_list)) {
+			continue;
+		}
+
+		SYS_SLIST_FOR_EACH_CONTAINER(&obs->path_list, entry, node) {
+			(void)lwm2m_engine_add_path_to_list(&path_list, &free_list,
+							    &entry->path);
+		}
+
+		obs->batched = true;
+		count++;
+	}
+
+	if (count == 0) {
+		return 0;
+	}
+
+	lwm2m_engine_clear_duplicate_path(&path_list, &free_list);
+
+	LOG_DBG("NOTIFY SEND: %d observations", count);
+
+	ret = engine_send_path_list(ctx, &path_list, true);
+	if (ret < 0) {
+		return ret;
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&ctx->observer, obs, node) {
+		if (!obs->batched) {
+			continue;
+		}
+
+		obs->resource_update = false;
+		obs->event_timestamp =
+			engine_observe_shedule_next_event(obs, ctx->srv_obj_inst, timestamp);
+		obs->last_timestamp = timestamp;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_LWM2M_ENGINE_NOTIFY_SEND */
+
 static void check_notifications(struct lwm2m_ctx *ctx,
 				const int64_t timestamp)
 {
 	struct observe_node *obs;
 	int rc;
 
+#if defined(CONFIG_LWM2M_ENGINE_NOTIFY_SEND)
+	bool notify_send = lwm2m_rd_client_is_registred(ctx) &&
+			   !lwm2m_server_get_mute_send(ctx->srv_obj_inst);
+
+	if (notify_send) {
+		(void)generate_notify_send_message(ctx, timestamp);
+	}
+#endif
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&ctx->observer, obs, node) {
 		if (!obs->event_timestamp || timestamp < obs->event_timestamp) {
 			continue;
 		}
+#if defined(CONFIG_LWM2M_ENGINE_NOTIFY_SEND)
+		/* Reported by the Send operation */
+		if (notify_send && notify_send_fits(obs)) {
+			continue;
+		}
+#endif
 		/* Check That There is not pending process and client is registred */
 		if (obs->active_tx_operation || !lwm2m_rd_client_is_registred(ctx)) {
 			continue;
@@ -6444,38 +6833,14 @@ static void do_send_timeout_cb(struct lwm2m_message *msg)
 }
 #endif
 
-int lwm2m_engine_send(struct lwm2m_ctx *ctx, char const *path_list[], uint8_t path_list_size,
-		      bool confirmation_request)
-{
 #if defined(CONFIG_LWM2M_SERVER_OBJECT_VERSION_1_1)
+static int engine_send_path_list(struct lwm2m_ctx *ctx, sys_slist_t *lwm2m_path_list,
+				 bool confirmation_request)
+{
 	struct lwm2m_message *msg;
 	int ret;
 	uint16_t content_format;
 
-	/* Path list buffer */
-	struct lwm2m_obj_path temp;
-	struct lwm2m_obj_path_list lwm2m_path_list_buf[CONFIG_LWM2M_COMPOSITE_PATH_LIST_SIZE];
-	sys_slist_t lwm2m_path_list;
-	sys_slist_t lwm2m_path_free_list;
-
-	/* Validate Connection */
-	if (!lwm2m_rd_client_is_registred(ctx)) {
-		return -EPERM;
-	}
-
-	if (lwm2m_server_get_mute_send(ctx->srv_obj_inst)) {
-		LOG_WRN("Send operation is muted by server");
-		return -EPERM;
-	}
-
-	/* Init list */
-	lwm2m_engine_path_list_init(&lwm2m_path_list, &lwm2m_path_free_list, lwm2m_path_list_buf,
-				    CONFIG_LWM2M_COMPOSITE_PATH_LIST_SIZE);
-
-	if (path_list_size > CONFIG_LWM2M_COMPOSITE_PATH_LIST_SIZE) {
-		return -E2BIG;
-	}
-
 	if (IS_ENABLED(CONFIG_LWM2M_RW_SENML_CBOR_SUPPORT)) {
 		content_format = LWM2M_FORMAT_APP_SENML_CBOR;
 	} else if (IS_ENABLED(CONFIG_LWM2M_RW_SENML_JSON_SUPPORT)) {
@@ -6485,20 +6850,6 @@ int lwm2m_engine_send(struct lwm2m_ctx *ctx, char const *path_list[], uint8_t pa
 		return -ENOTSUP;
 	}
 
-	/* Parse Path to internal used object path format */
-	for (int i = 0; i < path_list_size; i++) {
-		ret = lwm2m_string_to_path(path_list[i], &temp, '/');
-		if (ret < 0) {
-			return ret;
-		}
-		/* Add to linked list */
-		if (lwm2m_engine_add_path_to_list(&lwm2m_path_list, &lwm2m_path_free_list, &temp)) {
-			return -1;
-		}
-	}
-	/* Clear path which are part are part of recursive path /1 will include /1/0/1 */
-	lwm2m_engine_clear_duplicate_path(&lwm2m_path_list, &lwm2m_path_free_list);
-
 	/* Allocate Message buffer */
 	msg = lwm2m_get_message(ctx);
 	if (!msg) {
@@ -6539,7 +6890,7 @@ int lwm2m_engine_send(struct lwm2m_ctx *ctx, char const *path_list[], uint8_t pa
 	}
 
 	/* Write requested path data */
-	ret = do_send_op(msg, content_format, &lwm2m_path_list);
+	ret = do_send_op(msg, content_format, lwm2m_path_list);
 	if (ret < 0) {
 		LOG_ERR("Send (err:%d)", ret);
 		goto cleanup;
@@ -6551,6 +6902,54 @@ int lwm2m_engine_send(struct lwm2m_ctx *ctx, char const *path_list[], uint8_t pa
 cleanup:
 	lwm2m_reset_message(msg, true);
 	return ret;
+}
+#endif
+
+int lwm2m_engine_send(struct lwm2m_ctx *ctx, char const *path_list[], uint8_t path_list_size,
+		      bool confirmation_request)
+{
+#if defined(CONFIG_LWM2M_SERVER_OBJECT_VERSION_1_1)
+	int ret;
+
+	/* Path list buffer */
+	struct lwm2m_obj_path temp;
+	struct lwm2m_obj_path_list lwm2m_path_list_buf[CONFIG_LWM2M_COMPOSITE_PATH_LIST_SIZE];
+	sys_slist_t lwm2m_path_list;
+	sys_slist_t lwm2m_path_free_list;
+
+	/* Validate Connection */
+	if (!lwm2m_rd_client_is_registred(ctx)) {
+		return -EPERM;
+	}
+
+	if (lwm2m_server_get_mute_send(ctx->srv_obj_inst)) {
+		LOG_WRN("Send operation is muted by server");
+		return -EPERM;
+	}
+
+	/* Init list */
+	lwm2m_engine_path_list_init(&lwm2m_path_list, &lwm2m_path_free_list, lwm2m_path_list_buf,
+				    CONFIG_LWM2M_COMPOSITE_PATH_LIST_SIZE);
+
+	if (path_list_size > CONFIG_LWM2M_COMPOSITE_PATH_LIST_SIZE) {
+		return -E2BIG;
+	}
+
+	/* Parse Path to internal used object path format */
+	for (int i = 0; i < path_list_size; i++) {
+		ret = lwm2m_string_to_path(path_list[i], &temp, '/');
+		if (ret < 0) {
+			return ret;
+		}
+		/* Add to linked list */
+		if (lwm2m_engine_add_path_to_list(&lwm2m_path_list, &lwm2m_path_free_list, &temp)) {
+			return -1;
+		}
+	}
+	/* Clear path which are part are part of recursive path /1 will include /1/0/1 */
+	lwm2m_engine_clear_duplicate_path(&lwm2m_path_list, &lwm2m_path_free_list);
+
+	return engine_send_path_list(ctx, &lwm2m_path_list, confirmation_request);
 #else
 	LOG_WRN("LwM2M send is only supported for CONFIG_LWM2M_SERVER_OBJECT_VERSION_1_1");
 	return -ENOTSUP;
@@ -25,6 +25,11 @@ static void client_reset(struct mqtt_client *client)
 	client->internal.last_activity = 0U;
 	client->internal.rx_buf_datalen = 0U;
 	client->internal.remaining_payload = 0U;
+
+#if defined(CONFIG_MQTT_PUBLISH_QUEUE)
+	/* Queued messages are dropped on disconnection. */
+	memset(&client->publish_queue, 0, sizeof(client->publish_queue));
+#endif
 }
 
 /** @brief Initialize tx buffer. */
@@ -236,6 +241,12 @@ static int verify_tx_state(const struct mqtt_client *client)
 	return 0;
 }
 
+#if defined(CONFIG_MQTT_PUBLISH_QUEUE)
+static int publish_queue_check_id(struct mqtt_client *client,
+				  const struct mqtt_publish_param *param,
+				  bool retransmit);
+#endif
+
 int mqtt_publish(struct mqtt_client *client,
 		 const struct mqtt_publish_param *param)
 {
@@ -261,6 +272,13 @@ int mqtt_publish(struct mqtt_client *client,
 		goto error;
 	}
 
+#if defined(CONFIG_MQTT_PUBLISH_QUEUE)
+	err_code = publish_queue_check_id(client, param, true);
+	if (err_code < 0) {
+		goto error;
+	}
+#endif
+
 	err_code = publish_encode(param, &packet);
 	if (err_code < 0) {
 		goto error;
@@ -287,6 +305,245 @@ error:
 	return err_code;
 }
 
+#if defined(CONFIG_MQTT_PUBLISH_QUEUE)
+#define PUBLISH_QUEUE_SIZE CONFIG_MQTT_PUBLISH_QUEUE_SIZE
+
+static struct mqtt_publish_param *publish_queue_at(struct mqtt_client *client,
+						    uint8_t index)
+{
+	struct mqtt_publish_queue *queue = &client->publish_queue;
+
+	return &queue->msgs[(queue->head + index) % PUBLISH_QUEUE_SIZE];
+}
+
+/* Remove the oldest queued message, and return it in evt. */
+static void publish_queue_pop(struct mqtt_client *client,
+			      struct mqtt_evt *evt, int result)
+{
+	struct mqtt_publish_queue *queue = &client->publish_queue;
+
+	evt->type = MQTT_EVT_PUBLISH_SENT;
+	evt->result = result;
+	evt->param.publish = *publish_queue_at(client, 0);
+
+	queue->head = (queue->head + 1) % PUBLISH_QUEUE_SIZE;
+	queue->count--;
+}
+
+/* Write the queued messages which can be sent to the transport, at once.
+ * Returns the number of messages removed from the queue.
+ */
+static int publish_queue_send(struct mqtt_client *client)
+{
+	struct mqtt_publish_queue *queue = &client->publish_queue;
+	struct iovec io_vector[2 * PUBLISH_QUEUE_SIZE];
+	struct mqtt_evt sent[PUBLISH_QUEUE_SIZE];
+	struct mqtt_publish_param *param;
+	uint8_t *tx_end = client->tx_buf;
+	uint8_t inflight = queue->inflight_count;
+	struct buf_ctx packet;
+	struct msghdr msg;
+	int err_code;
+	int count;
+
+	for (count = 0; count < queue->count; count++) {
+		param = publish_queue_at(client, count);
+
+		if (param->message.topic.qos != MQTT_QOS_0_AT_MOST_ONCE &&
+		    inflight >= CONFIG_MQTT_PUBLISH_INFLIGHT_MAX) {
+			break;
+		}
+
+		/* Encode the headers one after the other in the tx buffer. */
+		packet.cur = tx_end;
+		packet.end = client->tx_buf + client->tx_buf_size;
+
+		err_code = publish_encode(param, &packet);
+		if (err_code < 0) {
+			if (count > 0) {
+				/* No room left, send the next ones later. */
+				break;
+			}
+
+			NET_ERR("[CID %p]: Dropping queued message, err %d",
+				client, err_code);
+			publish_queue_pop(client, &sent[0], err_code);
+			event_notify(client, &sent[0]);
+			return 1;
+		}
+
+		io_vector[2 * count].iov_base = packet.cur;
+		io_vector[2 * count].iov_len = packet.end - packet.cur;
+		io_vector[2 * count + 1].iov_base = param->message.payload.data;
+		io_vector[2 * count + 1].iov_len = param->message.payload.len;
+		tx_end = packet.end;
+
+		if (param->message.topic.qos != MQTT_QOS_0_AT_MOST_ONCE) {
+			inflight++;
+		}
+	}
+
+	if (count == 0) {
+		return 0;
+	}
+
+	memset(&msg, 0, sizeof(msg));
+
+	msg.msg_iov = io_vector;
+	msg.msg_iovlen = 2 * count;
+
+	err_code = client_write_msg(client, &msg);
+	if (err_code < 0) {
+		/* The queue was dropped on disconnection. */
+		return err_code;
+	}
+
+	for (int i = 0; i < count; i++) {
+		param = publish_queue_at(client, i);
+
+		if (param->message.topic.qos != MQTT_QOS_0_AT_MOST_ONCE) {
+			queue->inflight[queue->inflight_count].message_id =
+				param->message_id;
+			queue->inflight[queue->inflight_count].qos =
+				param->message.topic.qos;
+			queue->inflight_count++;
+		}
+	}
+
+	/* Remove the sent messages before notifying the application, which
+	 * may queue new ones from its event handler.
+	 */
+	for (int i = 0; i < count; i++) {
+		publish_queue_pop(client, &sent[i], 0);
+	}
+
+	for (int i = 0; i < count; i++) {
+		event_notify(client, &sent[i]);
+	}
+
+	return count;
+}
+
+static void publish_queue_flush(struct mqtt_client *client)
+{
+	while (verify_tx_state(client) == 0 &&
+	       publish_queue_send(client) > 0) {
+	}
+}
+
+static int publish_queue_find_inflight(struct mqtt_client *client,
+				       uint16_t message_id)
+{
+	struct mqtt_publish_queue *queue = &client->publish_queue;
+
+	for (int i = 0; i < queue->inflight_count; i++) {
+		if (queue->inflight[i].message_id == message_id) {
+			return i;
+		}
+	}
+
+	return -ENOENT;
+}
+
+/* The queue owns the message ids of its QoS 1 and 2 messages, from the time
+ * they are queued until they are acknowledged, so that the acknowledgment
+ * of another message never releases their in-flight slot. A message
+ * awaiting acknowledgment may only be retransmitted, with the dup flag set.
+ */
+static int publish_queue_check_id(struct mqtt_client *client,
+				  const struct mqtt_publish_param *param,
+				  bool retransmit)
+{
+	struct mqtt_publish_queue *queue = &client->publish_queue;
+	struct mqtt_publish_param *queued;
+
+	if (param->message.topic.qos == MQTT_QOS_0_AT_MOST_ONCE) {
+		return 0;
+	}
+
+	if (publish_queue_find_inflight(client, param->message_id) >= 0) {
+		return (retransmit && param->dup_flag) ? 0 : -EBUSY;
+	}
+
+	for (int i = 0; i < queue->count; i++) {
+		queued = publish_queue_at(client, i);
+
+		if (queued->message.topic.qos != MQTT_QOS_0_AT_MOST_ONCE &&
+		    queued->message_id == param->message_id) {
+			return -EBUSY;
+		}
+	}
+
+	return 0;
+}
+
+void publish_queue_ack(struct mqtt_client *client, uint16_t message_id,
+		       enum mqtt_qos qos)
+{
+	struct mqtt_publish_queue *queue = &client->publish_queue;
+	int i;
+
+	i = publish_queue_find_inflight(client, message_id);
+	if (i >= 0 && queue->inflight[i].qos == qos) {
+
+		queue->inflight[i] = queue->inflight[--queue->inflight_count];
+		publish_queue_flush(client);
+	}
+}
+
+int mqtt_publish_async(struct mqtt_client *client,
+		       const struct mqtt_publish_param *param)
+{
+	struct mqtt_publish_queue *queue;
+	int err_code;
+
+	NULL_PARAM_CHECK(client);
+	NULL_PARAM_CHECK(param);
+
+	NET_DBG("[CID %p]:[State 0x%02x]: >> Topic size 0x%08x, "
+		 "Data size 0x%08x", client, client->internal.state,
+		 param->message.topic.topic.size,
+		 param->message.payload.len);
+
+	mqtt_mutex_lock(client);
+
+	queue = &client->publish_queue;
+
+	err_code = verify_tx_state(client);
+	if (err_code < 0) {
+		goto error;
+	}
+
+	if ((param->message.topic.qos) && (param->message_id == 0U)) {
+		err_code = -EINVAL;
+		goto error;
+	}
+
+	if (queue->count == PUBLISH_QUEUE_SIZE) {
+		err_code = -ENOMEM;
+		goto error;
+	}
+
+	err_code = publish_queue_check_id(client, param, false);
+	if (err_code < 0) {
+		goto error;
+	}
+
+	*publish_queue_at(client, queue->count) = *param;
+	queue->count++;
+
+	publish_queue_flush(client);
+
+error:
+	NET_DBG("[CID %p]:[State 0x%02x]: << result 0x%08x",
+			 client, client->internal.state, err_code);
+
+	mqtt_mutex_unlock(client);
+
+	return err_code;
+}
+#endif /* CONFIG_MQTT_PUBLISH_QUEUE */
+
 int mqtt_publish_qos1_ack(struct mqtt_client *client,
 			  const struct mqtt_puback_param *param)
 {
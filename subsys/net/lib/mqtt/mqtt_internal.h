@@ -154,6 +154,19 @@ enum mqtt_state {
  */
 void event_notify(struct mqtt_client *client, const struct mqtt_evt *evt);
 
+#if defined(CONFIG_MQTT_PUBLISH_QUEUE)
+/**@brief Release the in-flight slot of an acknowledged queued message, and
+ *        send the queued messages it was holding back.
+ *
+ * @param[in] client Identifies the client which received the acknowledgment.
+ * @param[in] message_id Message id of the PUBACK or PUBCOMP.
+ * @param[in] qos QoS of the messages the acknowledgment ends, QoS 1 for a
+ *                PUBACK and QoS 2 for a PUBCOMP.
+ */
+void publish_queue_ack(struct mqtt_client *client, uint16_t message_id,
+		       enum mqtt_qos qos);
+#endif /* CONFIG_MQTT_PUBLISH_QUEUE */
+
 /**@brief Handles MQTT messages received from the peer.
  *
  * @param[in] client Identifies the client for which the data was received.
@@ -142,6 +142,18 @@ static int mqtt_handle_packet(struct mqtt_client *client,
 		event_notify(client, &evt);
 	}
 
+#if defined(CONFIG_MQTT_PUBLISH_QUEUE)
+	if (notify_event && err_code == 0) {
+		if (evt.type == MQTT_EVT_PUBACK) {
+			publish_queue_ack(client, evt.param.puback.message_id,
+					  MQTT_QOS_1_AT_LEAST_ONCE);
+		} else if (evt.type == MQTT_EVT_PUBCOMP) {
+			publish_queue_ack(client, evt.param.pubcomp.message_id,
+					  MQTT_QOS_2_EXACTLY_ONCE);
+		}
+	}
+#endif /* CONFIG_MQTT_PUBLISH_QUEUE */
+
 	return err_code;
 }
 
@@ -891,10 +891,10 @@ fail:
 #include <syscalls/zsock_sendmsg_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
-static int sock_get_pkt_src_addr(struct net_pkt *pkt,
-				 enum net_ip_protocol proto,
-				 struct sockaddr *addr,
-				 socklen_t addrlen)
+int sock_get_pkt_src_addr(struct net_pkt *pkt,
+			  enum net_ip_protocol proto,
+			  struct sockaddr *addr,
+			  socklen_t addrlen)
 {
 	int ret = 0;
 	struct net_pkt_cursor backup;
@@ -17,6 +17,16 @@ int zsock_poll_internal(struct zsock_pollfd *fds, int nfds, k_timeout_t timeout)
 
 int zsock_wait_data(struct net_context *ctx, k_timeout_t *timeout);
 
+ssize_t zsock_sendto_ctx(struct net_context *ctx, const void *buf, size_t len,
+			 int flags,
+			 const struct sockaddr *dest_addr, socklen_t addrlen);
+int sock_get_pkt_src_addr(struct net_pkt *pkt,
+			  enum net_ip_protocol proto,
+			  struct sockaddr *addr,
+			  socklen_t addrlen);
+
+extern const struct socket_op_vtable sock_fd_op_vtable;
+
 static inline void sock_set_flag(struct net_context *ctx, uintptr_t mask,
 				 uintptr_t flag)
 {
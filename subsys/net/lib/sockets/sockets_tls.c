@@ -14,6 +14,7 @@ LOG_MODULE_REGISTER(net_sock_tls, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <zephyr/init.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/net/socket.h>
+#include <zephyr/net/net_pkt.h>
 #include <zephyr/random/rand32.h>
 #include <zephyr/syscall_handler.h>
 #include <zephyr/sys/fdtable.h>
@@ -48,6 +49,7 @@ LOG_MODULE_REGISTER(net_sock_tls, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <mbedtls/debug.h>
 #include <mbedtls/platform.h>
 #include <mbedtls/ssl_cache.h>
+#include <mbedtls/ssl_ticket.h>
 #endif /* CONFIG_MBEDTLS */
 
 #include "sockets_internal.h"
@@ -90,7 +92,7 @@ struct dtls_timing_context {
 	uint32_t fin_ms;
 };
 
-/** TLS peer address/session ID mapping. */
+/** TLS peer address or hostname/session ID mapping. */
 struct tls_session_cache {
 	/** Creation time. */
 	int64_t timestamp;
@@ -98,6 +100,9 @@ struct tls_session_cache {
 	/** Peer address. */
 	struct sockaddr peer_addr;
 
+	/** Peer hostname, NULL if the session is stored for the address. */
+	char *hostname;
+
 	/** Session buffer. */
 	uint8_t *session;
 
@@ -184,8 +189,42 @@ __net_socket struct tls_context {
 
 	/** DTLS peer address length. */
 	socklen_t dtls_peer_addrlen;
+
+#if defined(CONFIG_NET_SOCKETS_DTLS_PKT_BIO)
+	/** Network context of the underlying socket, NULL if offloaded. */
+	struct net_context *net_ctx;
+#endif
 #endif /* CONFIG_NET_SOCKETS_ENABLE_DTLS */
 
+#if defined(CONFIG_NET_SOCKETS_TLS_HANDSHAKE_OFFLOAD)
+	/** Work item running the handshake of a non-blocking socket. */
+	struct k_work_poll handshake_work;
+
+	/** Event resuming the handshake when the peer sends data. */
+	struct k_poll_event handshake_event;
+
+	/** Uptime at which the offloaded handshake was started, in ms. */
+	uint32_t handshake_start;
+
+	/** Given when the offloaded handshake completes or fails. */
+	struct k_sem handshake_done;
+
+	/** Peer address the session is stored for, client role only. */
+	struct sockaddr handshake_peer_addr;
+
+	/** Peer address length, 0 in server role. */
+	socklen_t handshake_peer_addrlen;
+
+	/** Result of the offloaded handshake. */
+	int handshake_result;
+
+	/** Information whether the handshake is run by the handshake thread. */
+	bool handshake_offloaded;
+
+	/** Set to abort the offloaded handshake when the socket is closed. */
+	bool handshake_abort;
+#endif /* CONFIG_NET_SOCKETS_TLS_HANDSHAKE_OFFLOAD */
+
 #if defined(CONFIG_MBEDTLS)
 	/** mbedTLS context. */
 	mbedtls_ssl_context ssl;
@@ -213,19 +252,66 @@ static struct tls_context tls_contexts[CONFIG_NET_SOCKETS_TLS_MAX_CONTEXTS];
 
 static struct tls_session_cache client_cache[CONFIG_NET_SOCKETS_TLS_MAX_CLIENT_SESSION_COUNT];
 
+/* Protects the client session cache, which handshakes run from the
+ * handshake thread access too.
+ */
+static K_MUTEX_DEFINE(client_cache_lock);
+
 #if defined(MBEDTLS_SSL_CACHE_C)
 static mbedtls_ssl_cache_context server_cache;
 #endif
 
+#if defined(MBEDTLS_SSL_TICKET_C)
+#if defined(MBEDTLS_GCM_C)
+#define TLS_TICKET_CIPHER MBEDTLS_CIPHER_AES_256_GCM
+#elif defined(MBEDTLS_CCM_C)
+#define TLS_TICKET_CIPHER MBEDTLS_CIPHER_AES_256_CCM
+#else
+#define TLS_TICKET_CIPHER MBEDTLS_CIPHER_CHACHA20_POLY1305
+#endif
+
+static mbedtls_ssl_ticket_context server_ticket;
+static bool server_ticket_ready;
+#endif /* MBEDTLS_SSL_TICKET_C */
+
+#if defined(MBEDTLS_SSL_CACHE_C) || defined(MBEDTLS_SSL_TICKET_C)
+/* Serializes the use of the server session cache and ticket keys by
+ * handshakes with their reset by tls_session_purge().
+ */
+static K_MUTEX_DEFINE(server_session_lock);
+#endif
+
+#if defined(CONFIG_NET_SOCKETS_TLS_HANDSHAKE_OFFLOAD)
+/* Interval at which an offloaded handshake which could not send all its
+ * data is resumed, as socket writability cannot be waited for.
+ */
+#define TLS_HANDSHAKE_WRITE_RETRY_MS 100
+
+static struct k_work_q handshake_work_q;
+static K_KERNEL_STACK_DEFINE(handshake_work_q_stack,
+			     CONFIG_NET_SOCKETS_TLS_HANDSHAKE_STACK_SIZE);
+#endif /* CONFIG_NET_SOCKETS_TLS_HANDSHAKE_OFFLOAD */
+
 /* A mutex for protecting TLS context allocation. */
 static struct k_mutex context_lock;
 
+static void tls_session_entry_free(struct tls_session_cache *entry)
+{
+	if (entry->session != NULL) {
+		mbedtls_free(entry->session);
+		entry->session = NULL;
+	}
+
+	if (entry->hostname != NULL) {
+		mbedtls_free(entry->hostname);
+		entry->hostname = NULL;
+	}
+}
+
 static void tls_session_cache_reset(void)
 {
 	for (int i = 0; i < ARRAY_SIZE(client_cache); i++) {
-		if (client_cache[i].session != NULL) {
-			mbedtls_free(client_cache[i].session);
-		}
+		tls_session_entry_free(&client_cache[i]);
 	}
 
 	(void)memset(client_cache, 0, sizeof(client_cache));
@@ -319,6 +405,88 @@ static int dtls_timing_get_delay(void *data)
 }
 #endif /* CONFIG_NET_SOCKETS_ENABLE_DTLS */
 
+#if defined(MBEDTLS_SSL_TICKET_C)
+static void tls_session_ticket_setup(void)
+{
+	int ret;
+
+	mbedtls_ssl_ticket_init(&server_ticket);
+
+	ret = mbedtls_ssl_ticket_setup(
+			&server_ticket, tls_ctr_drbg_random, NULL,
+			TLS_TICKET_CIPHER,
+			CONFIG_NET_SOCKETS_TLS_SESSION_TICKET_LIFETIME);
+	if (ret != 0) {
+		NET_ERR("Failed to set up session ticket keys, err: -0x%x",
+			-ret);
+	}
+
+	server_ticket_ready = (ret == 0);
+}
+
+static int tls_server_ticket_write(void *p_ticket,
+				   const mbedtls_ssl_session *session,
+				   unsigned char *start,
+				   const unsigned char *end,
+				   size_t *tlen, uint32_t *lifetime)
+{
+	int ret = MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+
+	k_mutex_lock(&server_session_lock, K_FOREVER);
+
+	if (server_ticket_ready) {
+		ret = mbedtls_ssl_ticket_write(p_ticket, session, start, end,
+					       tlen, lifetime);
+	}
+
+	k_mutex_unlock(&server_session_lock);
+
+	return ret;
+}
+
+static int tls_server_ticket_parse(void *p_ticket,
+				   mbedtls_ssl_session *session,
+				   unsigned char *buf, size_t len)
+{
+	int ret = MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+
+	k_mutex_lock(&server_session_lock, K_FOREVER);
+
+	if (server_ticket_ready) {
+		ret = mbedtls_ssl_ticket_parse(p_ticket, session, buf, len);
+	}
+
+	k_mutex_unlock(&server_session_lock);
+
+	return ret;
+}
+#endif /* MBEDTLS_SSL_TICKET_C */
+
+#if defined(MBEDTLS_SSL_CACHE_C)
+static int tls_server_cache_get(void *data, mbedtls_ssl_session *session)
+{
+	int ret;
+
+	k_mutex_lock(&server_session_lock, K_FOREVER);
+	ret = mbedtls_ssl_cache_get(data, session);
+	k_mutex_unlock(&server_session_lock);
+
+	return ret;
+}
+
+static int tls_server_cache_set(void *data,
+				const mbedtls_ssl_session *session)
+{
+	int ret;
+
+	k_mutex_lock(&server_session_lock, K_FOREVER);
+	ret = mbedtls_ssl_cache_set(data, session);
+	k_mutex_unlock(&server_session_lock);
+
+	return ret;
+}
+#endif /* MBEDTLS_SSL_CACHE_C */
+
 /* Initialize TLS internals. */
 static int tls_init(const struct device *unused)
 {
@@ -342,6 +510,20 @@ static int tls_init(const struct device *unused)
 	mbedtls_ssl_cache_init(&server_cache);
 #endif
 
+#if defined(MBEDTLS_SSL_TICKET_C)
+	tls_session_ticket_setup();
+#endif
+
+#if defined(CONFIG_NET_SOCKETS_TLS_HANDSHAKE_OFFLOAD)
+	/* Handshakes are CPU intensive, run them at the lowest priority so
+	 * that they do not delay the rest of the application.
+	 */
+	k_work_queue_start(&handshake_work_q, handshake_work_q_stack,
+			   K_KERNEL_STACK_SIZEOF(handshake_work_q_stack),
+			   K_LOWEST_APPLICATION_THREAD_PRIO, NULL);
+	k_thread_name_set(&handshake_work_q.thread, "tls_handshake");
+#endif
+
 	return 0;
 }
 
@@ -424,6 +606,9 @@ static struct tls_context *tls_alloc(void)
 
 	if (tls) {
 		k_sem_init(&tls->tls_established, 0, 1);
+#if defined(CONFIG_NET_SOCKETS_TLS_HANDSHAKE_OFFLOAD)
+		k_sem_init(&tls->handshake_done, 0, 1);
+#endif
 
 		mbedtls_ssl_init(&tls->ssl);
 		mbedtls_ssl_config_init(&tls->config);
@@ -530,7 +715,50 @@ static bool peer_addr_cmp(const struct sockaddr *addr,
 	return false;
 }
 
+static uint16_t peer_addr_port(const struct sockaddr *addr)
+{
+	if (IS_ENABLED(CONFIG_NET_IPV6) && addr->sa_family == AF_INET6) {
+		return net_sin6(addr)->sin6_port;
+	} else if (IS_ENABLED(CONFIG_NET_IPV4) && addr->sa_family == AF_INET) {
+		return net_sin(addr)->sin_port;
+	}
+
+	return 0;
+}
+
+/* Sessions established with a hostname are stored for the hostname and the
+ * port, so that they can be resumed whichever address the hostname resolves
+ * to. Other sessions are stored for the peer address.
+ */
+static bool tls_session_match(const struct tls_session_cache *entry,
+			      const struct sockaddr *peer_addr,
+			      const char *hostname)
+{
+	if (hostname != NULL) {
+		return entry->hostname != NULL &&
+		       strcmp(entry->hostname, hostname) == 0 &&
+		       peer_addr_port(&entry->peer_addr) ==
+		       peer_addr_port(peer_addr);
+	}
+
+	return entry->hostname == NULL &&
+	       peer_addr_cmp(&entry->peer_addr, peer_addr);
+}
+
+static const char *tls_session_hostname(struct tls_context *context)
+{
+#if defined(MBEDTLS_X509_CRT_PARSE_C)
+	if (context->options.is_hostname_set &&
+	    context->ssl.hostname != NULL && context->ssl.hostname[0] != '\0') {
+		return context->ssl.hostname;
+	}
+#endif
+
+	return NULL;
+}
+
 static int tls_session_save(const struct sockaddr *peer_addr,
+			    const char *hostname,
 			    mbedtls_ssl_session *session)
 {
 	struct tls_session_cache *entry = NULL;
@@ -544,8 +772,9 @@ static int tls_session_save(const struct sockaddr *peer_addr,
 				entry = &client_cache[i];
 			}
 		} else {
-			if (peer_addr_cmp(&client_cache[i].peer_addr, peer_addr)) {
-				/* Reuse old entry for given address. */
+			if (tls_session_match(&client_cache[i], peer_addr,
+					      hostname)) {
+				/* Reuse old entry for given peer. */
 				entry = &client_cache[i];
 				break;
 			}
@@ -561,10 +790,7 @@ static int tls_session_save(const struct sockaddr *peer_addr,
 
 	/* Allocate session and save */
 
-	if (entry->session != NULL) {
-		mbedtls_free(entry->session);
-		entry->session = NULL;
-	}
+	tls_session_entry_free(entry);
 
 	(void)mbedtls_ssl_session_save(session, NULL, 0, &session_len);
 
@@ -578,11 +804,21 @@ static int tls_session_save(const struct sockaddr *peer_addr,
 				       &session_len);
 	if (ret < 0) {
 		NET_ERR("Failed to serialize session, err: 0x%x.", -ret);
-		mbedtls_free(entry->session);
-		entry->session = NULL;
+		tls_session_entry_free(entry);
 		return -ENOMEM;
 	}
 
+	if (hostname != NULL) {
+		entry->hostname = mbedtls_calloc(1, strlen(hostname) + 1);
+		if (entry->hostname == NULL) {
+			NET_ERR("Failed to allocate session hostname.");
+			tls_session_entry_free(entry);
+			return -ENOMEM;
+		}
+
+		strcpy(entry->hostname, hostname);
+	}
+
 	entry->session_len = session_len;
 	entry->timestamp = k_uptime_get();
 	memcpy(&entry->peer_addr, peer_addr, sizeof(*peer_addr));
@@ -591,6 +827,7 @@ static int tls_session_save(const struct sockaddr *peer_addr,
 }
 
 static int tls_session_get(const struct sockaddr *peer_addr,
+			   const char *hostname,
 			   mbedtls_ssl_session *session)
 {
 	struct tls_session_cache *entry = NULL;
@@ -598,7 +835,7 @@ static int tls_session_get(const struct sockaddr *peer_addr,
 
 	for (int i = 0; i < ARRAY_SIZE(client_cache); i++) {
 		if (client_cache[i].session != NULL &&
-		    peer_addr_cmp(&client_cache[i].peer_addr, peer_addr)) {
+		    tls_session_match(&client_cache[i], peer_addr, hostname)) {
 			entry = &client_cache[i];
 			break;
 		}
@@ -612,8 +849,7 @@ static int tls_session_get(const struct sockaddr *peer_addr,
 				       entry->session_len);
 	if (ret < 0) {
 		/* Discard corrupted session data. */
-		mbedtls_free(entry->session);
-		entry->session = NULL;
+		tls_session_entry_free(entry);
 		return -EIO;
 	}
 
@@ -641,7 +877,10 @@ static void tls_session_store(struct tls_context *context,
 		goto exit;
 	}
 
-	ret = tls_session_save(&peer_addr, &session);
+	k_mutex_lock(&client_cache_lock, K_FOREVER);
+	ret = tls_session_save(&peer_addr, tls_session_hostname(context),
+			       &session);
+	k_mutex_unlock(&client_cache_lock);
 	if (ret < 0) {
 		NET_ERR("Failed to save session for %p", context);
 	}
@@ -665,7 +904,10 @@ static void tls_session_restore(struct tls_context *context,
 	memcpy(&peer_addr, addr, addrlen);
 	mbedtls_ssl_session_init(&session);
 
-	ret = tls_session_get(&peer_addr, &session);
+	k_mutex_lock(&client_cache_lock, K_FOREVER);
+	ret = tls_session_get(&peer_addr, tls_session_hostname(context),
+			      &session);
+	k_mutex_unlock(&client_cache_lock);
 	if (ret < 0) {
 		NET_DBG("Session not found for %p", context);
 		goto exit;
@@ -682,12 +924,31 @@ exit:
 
 static void tls_session_purge(void)
 {
+	k_mutex_lock(&client_cache_lock, K_FOREVER);
 	tls_session_cache_reset();
+	k_mutex_unlock(&client_cache_lock);
+
+#if defined(MBEDTLS_SSL_CACHE_C) || defined(MBEDTLS_SSL_TICKET_C)
+	/* Wait for the handshakes using the cache or the ticket keys */
+	k_mutex_lock(&server_session_lock, K_FOREVER);
+#endif
 
 #if defined(MBEDTLS_SSL_CACHE_C)
 	mbedtls_ssl_cache_free(&server_cache);
 	mbedtls_ssl_cache_init(&server_cache);
 #endif
+
+#if defined(MBEDTLS_SSL_TICKET_C)
+	/* Renew the ticket keys, so that the tickets issued so far are no
+	 * longer accepted.
+	 */
+	mbedtls_ssl_ticket_free(&server_ticket);
+	tls_session_ticket_setup();
+#endif
+
+#if defined(MBEDTLS_SSL_CACHE_C) || defined(MBEDTLS_SSL_TICKET_C)
+	k_mutex_unlock(&server_session_lock);
+#endif
 }
 
 static inline int time_left(uint32_t start, uint32_t timeout)
@@ -830,6 +1091,162 @@ static int dtls_rx(void *ctx, unsigned char *buf, size_t len,
 
 	return received;
 }
+
+#if defined(CONFIG_NET_SOCKETS_DTLS_PKT_BIO)
+static struct net_context *dtls_net_context_get(int sock)
+{
+	const struct socket_op_vtable *vtable;
+	struct k_mutex *lock;
+	void *obj;
+
+	obj = z_get_fd_obj_and_vtable(sock,
+				      (const struct fd_op_vtable **)&vtable,
+				      &lock);
+	if (obj == NULL || vtable != &sock_fd_op_vtable) {
+		return NULL;
+	}
+
+	return obj;
+}
+
+static int dtls_pkt_tx(void *ctx, const unsigned char *buf, size_t len)
+{
+	struct tls_context *tls_ctx = ctx;
+	ssize_t sent;
+
+	if (tls_ctx->net_ctx == NULL) {
+		return dtls_tx(ctx, buf, len);
+	}
+
+	/* The record is copied once, into the packet sent by the context. */
+	sent = zsock_sendto_ctx(tls_ctx->net_ctx, buf, len, tls_ctx->flags,
+				&tls_ctx->dtls_peer_addr,
+				tls_ctx->dtls_peer_addrlen);
+	if (sent < 0) {
+		if (errno == EAGAIN) {
+			return MBEDTLS_ERR_SSL_WANT_WRITE;
+		}
+
+		return MBEDTLS_ERR_NET_SEND_FAILED;
+	}
+
+	return sent;
+}
+
+static int dtls_pkt_rx(void *ctx, unsigned char *buf, size_t len,
+		       uint32_t dtls_timeout)
+{
+	struct tls_context *tls_ctx = ctx;
+	struct net_context *net_ctx = tls_ctx->net_ctx;
+	uint32_t entry_time = k_uptime_get_32();
+	k_timeout_t timeout;
+	struct sockaddr addr;
+	socklen_t addrlen;
+	struct net_pkt *pkt;
+	size_t received;
+	int remaining;
+	int err;
+
+	/* Packets from an offloaded IP stack carry no IP header to get the
+	 * peer address from.
+	 */
+	if (net_ctx == NULL ||
+	    (IS_ENABLED(CONFIG_NET_OFFLOAD) &&
+	     net_if_is_ip_offloaded(net_context_get_iface(net_ctx)))) {
+		return dtls_rx(ctx, buf, len, dtls_timeout);
+	}
+
+	if ((tls_ctx->flags & ZSOCK_MSG_DONTWAIT) ||
+	    sock_is_nonblock(net_ctx)) {
+		timeout = K_NO_WAIT;
+	} else if (dtls_timeout == 0U) {
+		timeout = K_FOREVER;
+	} else {
+		timeout = K_MSEC(dtls_timeout);
+	}
+
+	while (true) {
+		pkt = k_fifo_get(&net_ctx->recv_q, timeout);
+		if (pkt == NULL) {
+			if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+				return MBEDTLS_ERR_SSL_WANT_READ;
+			}
+
+			/* A wait cancelled by close() or shutdown() ends
+			 * before the timeout expires.
+			 */
+			if (sock_is_eof(net_ctx) ||
+			    K_TIMEOUT_EQ(timeout, K_FOREVER) ||
+			    time_left(entry_time, dtls_timeout) > 0) {
+				return MBEDTLS_ERR_NET_RECV_FAILED;
+			}
+
+			return MBEDTLS_ERR_SSL_TIMEOUT;
+		}
+
+		err = sock_get_pkt_src_addr(pkt,
+					    net_context_get_ip_proto(net_ctx),
+					    &addr, sizeof(addr));
+		if (err < 0) {
+			net_pkt_unref(pkt);
+			return MBEDTLS_ERR_NET_RECV_FAILED;
+		}
+
+		addrlen = (addr.sa_family == AF_INET) ?
+			sizeof(struct sockaddr_in) : sizeof(struct sockaddr_in6);
+
+		if (tls_ctx->dtls_peer_addrlen == 0) {
+			/* Only allow to store peer address for DTLS servers. */
+			if (tls_ctx->options.role != MBEDTLS_SSL_IS_SERVER) {
+				net_pkt_unref(pkt);
+				return MBEDTLS_ERR_SSL_PEER_VERIFY_FAILED;
+			}
+
+			dtls_peer_address_set(tls_ctx, &addr, addrlen);
+
+			err = mbedtls_ssl_set_client_transport_id(
+				&tls_ctx->ssl,
+				(const unsigned char *)&addr, addrlen);
+			if (err < 0) {
+				net_pkt_unref(pkt);
+				return err;
+			}
+		} else if (!dtls_is_peer_addr_valid(tls_ctx, &addr, addrlen)) {
+			/* Received data from different peer, ignore it. */
+			net_pkt_unref(pkt);
+
+			if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT) &&
+			    !K_TIMEOUT_EQ(timeout, K_FOREVER)) {
+				remaining = time_left(entry_time, dtls_timeout);
+				if (remaining <= 0) {
+					return MBEDTLS_ERR_SSL_TIMEOUT;
+				}
+
+				timeout = K_MSEC(remaining);
+			}
+
+			continue;
+		}
+
+		/* A datagram carries whole records, mbed TLS decrypts them in
+		 * place in its record buffer.
+		 */
+		received = MIN(net_pkt_remaining_data(pkt), len);
+		if (net_pkt_read(pkt, buf, received)) {
+			net_pkt_unref(pkt);
+			return MBEDTLS_ERR_NET_RECV_FAILED;
+		}
+
+		if (IS_ENABLED(CONFIG_NET_PKT_RXTIME_STATS)) {
+			net_socket_update_tc_rx_time(pkt, k_cycle_get_32());
+		}
+
+		net_pkt_unref(pkt);
+
+		return received;
+	}
+}
+#endif /* CONFIG_NET_SOCKETS_DTLS_PKT_BIO */
 #endif /* CONFIG_NET_SOCKETS_ENABLE_DTLS */
 
 static int tls_tx(void *ctx, const unsigned char *buf, size_t len)
@@ -1187,6 +1604,154 @@ static int tls_mbedtls_handshake(struct tls_context *context, bool block)
 	return ret;
 }
 
+#if defined(CONFIG_NET_SOCKETS_TLS_HANDSHAKE_OFFLOAD)
+/* Resubmit the handshake work once the underlying socket has data to
+ * read, or when the remaining time of the handshake has elapsed.
+ */
+static int tls_handshake_resume_on_data(struct tls_context *context,
+					int remaining)
+{
+	struct zsock_pollfd pfd = {
+		.fd = context->sock,
+		.events = ZSOCK_POLLIN,
+	};
+	struct k_poll_event *pev = &context->handshake_event;
+	const struct fd_op_vtable *vtable;
+	k_timeout_t timeout = K_MSEC(remaining);
+	struct k_mutex *lock;
+	void *obj;
+	int ret;
+
+	obj = z_get_fd_obj_and_vtable(context->sock, &vtable, &lock);
+	if (obj == NULL) {
+		return -EBADF;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+	ret = z_fdtable_call_ioctl(vtable, obj, ZFD_IOCTL_POLL_PREPARE,
+				   &pfd, &pev, pev + 1);
+	k_mutex_unlock(lock);
+
+	if (ret == -EALREADY) {
+		/* The socket is readable already, e.g. at EOF */
+		ret = k_work_submit_to_queue(&handshake_work_q,
+					     &context->handshake_work.work);
+		return ret < 0 ? ret : 0;
+	} else if (ret < 0) {
+		return ret;
+	}
+
+	if (context->ssl.out_left > 0 &&
+	    remaining > TLS_HANDSHAKE_WRITE_RETRY_MS) {
+		timeout = K_MSEC(TLS_HANDSHAKE_WRITE_RETRY_MS);
+	}
+
+	return k_work_poll_submit_to_queue(&handshake_work_q,
+					   &context->handshake_work,
+					   &context->handshake_event, 1,
+					   timeout);
+}
+
+static void tls_handshake_work(struct k_work *work)
+{
+	struct k_work_poll *pwork = CONTAINER_OF(work, struct k_work_poll,
+						 work);
+	struct tls_context *context =
+		CONTAINER_OF(pwork, struct tls_context, handshake_work);
+	int remaining;
+	int ret;
+
+	/* Advance the handshake as far as possible without blocking on the
+	 * socket. While it waits for the peer, the work item is resubmitted
+	 * when data arrives, so that the other handshakes of the queue make
+	 * progress meanwhile.
+	 */
+	context->flags = ZSOCK_MSG_DONTWAIT;
+
+	ret = tls_mbedtls_handshake(context, false);
+	if (ret == -EAGAIN) {
+		remaining = time_left(context->handshake_start,
+				      CONFIG_NET_SOCKETS_TLS_HANDSHAKE_TIMEOUT);
+		if (context->handshake_abort) {
+			ret = -ECONNABORTED;
+		} else if (remaining <= 0) {
+			NET_ERR("TLS handshake timeout");
+			ret = -ETIMEDOUT;
+		} else {
+			ret = tls_handshake_resume_on_data(context, remaining);
+			if (ret == 0) {
+				return;
+			}
+		}
+	}
+
+	if (ret == 0 && context->handshake_peer_addrlen > 0) {
+		tls_session_store(context, &context->handshake_peer_addr,
+				  context->handshake_peer_addrlen);
+	}
+
+	context->handshake_result = ret;
+	context->handshake_offloaded = false;
+
+	k_sem_give(&context->handshake_done);
+}
+
+/* Run the handshake in the handshake thread. The peer address is used to
+ * store the session of a client, NULL for a server.
+ */
+static void tls_handshake_offload(struct tls_context *context,
+				  const struct sockaddr *addr,
+				  socklen_t addrlen)
+{
+	if (addr != NULL) {
+		memcpy(&context->handshake_peer_addr, addr, addrlen);
+		context->handshake_peer_addrlen = addrlen;
+	}
+
+	context->handshake_result = 0;
+	context->handshake_abort = false;
+	context->handshake_offloaded = true;
+	context->handshake_start = k_uptime_get_32();
+
+	k_sem_reset(&context->handshake_done);
+	k_work_poll_init(&context->handshake_work, tls_handshake_work);
+	(void)k_work_submit_to_queue(&handshake_work_q,
+				     &context->handshake_work.work);
+}
+
+/* Check whether an offloaded handshake allows the socket to be used. */
+static int tls_handshake_offload_check(struct tls_context *context)
+{
+	if (context->handshake_offloaded) {
+		return -EAGAIN;
+	}
+
+	return context->handshake_result;
+}
+
+static void tls_handshake_offload_abort(struct tls_context *context)
+{
+	struct k_work_sync sync;
+
+	context->handshake_abort = true;
+
+	/* The work either waits for data, is queued or is running. A running
+	 * handler may wait for data once more before it notices the abort
+	 * request.
+	 */
+	do {
+		(void)k_work_poll_cancel(&context->handshake_work);
+	} while (k_work_cancel_sync(&context->handshake_work.work, &sync));
+}
+
+static bool sock_is_nonblocking(int sock)
+{
+	int sock_flags = zsock_fcntl(sock, F_GETFL, 0);
+
+	return sock_flags >= 0 && (sock_flags & O_NONBLOCK);
+}
+#endif /* CONFIG_NET_SOCKETS_TLS_HANDSHAKE_OFFLOAD */
+
 static int tls_mbedtls_init(struct tls_context *context, bool is_server)
 {
 	int role, type, ret;
@@ -1202,8 +1767,13 @@ static int tls_mbedtls_init(struct tls_context *context, bool is_server)
 				    tls_tx, tls_rx, NULL);
 	} else {
 #if defined(CONFIG_NET_SOCKETS_ENABLE_DTLS)
+#if defined(CONFIG_NET_SOCKETS_DTLS_PKT_BIO)
+		mbedtls_ssl_set_bio(&context->ssl, context,
+				    dtls_pkt_tx, NULL, dtls_pkt_rx);
+#else
 		mbedtls_ssl_set_bio(&context->ssl, context,
 				    dtls_tx, NULL, dtls_rx);
+#endif
 #else
 		return -ENOTSUP;
 #endif /* CONFIG_NET_SOCKETS_ENABLE_DTLS */
@@ -1305,8 +1875,18 @@ static int tls_mbedtls_init(struct tls_context *context, bool is_server)
 #if defined(MBEDTLS_SSL_CACHE_C)
 	if (is_server && context->options.cache_enabled) {
 		mbedtls_ssl_conf_session_cache(&context->config, &server_cache,
-					       mbedtls_ssl_cache_get,
-					       mbedtls_ssl_cache_set);
+					       tls_server_cache_get,
+					       tls_server_cache_set);
+	}
+#endif
+
+#if defined(MBEDTLS_SSL_TICKET_C)
+	if (is_server && context->options.cache_enabled &&
+	    server_ticket_ready) {
+		mbedtls_ssl_conf_session_tickets_cb(&context->config,
+						    tls_server_ticket_write,
+						    tls_server_ticket_parse,
+						    &server_ticket);
 	}
 #endif
 
@@ -1773,6 +2353,12 @@ static int ztls_socket(int family, int type, int proto)
 	ctx->type = (proto == IPPROTO_TCP) ? SOCK_STREAM : SOCK_DGRAM;
 	ctx->sock = sock;
 
+#if defined(CONFIG_NET_SOCKETS_DTLS_PKT_BIO)
+	if (ctx->type == SOCK_DGRAM) {
+		ctx->net_ctx = dtls_net_context_get(sock);
+	}
+#endif
+
 	z_finalize_fd(
 		fd, ctx, (const struct fd_op_vtable *)&tls_sock_fd_op_vtable);
 
@@ -1791,6 +2377,12 @@ int ztls_close_ctx(struct tls_context *ctx)
 {
 	int ret, err = 0;
 
+#if defined(CONFIG_NET_SOCKETS_TLS_HANDSHAKE_OFFLOAD)
+	if (ctx->handshake_offloaded) {
+		tls_handshake_offload_abort(ctx);
+	}
+#endif
+
 	/* Try to send close notification. */
 	ctx->flags = 0;
 
@@ -1833,9 +2425,14 @@ int ztls_connect_ctx(struct tls_context *ctx, const struct sockaddr *addr,
 
 		tls_session_restore(ctx, addr, addrlen);
 
-		/* TODO For simplicity, TLS handshake blocks the socket
-		 * even for non-blocking socket.
-		 */
+#if defined(CONFIG_NET_SOCKETS_TLS_HANDSHAKE_OFFLOAD)
+		if (sock_is_nonblocking(ctx->sock)) {
+			tls_handshake_offload(ctx, addr, addrlen);
+			ret = -EINPROGRESS;
+			goto error;
+		}
+#endif
+
 		ret = tls_mbedtls_handshake(ctx, true);
 		if (ret < 0) {
 			goto error;
@@ -1895,9 +2492,13 @@ int ztls_accept_ctx(struct tls_context *parent, struct sockaddr *addr,
 	/* Do not use any socket flags during the handshake. */
 	child->flags = 0;
 
-	/* TODO For simplicity, TLS handshake blocks the socket even for
-	 * non-blocking socket.
-	 */
+#if defined(CONFIG_NET_SOCKETS_TLS_HANDSHAKE_OFFLOAD)
+	if (sock_is_nonblocking(parent->sock)) {
+		tls_handshake_offload(child, NULL, 0);
+		return fd;
+	}
+#endif
+
 	ret = tls_mbedtls_handshake(child, true);
 	if (ret < 0) {
 		goto error;
@@ -1981,8 +2582,8 @@ static ssize_t sendto_dtls_client(struct tls_context *ctx, const void *buf,
 		tls_session_restore(ctx, &ctx->dtls_peer_addr,
 				    ctx->dtls_peer_addrlen);
 
-		/* TODO For simplicity, TLS handshake blocks the socket even for
-		 * non-blocking socket.
+		/* The DTLS client handshake is not offloaded, it blocks
+		 * until the first datagram can be sent.
 		 */
 		ret = tls_mbedtls_handshake(ctx, true);
 		if (ret < 0) {
@@ -2028,6 +2629,15 @@ ssize_t ztls_sendto_ctx(struct tls_context *ctx, const void *buf, size_t len,
 			int flags, const struct sockaddr *dest_addr,
 			socklen_t addrlen)
 {
+#if defined(CONFIG_NET_SOCKETS_TLS_HANDSHAKE_OFFLOAD)
+	int ret = tls_handshake_offload_check(ctx);
+
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+#endif
+
 	ctx->flags = flags;
 
 	/* TLS */
@@ -2325,6 +2935,15 @@ ssize_t ztls_recvfrom_ctx(struct tls_context *ctx, void *buf, size_t max_len,
 			  int flags, struct sockaddr *src_addr,
 			  socklen_t *addrlen)
 {
+#if defined(CONFIG_NET_SOCKETS_TLS_HANDSHAKE_OFFLOAD)
+	int ret = tls_handshake_offload_check(ctx);
+
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+#endif
+
 	if (flags & ZSOCK_MSG_PEEK) {
 		/* TODO mbedTLS does not support 'peeking' This could be
 		 * bypassed by having intermediate buffer for peeking
@@ -2399,6 +3018,26 @@ static int ztls_poll_prepare_ctx(struct tls_context *ctx,
 		pfd->events &= ~ZSOCK_POLLIN;
 	}
 
+#if defined(CONFIG_NET_SOCKETS_TLS_HANDSHAKE_OFFLOAD)
+	/* A socket with an offloaded handshake in progress is neither
+	 * readable nor writable until the handshake completes.
+	 */
+	if ((pfd->events & (ZSOCK_POLLIN | ZSOCK_POLLOUT)) &&
+	    ctx->handshake_offloaded) {
+		if (*pev == pev_end) {
+			return -ENOMEM;
+		}
+
+		(*pev)->obj = &ctx->handshake_done;
+		(*pev)->type = K_POLL_TYPE_SEM_AVAILABLE;
+		(*pev)->mode = K_POLL_MODE_NOTIFY_ONLY;
+		(*pev)->state = K_POLL_STATE_NOT_READY;
+		(*pev)++;
+
+		pfd->events &= ~(ZSOCK_POLLIN | ZSOCK_POLLOUT);
+	}
+#endif
+
 	obj = z_get_fd_obj_and_vtable(
 		ctx->sock, (const struct fd_op_vtable **)&vtable, &lock);
 	if (obj == NULL) {
@@ -2418,6 +3057,13 @@ static int ztls_poll_prepare_ctx(struct tls_context *ctx,
 		ret = ztls_poll_prepare_pollin(ctx);
 	}
 
+#if defined(CONFIG_NET_SOCKETS_TLS_HANDSHAKE_OFFLOAD)
+	/* A failed handshake is reported right away. */
+	if (ret == 0 && ctx->handshake_result < 0) {
+		ret = -EALREADY;
+	}
+#endif
+
 exit:
 	/* Restore original events. */
 	pfd->events = events;
@@ -2562,12 +3208,53 @@ static int ztls_poll_update_ctx(struct tls_context *ctx,
 		pfd->events &= ~ZSOCK_POLLIN;
 	}
 
+#if defined(CONFIG_NET_SOCKETS_TLS_HANDSHAKE_OFFLOAD)
+	/* Check if the socket was waiting for the offloaded handshake. */
+	if ((pfd->events & (ZSOCK_POLLIN | ZSOCK_POLLOUT)) &&
+	    ((*pev)->obj == &ctx->handshake_done)) {
+		bool complete = (*pev)->state != K_POLL_STATE_NOT_READY &&
+				ctx->handshake_result == 0;
+
+		if (complete && !(pfd->events & ZSOCK_POLLOUT)) {
+			/* Reconfigure the k_poll_event to monitor the
+			 * underlying socket for incoming data now.
+			 */
+			ret = z_fdtable_call_ioctl(vtable, obj,
+						   ZFD_IOCTL_POLL_PREPARE,
+						   pfd, pev, *pev + 1);
+			if (ret != 0 && ret != -EALREADY) {
+				goto out;
+			}
+
+			ret = -EAGAIN;
+			goto out;
+		}
+
+		if (complete) {
+			pfd->revents |= ZSOCK_POLLOUT;
+		}
+
+		/* Skip ZSOCK_POLLIN and ZSOCK_POLLOUT verification for the
+		 * underlying socket, which was not polled for them.
+		 */
+		(*pev)++;
+		pfd->events &= ~(ZSOCK_POLLIN | ZSOCK_POLLOUT);
+	}
+#endif
+
 	ret = z_fdtable_call_ioctl(vtable, obj, ZFD_IOCTL_POLL_UPDATE,
 				   pfd, pev);
 	if (ret != 0) {
 		goto exit;
 	}
 
+#if defined(CONFIG_NET_SOCKETS_TLS_HANDSHAKE_OFFLOAD)
+	if (ctx->handshake_result < 0) {
+		pfd->revents |= ZSOCK_POLLERR;
+		goto exit;
+	}
+#endif
+
 	if (pfd->events & ZSOCK_POLLIN) {
 		ret = ztls_poll_update_pollin(pfd->fd, ctx, pfd);
 		if (ret == -EAGAIN && pfd->revents != 0) {
@@ -75,8 +75,253 @@ static enum net_verdict evaluate(sys_slist_t *rule_head, struct net_pkt *pkt)
 	return NET_DROP;
 }
 
+#if defined(CONFIG_NET_PKT_FILTER_COMPILE)
+
+/*
+ * Compiled rule lists
+ *
+ * Each rule is laid out as one instruction per test followed by a return
+ * of its verdict. A test which passes moves on to the next instruction,
+ * one which fails jumps to the first following rule which does not contain
+ * the same test, as it would fail there as well. Built-in tests are not
+ * called through their function pointer.
+ */
+
+enum npf_op {
+	NPF_OP_RETURN,
+	NPF_OP_IFACE,
+	NPF_OP_ORIG_IFACE,
+	NPF_OP_SIZE,
+	NPF_OP_ETH_SRC,
+	NPF_OP_ETH_DST,
+	NPF_OP_ETH_TYPE,
+	NPF_OP_CALL,
+};
+
+/* Test result is inverted */
+#define NPF_OP_INVERT BIT(7)
+
+static const struct {
+	npf_test_fn_t *fn;
+	uint8_t op;
+} npf_ops[] = {
+	{ npf_iface_match, NPF_OP_IFACE },
+	{ npf_iface_unmatch, NPF_OP_IFACE | NPF_OP_INVERT },
+	{ npf_orig_iface_match, NPF_OP_ORIG_IFACE },
+	{ npf_orig_iface_unmatch, NPF_OP_ORIG_IFACE | NPF_OP_INVERT },
+	{ npf_size_inbounds, NPF_OP_SIZE },
+#if defined(CONFIG_NET_L2_ETHERNET)
+	{ npf_eth_src_addr_match, NPF_OP_ETH_SRC },
+	{ npf_eth_src_addr_unmatch, NPF_OP_ETH_SRC | NPF_OP_INVERT },
+	{ npf_eth_dst_addr_match, NPF_OP_ETH_DST },
+	{ npf_eth_dst_addr_unmatch, NPF_OP_ETH_DST | NPF_OP_INVERT },
+	{ npf_eth_type_match, NPF_OP_ETH_TYPE },
+	{ npf_eth_type_unmatch, NPF_OP_ETH_TYPE | NPF_OP_INVERT },
+#endif
+};
+
+static K_MUTEX_DEFINE(npf_update_lock);
+
+static uint8_t test_op(struct npf_test *test)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(npf_ops); i++) {
+		if (npf_ops[i].fn == test->fn) {
+			return npf_ops[i].op;
+		}
+	}
+
+	return NPF_OP_CALL;
+}
+
+static bool rule_has_test(struct npf_rule *rule, struct npf_test *test)
+{
+	for (unsigned int i = 0; i < rule->nb_tests; i++) {
+		if (rule->tests[i] == test) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/*
+ * Where to go when a test of the rule starting at the given offset fails.
+ * Other tests may depend on more than the packet, so only built-in ones
+ * can be assumed to fail again.
+ */
+static uint16_t fail_target(struct npf_rule *rule, uint16_t offset,
+			    struct npf_test *test, uint8_t op)
+{
+	uint32_t target = offset + rule->nb_tests + 1;
+
+	if (op == NPF_OP_CALL) {
+		return target;
+	}
+
+	while ((rule = SYS_SLIST_PEEK_NEXT_CONTAINER(rule, node)) != NULL &&
+	       rule_has_test(rule, test)) {
+		target += rule->nb_tests + 1;
+	}
+
+	return target;
+}
+
+static bool compile(sys_slist_t *rule_head, struct npf_program *prog)
+{
+	struct npf_insn *insn = prog->insns;
+	struct npf_rule *rule;
+	uint32_t len = 1;
+	uint16_t offset;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(rule_head, rule, node) {
+		len += rule->nb_tests + 1;
+
+		/* Also stops on a list made circular by a rule inserted twice */
+		if (len > ARRAY_SIZE(prog->insns)) {
+			NET_WARN("rule list %p too large to be compiled",
+				 rule_head);
+			return false;
+		}
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(rule_head, rule, node) {
+		offset = insn - prog->insns;
+
+		for (unsigned int i = 0; i < rule->nb_tests; i++) {
+			insn->test = rule->tests[i];
+			insn->op = test_op(insn->test);
+			insn->fail = fail_target(rule, offset, insn->test,
+						 insn->op & ~NPF_OP_INVERT);
+			insn++;
+		}
+
+		insn->op = NPF_OP_RETURN;
+		insn->result = rule->result;
+		insn++;
+	}
+
+	/* If no rules then it is accepted, else no rule matched */
+	insn->op = NPF_OP_RETURN;
+	insn->result = sys_slist_is_empty(rule_head) ? NET_OK : NET_DROP;
+
+	return true;
+}
+
+static enum net_verdict run(const struct npf_program *prog,
+			    struct net_pkt *pkt)
+{
+	const struct npf_insn *insn = prog->insns;
+	struct npf_test_size_bounds *bounds;
+	size_t pkt_size = SIZE_MAX;
+	bool result;
+
+	while (true) {
+		switch (insn->op & ~NPF_OP_INVERT) {
+		case NPF_OP_RETURN:
+			return insn->result;
+		case NPF_OP_IFACE:
+			result = CONTAINER_OF(insn->test, struct npf_test_iface,
+					      test)->iface == net_pkt_iface(pkt);
+			break;
+		case NPF_OP_ORIG_IFACE:
+			result = CONTAINER_OF(insn->test, struct npf_test_iface,
+					      test)->iface ==
+				net_pkt_orig_iface(pkt);
+			break;
+		case NPF_OP_SIZE:
+			bounds = CONTAINER_OF(insn->test,
+					      struct npf_test_size_bounds, test);
+			if (pkt_size == SIZE_MAX) {
+				pkt_size = net_pkt_get_len(pkt);
+			}
+
+			result = pkt_size >= bounds->min &&
+				 pkt_size <= bounds->max;
+			break;
+#if defined(CONFIG_NET_L2_ETHERNET)
+		case NPF_OP_ETH_SRC:
+			result = npf_eth_src_addr_match(insn->test, pkt);
+			break;
+		case NPF_OP_ETH_DST:
+			result = npf_eth_dst_addr_match(insn->test, pkt);
+			break;
+		case NPF_OP_ETH_TYPE:
+			result = NET_ETH_HDR(pkt)->type ==
+				CONTAINER_OF(insn->test,
+					     struct npf_test_eth_type,
+					     test)->type;
+			break;
+#endif
+		default:
+			result = insn->test->fn(insn->test, pkt);
+			break;
+		}
+
+		if (insn->op & NPF_OP_INVERT) {
+			result = !result;
+		}
+
+		insn = result ? insn + 1 : &prog->insns[insn->fail];
+	}
+}
+
+/*
+ * Rule lists are modified with the update lock held, and compiled into
+ * the program not in use once modified. Packets are filtered with the
+ * published program without taking any lock: the one it replaces is
+ * only reused after a grace period.
+ */
+static void update_begin(void)
+{
+	(void)k_mutex_lock(&npf_update_lock, K_FOREVER);
+}
+
+static void update_end(struct npf_rule_list *rules)
+{
+	struct npf_program *prog = (rules->prog == &rules->progs[0]) ?
+				   &rules->progs[1] : &rules->progs[0];
+
+	if (!compile(&rules->rule_head, prog)) {
+		prog = NULL;
+	}
+
+	k_rcu_assign_pointer(rules->prog, prog);
+	k_rcu_synchronize();
+
+	k_mutex_unlock(&npf_update_lock);
+}
+
+#else
+
+static inline void update_begin(void)
+{
+}
+
+static inline void update_end(struct npf_rule_list *rules)
+{
+	ARG_UNUSED(rules);
+}
+
+#endif /* CONFIG_NET_PKT_FILTER_COMPILE */
+
 static enum net_verdict lock_evaluate(struct npf_rule_list *rules, struct net_pkt *pkt)
 {
+#if defined(CONFIG_NET_PKT_FILTER_COMPILE)
+	const struct npf_program *prog;
+	enum net_verdict verdict;
+
+	k_rcu_read_lock();
+
+	prog = k_rcu_dereference(rules->prog);
+	if (prog != NULL) {
+		verdict = run(prog, pkt);
+		k_rcu_read_unlock();
+		return verdict;
+	}
+
+	k_rcu_read_unlock();
+#endif
+
 	k_spinlock_key_t key = k_spin_lock(&rules->lock);
 	enum net_verdict result = evaluate(&rules->rule_head, pkt);
 
@@ -104,12 +349,16 @@ bool net_pkt_filter_recv_ok(struct net_pkt *pkt)
 
 void npf_insert_rule(struct npf_rule_list *rules, struct npf_rule *rule)
 {
+	update_begin();
+
 	k_spinlock_key_t key = k_spin_lock(&rules->lock);
 
 	NET_DBG("inserting rule %p into %p", rule, rules);
 	sys_slist_prepend(&rules->rule_head, &rule->node);
 
 	k_spin_unlock(&rules->lock, key);
+
+	update_end(rules);
 }
 
 void npf_append_rule(struct npf_rule_list *rules, struct npf_rule *rule)
@@ -117,26 +366,36 @@ void npf_append_rule(struct npf_rule_list *rules, struct npf_rule *rule)
 	__ASSERT(sys_slist_peek_tail(&rules->rule_head) != &npf_default_ok.node, "");
 	__ASSERT(sys_slist_peek_tail(&rules->rule_head) != &npf_default_drop.node, "");
 
+	update_begin();
+
 	k_spinlock_key_t key = k_spin_lock(&rules->lock);
 
 	NET_DBG("appending rule %p into %p", rule, rules);
 	sys_slist_append(&rules->rule_head, &rule->node);
 
 	k_spin_unlock(&rules->lock, key);
+
+	update_end(rules);
 }
 
 bool npf_remove_rule(struct npf_rule_list *rules, struct npf_rule *rule)
 {
+	update_begin();
+
 	k_spinlock_key_t key = k_spin_lock(&rules->lock);
 	bool result = sys_slist_find_and_remove(&rules->rule_head, &rule->node);
 
 	k_spin_unlock(&rules->lock, key);
+
+	update_end(rules);
 	NET_DBG("removing rule %p from %p: %d", rule, rules, result);
 	return result;
 }
 
 bool npf_remove_all_rules(struct npf_rule_list *rules)
 {
+	update_begin();
+
 	k_spinlock_key_t key = k_spin_lock(&rules->lock);
 	bool result = !sys_slist_is_empty(&rules->rule_head);
 
@@ -146,6 +405,8 @@ bool npf_remove_all_rules(struct npf_rule_list *rules)
 	}
 
 	k_spin_unlock(&rules->lock, key);
+
+	update_end(rules);
 	return result;
 }
 
@@ -15,9 +15,20 @@
 extern "C" {
 #endif
 
+#ifdef CONFIG_SETTINGS_FCB_NAME_MAP
+struct settings_fcb_name {
+	uint32_t cn_hash;
+	struct fcb_entry cn_loc; /* Latest entry, fe_sector is NULL if unused */
+};
+#endif
+
 struct settings_fcb {
 	struct settings_store cf_store;
 	struct fcb cf_fcb;
+#ifdef CONFIG_SETTINGS_FCB_NAME_MAP
+	struct settings_fcb_name cf_names[CONFIG_SETTINGS_FCB_NAME_MAP_SIZE];
+	bool cf_names_valid;
+#endif
 };
 
 extern int settings_fcb_src(struct settings_fcb *cf);
@@ -8,6 +8,7 @@
 #include <errno.h>
 #include <stdbool.h>
 #include <zephyr/fs/fcb.h>
+#include <zephyr/sys/crc.h>
 #include <string.h>
 
 #include "settings/settings.h"
@@ -44,6 +45,9 @@ int settings_fcb_src(struct settings_fcb *cf)
 
 	cf->cf_fcb.f_version = SETTINGS_FCB_VERS;
 	cf->cf_fcb.f_scratch_cnt = 1;
+#ifdef CONFIG_SETTINGS_FCB_NAME_MAP
+	cf->cf_names_valid = false;
+#endif
 
 	while (1) {
 		rc = fcb_init(SETTINGS_PARTITION, &cf->cf_fcb);
@@ -78,12 +82,138 @@ int settings_fcb_src(struct settings_fcb *cf)
 
 int settings_fcb_dst(struct settings_fcb *cf)
 {
+#ifdef CONFIG_SETTINGS_FCB_NAME_MAP
+	cf->cf_names_valid = false;
+#endif
 	cf->cf_store.cs_itf = &settings_fcb_itf;
 	settings_dst_register(&cf->cf_store);
 
 	return 0;
 }
 
+#ifdef CONFIG_SETTINGS_FCB_NAME_MAP
+static uint32_t name_hash(const char *name)
+{
+	return crc32_ieee((const uint8_t *)name, strlen(name));
+}
+
+static inline struct settings_fcb_name *name_map_slot(struct settings_fcb *cf,
+						      uint32_t hash, int i)
+{
+	return &cf->cf_names[(hash + i) % CONFIG_SETTINGS_FCB_NAME_MAP_SIZE];
+}
+
+/*
+ * Find the map slot of a name, or if insert is set the free slot where it
+ * is to be added. Returns NULL if the name is not found or the map is full.
+ */
+static struct settings_fcb_name *name_map_find(struct settings_fcb *cf,
+					       const char *name, bool insert)
+{
+	uint32_t hash = name_hash(name);
+
+	for (int i = 0; i < CONFIG_SETTINGS_FCB_NAME_MAP_SIZE; i++) {
+		struct settings_fcb_name *slot = name_map_slot(cf, hash, i);
+		struct fcb_entry_ctx entry_ctx = {
+			.loc = slot->cn_loc,
+			.fap = cf->cf_fcb.fap
+		};
+		char name2[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+		size_t name2_len;
+
+		if (slot->cn_loc.fe_sector == NULL) {
+			if (insert) {
+				slot->cn_hash = hash;
+				return slot;
+			}
+			return NULL;
+		}
+
+		if ((slot->cn_hash != hash) ||
+		    settings_line_name_read(name2, sizeof(name2), &name2_len,
+					    &entry_ctx)) {
+			continue;
+		}
+		name2[name2_len] = '\0';
+		if (!strcmp(name, name2)) {
+			return slot;
+		}
+	}
+
+	return NULL;
+}
+
+/*
+ * Check whether an entry is the latest one of its name. This only compares
+ * locations, so no other entry has to be read.
+ */
+static bool name_map_is_latest(struct settings_fcb *cf, const char *name,
+			       const struct fcb_entry *loc)
+{
+	uint32_t hash = name_hash(name);
+
+	for (int i = 0; i < CONFIG_SETTINGS_FCB_NAME_MAP_SIZE; i++) {
+		struct settings_fcb_name *slot = name_map_slot(cf, hash, i);
+
+		if (slot->cn_loc.fe_sector == NULL) {
+			break;
+		}
+		if ((slot->cn_hash == hash) &&
+		    (slot->cn_loc.fe_sector == loc->fe_sector) &&
+		    (slot->cn_loc.fe_elem_off == loc->fe_elem_off)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void name_map_update(struct settings_fcb *cf, const char *name,
+			    const struct fcb_entry *loc)
+{
+	struct settings_fcb_name *slot = name_map_find(cf, name, true);
+
+	if (slot == NULL) {
+		LOG_DBG("name map full");
+		cf->cf_names_valid = false;
+		return;
+	}
+
+	slot->cn_loc = *loc;
+}
+
+/* Build the map with one walk over the FCB if it is not valid */
+static bool name_map_ready(struct settings_fcb *cf)
+{
+	struct fcb_entry_ctx entry_ctx = {
+		{.fe_sector = NULL, .fe_elem_off = 0},
+		.fap = cf->cf_fcb.fap
+	};
+
+	if (cf->cf_names_valid) {
+		return true;
+	}
+
+	memset(cf->cf_names, 0, sizeof(cf->cf_names));
+	cf->cf_names_valid = true;
+
+	while (cf->cf_names_valid &&
+	       fcb_getnext(&cf->cf_fcb, &entry_ctx.loc) == 0) {
+		char name[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+		size_t name_len;
+
+		if (settings_line_name_read(name, sizeof(name), &name_len,
+					    &entry_ctx)) {
+			continue;
+		}
+		name[name_len] = '\0';
+		name_map_update(cf, name, &entry_ctx.loc);
+	}
+
+	return cf->cf_names_valid;
+}
+#endif /* CONFIG_SETTINGS_FCB_NAME_MAP */
+
 /**
  * @brief Check if there is any duplicate of the current setting
  *
@@ -102,6 +232,12 @@ static bool settings_fcb_check_duplicate(struct settings_fcb *cf,
 {
 	struct fcb_entry_ctx entry2_ctx = *entry_ctx;
 
+#ifdef CONFIG_SETTINGS_FCB_NAME_MAP
+	if (cf->cf_names_valid) {
+		return !name_map_is_latest(cf, name, &entry_ctx->loc);
+	}
+#endif
+
 	while (fcb_getnext(&cf->cf_fcb, &entry2_ctx.loc) == 0) {
 		char name2[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
 		size_t name2_len;
@@ -139,6 +275,12 @@ static int settings_fcb_load_priv(struct settings_store *cs,
 	};
 	int rc;
 
+#ifdef CONFIG_SETTINGS_FCB_NAME_MAP
+	if (filter_duplicates) {
+		(void)name_map_ready(cf);
+	}
+#endif
+
 	while ((rc = fcb_getnext(&cf->cf_fcb, &entry_ctx.loc)) == 0) {
 		char name[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
 		size_t name_len;
@@ -203,9 +345,7 @@ static void settings_fcb_compress(struct settings_fcb *cf)
 	int rc;
 	struct fcb_entry_ctx loc1;
 	struct fcb_entry_ctx loc2;
-	char name1[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN];
-	char name2[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN];
-	int copy;
+	char name1[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
 	uint8_t rbs;
 
 	rc = fcb_append_to_scratch(&cf->cf_fcb);
@@ -213,6 +353,10 @@ static void settings_fcb_compress(struct settings_fcb *cf)
 		return; /* XXX */
 	}
 
+#ifdef CONFIG_SETTINGS_FCB_NAME_MAP
+	(void)name_map_ready(cf);
+#endif
+
 	rbs = flash_area_align(cf->cf_fcb.fap);
 
 	loc1.fap = cf->cf_fcb.fap;
@@ -240,31 +384,15 @@ static void settings_fcb_compress(struct settings_fcb *cf)
 			continue;
 		}
 
-		loc2 = loc1;
-		copy = 1;
-
-		while (fcb_getnext(&cf->cf_fcb, &loc2.loc) == 0) {
-			size_t val2_off;
-
-			rc = settings_line_name_read(name2, sizeof(name2),
-						     &val2_off, &loc2);
-			if (rc) {
-				continue;
-			}
-
-			if ((val1_off == val2_off) &&
-			    !memcmp(name1, name2, val1_off)) {
-				copy = 0;
-				break;
-			}
-		}
-		if (!copy) {
+		name1[val1_off] = '\0';
+		if (settings_fcb_check_duplicate(cf, &loc1, name1)) {
 			continue;
 		}
 
 		/*
 		 * Can't find one. Must copy.
 		 */
+		loc2 = loc1;
 		rc = fcb_append(&cf->cf_fcb, loc1.loc.fe_data_len, &loc2.loc);
 		if (rc) {
 			continue;
@@ -286,6 +414,11 @@ static void settings_fcb_compress(struct settings_fcb *cf)
 	if (rc != 0) {
 		LOG_ERR("Failed to fcb rotate (%d)", rc);
 	}
+
+#ifdef CONFIG_SETTINGS_FCB_NAME_MAP
+	/* Names whose latest entry was erased would be left behind */
+	cf->cf_names_valid = false;
+#endif
 }
 
 static size_t get_len_cb(void *ctx)
@@ -347,9 +480,45 @@ static int settings_fcb_save_priv(struct settings_store *cs, const char *name,
 			rc = i;
 		}
 	}
+
+#ifdef CONFIG_SETTINGS_FCB_NAME_MAP
+	if (rc == 0 && cf->cf_names_valid) {
+		name_map_update(cf, name, &loc.loc);
+	} else {
+		cf->cf_names_valid = false;
+	}
+#endif
+
 	return rc;
 }
 
+static void settings_fcb_dup_check(struct settings_store *cs,
+				   struct settings_line_dup_check_arg *cdca)
+{
+#ifdef CONFIG_SETTINGS_FCB_NAME_MAP
+	struct settings_fcb *cf = (struct settings_fcb *)cs;
+
+	if (name_map_ready(cf)) {
+		struct settings_fcb_name *slot;
+		struct fcb_entry_ctx entry_ctx = {
+			.fap = cf->cf_fcb.fap
+		};
+
+		/* Only the latest entry of the name matters */
+		slot = name_map_find(cf, cdca->name, false);
+		if (slot != NULL) {
+			entry_ctx.loc = slot->cn_loc;
+			(void)settings_line_dup_check_cb(cdca->name, &entry_ctx,
+							 strlen(cdca->name) + 1,
+							 cdca);
+		}
+		return;
+	}
+#endif
+
+	settings_fcb_load_priv(cs, settings_line_dup_check_cb, cdca, false);
+}
+
 static int settings_fcb_save(struct settings_store *cs, const char *name,
 			     const char *value, size_t val_len)
 {
@@ -366,7 +535,7 @@ static int settings_fcb_save(struct settings_store *cs, const char *name,
 	cdca.val = (char *)value;
 	cdca.is_dup = 0;
 	cdca.val_len = val_len;
-	settings_fcb_load_priv(cs, settings_line_dup_check_cb, &cdca, false);
+	settings_fcb_dup_check(cs, &cdca);
 	if (cdca.is_dup == 1) {
 		return 0;
 	}
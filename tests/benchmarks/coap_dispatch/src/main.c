@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/zephyr.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/net/coap.h>
+#include <stdio.h>
+
+/* CoAP request dispatch benchmark.
+ *
+ * A server with an increasing number of resources handles GET requests
+ * spread evenly over its resources, with coap_handle_request(), which
+ * compares the request path with the path of each resource in turn, and
+ * with coap_handle_request_index(), which looks the resource up in a hash
+ * index. Each request is parsed before being dispatched, as a server does
+ * for every packet it receives.
+ */
+
+#define MAX_RESOURCES	1024
+#define N_SAMPLES	16
+#define N_REQUESTS	2000
+#define BUF_SIZE	32
+#define MAX_OPTIONS	4
+
+static struct coap_resource resources[MAX_RESOURCES + 1];
+static const char *paths[MAX_RESOURCES][3];
+static char names[MAX_RESOURCES][5];
+
+COAP_RESOURCE_INDEX_DEFINE(resource_index, MAX_RESOURCES, MAX_RESOURCES);
+
+static uint8_t samples[N_SAMPLES][BUF_SIZE];
+static uint16_t sample_lens[N_SAMPLES];
+static uint8_t request_buf[BUF_SIZE];
+
+static struct sockaddr_in6 peer_addr = { .sin6_family = AF_INET6 };
+static uint32_t handled;
+
+static int resource_get(struct coap_resource *resource,
+			struct coap_packet *request,
+			struct sockaddr *addr, socklen_t addr_len)
+{
+	handled++;
+
+	return 0;
+}
+
+static void build_resources(void)
+{
+	for (int i = 0; i < MAX_RESOURCES; i++) {
+		snprintf(names[i], sizeof(names[i]), "%d", i);
+		paths[i][0] = "res";
+		paths[i][1] = names[i];
+		paths[i][2] = NULL;
+		resources[i].path = paths[i];
+		resources[i].get = resource_get;
+	}
+}
+
+static void build_samples(int n)
+{
+	struct coap_packet req;
+
+	for (int i = 0; i < N_SAMPLES; i++) {
+		const char * const *path = paths[(i * n) / N_SAMPLES];
+
+		coap_packet_init(&req, samples[i], BUF_SIZE, COAP_VERSION_1,
+				 COAP_TYPE_CON, 0, NULL, COAP_METHOD_GET,
+				 coap_next_id());
+
+		for (; *path; path++) {
+			coap_packet_append_option(&req, COAP_OPTION_URI_PATH,
+						  *path, strlen(*path));
+		}
+
+		sample_lens[i] = req.offset;
+	}
+}
+
+static int dispatch(int i, bool use_index)
+{
+	struct coap_option options[MAX_OPTIONS];
+	struct coap_packet req;
+	int r;
+
+	memcpy(request_buf, samples[i], sample_lens[i]);
+
+	r = coap_packet_parse(&req, request_buf, sample_lens[i], options,
+			      MAX_OPTIONS);
+	if (r < 0) {
+		return r;
+	}
+
+	if (use_index) {
+		return coap_handle_request_index(&req, &resource_index,
+						 options, MAX_OPTIONS,
+						 (struct sockaddr *)&peer_addr,
+						 sizeof(peer_addr));
+	}
+
+	return coap_handle_request(&req, resources, options, MAX_OPTIONS,
+				   (struct sockaddr *)&peer_addr,
+				   sizeof(peer_addr));
+}
+
+static void run(int n, bool use_index)
+{
+	timing_t start, end;
+	uint64_t ns;
+
+	handled = 0U;
+
+	start = timing_counter_get();
+
+	for (int i = 0; i < N_REQUESTS; i++) {
+		if (dispatch(i % N_SAMPLES, use_index) < 0) {
+			printk("dispatch failed\n");
+			return;
+		}
+	}
+
+	end = timing_counter_get();
+
+	ns = timing_cycles_to_ns(timing_cycles_get(&start, &end));
+
+	printk("%d resources, %s: %u requests/s (%u handled)\n", n,
+	       use_index ? "index" : "linear",
+	       (uint32_t)(((uint64_t)N_REQUESTS * NSEC_PER_SEC) / MAX(ns, 1U)),
+	       handled);
+}
+
+void main(void)
+{
+	static const int counts[] = { 16, 64, 256, 1024 };
+
+	build_resources();
+
+	timing_init();
+	timing_start();
+
+	for (int i = 0; i < ARRAY_SIZE(counts); i++) {
+		int n = counts[i];
+
+		/* Terminate the array after the first n resources */
+		resources[n].path = NULL;
+		coap_resource_index_init(&resource_index, resources);
+
+		build_samples(n);
+
+		run(n, false);
+		run(n, true);
+
+		if (n < MAX_RESOURCES) {
+			resources[n].path = paths[n];
+		}
+	}
+
+	timing_stop();
+
+	printk("fin\n");
+}
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/zephyr.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/tls_credentials.h>
+#include <zephyr/net/coap.h>
+#include <mbedtls/memory_buffer_alloc.h>
+
+/* CoAP over DTLS benchmark.
+ *
+ * A DTLS server on the loopback interface answers CoAP GET requests with a
+ * piggybacked response carrying a payload of the size being measured. The
+ * client establishes a single DTLS session with a PSK ciphersuite and sends
+ * confirmable requests one after the other, waiting for each response,
+ * which measures the round trip through both ends of the DTLS socket layer.
+ *
+ * The mbed TLS heap usage is reported once the runs complete, with the peak
+ * covering the record processing only, not the handshake. Build with
+ * CONFIG_NET_SOCKETS_DTLS_PKT_BIO enabled and disabled to compare the two
+ * ways records are exchanged with the UDP sockets.
+ */
+
+#define N_REQUESTS	1000
+#define SERVER_PORT	5684
+#define PSK_TAG		1
+#define STACK_SIZE	8192
+#define MAX_PAYLOAD	512
+#define BUF_SIZE	(MAX_PAYLOAD + 64)
+
+/* TLS-PSK-WITH-AES-128-GCM-SHA256 */
+#define CIPHERSUITE	0x00A8
+
+static const unsigned char psk[] = {
+	0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+	0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+};
+static const char psk_id[] = "bench_identity";
+
+static const sec_tag_t sec_tags[] = {
+	PSK_TAG,
+};
+
+static struct sockaddr_in server_addr = {
+	.sin_family = AF_INET,
+	.sin_port = htons(SERVER_PORT),
+	.sin_addr = INADDR_LOOPBACK_INIT,
+};
+
+static const char * const uri_path = "bench";
+
+static uint8_t payload[MAX_PAYLOAD];
+static uint16_t payload_len;
+
+static uint8_t server_buf[BUF_SIZE];
+static uint8_t server_response_buf[BUF_SIZE];
+static uint8_t request_buf[BUF_SIZE];
+static uint8_t response_buf[BUF_SIZE];
+
+static int server_sock;
+
+static void server(void *p1, void *p2, void *p3)
+{
+	struct coap_packet request;
+	struct coap_packet response;
+	struct sockaddr_in client_addr;
+	socklen_t addrlen;
+	int len;
+
+	while (true) {
+		addrlen = sizeof(client_addr);
+		len = recvfrom(server_sock, server_buf, sizeof(server_buf), 0,
+			       (struct sockaddr *)&client_addr, &addrlen);
+		if (len <= 0) {
+			continue;
+		}
+
+		if (coap_packet_parse(&request, server_buf, len, NULL, 0) < 0 ||
+		    coap_ack_init(&response, &request, server_response_buf,
+				  sizeof(server_response_buf),
+				  COAP_RESPONSE_CODE_CONTENT) < 0 ||
+		    coap_packet_append_payload_marker(&response) < 0 ||
+		    coap_packet_append_payload(&response, payload,
+					       payload_len) < 0) {
+			continue;
+		}
+
+		(void)sendto(server_sock, response.data, response.offset, 0,
+			     (struct sockaddr *)&client_addr, addrlen);
+	}
+}
+
+K_THREAD_DEFINE(server_thread, STACK_SIZE, server, NULL, NULL, NULL,
+		K_PRIO_PREEMPT(1), 0, -1);
+
+static int dtls_socket(void)
+{
+	int ciphersuites[] = { CIPHERSUITE };
+	int sock;
+
+	sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_DTLS_1_2);
+	if (sock < 0) {
+		return sock;
+	}
+
+	(void)setsockopt(sock, SOL_TLS, TLS_SEC_TAG_LIST, sec_tags,
+			 sizeof(sec_tags));
+	(void)setsockopt(sock, SOL_TLS, TLS_CIPHERSUITE_LIST, ciphersuites,
+			 sizeof(ciphersuites));
+
+	return sock;
+}
+
+static int server_start(void)
+{
+	int role = TLS_DTLS_ROLE_SERVER;
+	int ret;
+
+	ret = tls_credential_add(PSK_TAG, TLS_CREDENTIAL_PSK, psk, sizeof(psk));
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = tls_credential_add(PSK_TAG, TLS_CREDENTIAL_PSK_ID, psk_id,
+				 strlen(psk_id));
+	if (ret < 0) {
+		return ret;
+	}
+
+	server_sock = dtls_socket();
+	if (server_sock < 0) {
+		return -errno;
+	}
+
+	if (setsockopt(server_sock, SOL_TLS, TLS_DTLS_ROLE, &role,
+		       sizeof(role)) < 0 ||
+	    bind(server_sock, (struct sockaddr *)&server_addr,
+		 sizeof(server_addr)) < 0) {
+		return -errno;
+	}
+
+	k_thread_start(server_thread);
+
+	return 0;
+}
+
+static int bench_requests(int sock, uint16_t len)
+{
+	struct coap_packet request;
+	uint64_t cycles = 0;
+	timing_t start, end;
+	uint64_t ns;
+	int ret;
+	int i;
+
+	payload_len = len;
+
+	for (i = 0; i < N_REQUESTS; i++) {
+		ret = coap_packet_init(&request, request_buf,
+				       sizeof(request_buf), COAP_VERSION_1,
+				       COAP_TYPE_CON, 0, NULL, COAP_METHOD_GET,
+				       coap_next_id());
+		if (ret < 0) {
+			return ret;
+		}
+
+		ret = coap_packet_append_option(&request, COAP_OPTION_URI_PATH,
+						(const uint8_t *)uri_path,
+						strlen(uri_path));
+		if (ret < 0) {
+			return ret;
+		}
+
+		start = timing_counter_get();
+
+		if (send(sock, request.data, request.offset, 0) < 0 ||
+		    recv(sock, response_buf, sizeof(response_buf), 0) <= 0) {
+			return -errno;
+		}
+
+		end = timing_counter_get();
+		cycles += timing_cycles_get(&start, &end);
+	}
+
+	ns = timing_cycles_to_ns(cycles);
+	if (ns == 0) {
+		ns = 1;
+	}
+
+	printk("%u byte payload: %u us per request, %u requests/s, "
+	       "%u bytes/s\n", len,
+	       (uint32_t)(ns / N_REQUESTS / NSEC_PER_USEC),
+	       (uint32_t)((uint64_t)N_REQUESTS * NSEC_PER_SEC / ns),
+	       (uint32_t)((uint64_t)N_REQUESTS * len * NSEC_PER_SEC / ns));
+
+	return 0;
+}
+
+static void print_heap(void)
+{
+	size_t cur_used, cur_blocks;
+	size_t max_used, max_blocks;
+
+	mbedtls_memory_buffer_alloc_cur_get(&cur_used, &cur_blocks);
+	mbedtls_memory_buffer_alloc_max_get(&max_used, &max_blocks);
+
+	printk("mbed TLS heap: %u bytes in use, %u bytes peak\n",
+	       (uint32_t)cur_used, (uint32_t)max_used);
+}
+
+void main(void)
+{
+	int sock;
+	int ret;
+
+	timing_init();
+	timing_start();
+
+	ret = server_start();
+	if (ret < 0) {
+		printk("Cannot start the server (%d)\n", ret);
+		return;
+	}
+
+	sock = dtls_socket();
+	if (sock < 0 ||
+	    connect(sock, (struct sockaddr *)&server_addr,
+		    sizeof(server_addr)) < 0) {
+		printk("Cannot connect to the server (%d)\n", -errno);
+		return;
+	}
+
+	mbedtls_memory_buffer_alloc_max_reset();
+
+	ret = bench_requests(sock, 64);
+	if (ret == 0) {
+		ret = bench_requests(sock, MAX_PAYLOAD);
+	}
+
+	if (ret < 0) {
+		printk("Request failed (%d)\n", ret);
+	} else {
+		print_heap();
+	}
+
+	(void)close(sock);
+
+	timing_stop();
+
+	printk("fin\n");
+}
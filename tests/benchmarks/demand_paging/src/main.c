@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/zephyr.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/mem_manage.h>
+
+/* Demand paging eviction benchmark.
+ *
+ * An anonymous memory arena larger than the free memory is accessed with
+ * two patterns, and the number of page faults and the time taken are
+ * reported for each one. Build the benchmark once per eviction algorithm
+ * to compare them:
+ *
+ * - sequential: every page of the arena is touched in order, several
+ *   times, which defeats any algorithm based on recency.
+ * - hot/cold: most accesses go to a hot quarter of the arena, the rest are
+ *   spread over all of it, so a good algorithm keeps the hot pages loaded.
+ *
+ * The prefetch scenarios enable CONFIG_DEMAND_PAGING_PREFETCH, which should
+ * cut the page faults and time of the sequential pattern.
+ */
+
+#ifdef CONFIG_BACKING_STORE_RAM_PAGES
+#define EXTRA_PAGES	((CONFIG_BACKING_STORE_RAM_PAGES - 1) / 2)
+#else
+#error "Unsupported configuration"
+#endif
+#define SEQ_PASSES	4
+#define N_ACCESSES	8192
+#define HOT_PERCENT	90
+
+#if defined(CONFIG_EVICTION_NRU)
+#define ALGORITHM	"nru"
+#elif defined(CONFIG_EVICTION_CLOCK)
+#define ALGORITHM	"clock"
+#elif defined(CONFIG_EVICTION_LRU)
+#define ALGORITHM	"lru"
+#else
+#define ALGORITHM	"custom"
+#endif
+
+static uint8_t *arena;
+static size_t arena_pages;
+static uint32_t lcg_state = 1U;
+
+static uint32_t lcg_next(void)
+{
+	lcg_state = lcg_state * 1103515245U + 12345U;
+
+	return lcg_state >> 8;
+}
+
+static void touch(size_t page, bool write)
+{
+	volatile uint8_t *p = &arena[page * CONFIG_MMU_PAGE_SIZE];
+
+	if (write) {
+		*p = (uint8_t)page;
+	} else {
+		(void)*p;
+	}
+}
+
+static void run_sequential(void)
+{
+	for (int pass = 0; pass < SEQ_PASSES; pass++) {
+		for (size_t page = 0; page < arena_pages; page++) {
+			touch(page, (pass % 2) == 0);
+		}
+	}
+}
+
+static void run_hot_cold(void)
+{
+	size_t hot_pages = arena_pages / 4;
+
+	for (int i = 0; i < N_ACCESSES; i++) {
+		uint32_t r = lcg_next();
+		size_t page;
+
+		if ((r % 100U) < HOT_PERCENT) {
+			page = (r >> 7) % hot_pages;
+		} else {
+			page = (r >> 7) % arena_pages;
+		}
+
+		touch(page, (r & 3U) == 0U);
+	}
+}
+
+static void run(const char *name, void (*fn)(void))
+{
+	struct k_mem_paging_stats_t before, after;
+	uint32_t start, cycles;
+
+	k_mem_paging_stats_get(&before);
+
+	start = k_cycle_get_32();
+	fn();
+	cycles = k_cycle_get_32() - start;
+
+	k_mem_paging_stats_get(&after);
+
+	printk("%s: %lu faults, %u cycles, anon working set %lu/%lu pages\n",
+	       name, after.pagefaults.cnt - before.pagefaults.cnt, cycles,
+	       after.regions[K_MEM_PAGING_REGION_ANON].working_set,
+	       after.regions[K_MEM_PAGING_REGION_ANON].resident);
+#ifdef CONFIG_DEMAND_PAGING_PREFETCH
+	printk("%s: %lu pages prefetched\n", name,
+	       after.prefetch.pages - before.prefetch.pages);
+#endif
+}
+
+void main(void)
+{
+	size_t size = k_mem_free_get() + (EXTRA_PAGES * CONFIG_MMU_PAGE_SIZE);
+
+	arena = k_mem_map(size, K_MEM_PERM_RW);
+	if (arena == NULL) {
+		printk("failed to map %zu bytes\n", size);
+		return;
+	}
+	arena_pages = size / CONFIG_MMU_PAGE_SIZE;
+
+	printk("eviction %s%s, arena %zu pages\n", ALGORITHM,
+	       IS_ENABLED(CONFIG_DEMAND_PAGING_PREFETCH) ? " + prefetch" : "",
+	       arena_pages);
+
+	/* Populate the arena so that every pattern starts out paging */
+	run_sequential();
+
+	run("sequential", run_sequential);
+	run("hot/cold", run_hot_cold);
+
+	printk("fin\n");
+}
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/zephyr.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/fs/fs_sys.h>
+
+/* Asynchronous file I/O benchmark.
+ *
+ * A producer appends fixed size records to a file, synchronizing after
+ * each one the way the file system log backend does. The file system is
+ * a stand-in for LittleFS on internal flash: every write costs some bus
+ * time and every ERASE_INTERVAL bytes a page erase blocks the writer.
+ *
+ * The producer-side latency of each record, from the start of the write
+ * call until control returns to the producer, is measured once with
+ * fs_write() + fs_sync() and once with fs_write_async().
+ */
+
+#define RECORD_SIZE	64
+#define N_RECORDS	256
+#define N_BUFFERS	8
+#define PERIOD_US	1000
+
+#define WRITE_COST_US	50
+#define ERASE_INTERVAL	1024
+#define ERASE_COST_MS	20
+
+static size_t written;
+
+static int bench_open(struct fs_file_t *zfp, const char *name, fs_mode_t flags)
+{
+	zfp->filep = &written;
+	return 0;
+}
+
+static int bench_close(struct fs_file_t *zfp)
+{
+	return 0;
+}
+
+static ssize_t bench_write(struct fs_file_t *zfp, const void *ptr, size_t size)
+{
+	if (((written + size) / ERASE_INTERVAL) != (written / ERASE_INTERVAL)) {
+		k_sleep(K_MSEC(ERASE_COST_MS));
+	}
+
+	k_busy_wait(WRITE_COST_US);
+	written += size;
+
+	return size;
+}
+
+static int bench_sync(struct fs_file_t *zfp)
+{
+	k_busy_wait(WRITE_COST_US);
+	return 0;
+}
+
+static int bench_mount(struct fs_mount_t *mountp)
+{
+	return 0;
+}
+
+static int bench_unmount(struct fs_mount_t *mountp)
+{
+	return 0;
+}
+
+static const struct fs_file_system_t bench_fs = {
+	.open = bench_open,
+	.close = bench_close,
+	.write = bench_write,
+	.sync = bench_sync,
+	.mount = bench_mount,
+	.unmount = bench_unmount,
+};
+
+static struct fs_mount_t mnt = {
+	.type = FS_TYPE_EXTERNAL_BASE,
+	.mnt_point = "/bench",
+};
+
+struct record_buf {
+	struct fs_async_req req;
+	uint8_t data[RECORD_SIZE];
+};
+
+K_MEM_SLAB_DEFINE_STATIC(record_slab, sizeof(struct record_buf), N_BUFFERS, 4);
+
+static void record_done(struct fs_async_req *req)
+{
+	struct record_buf *rec = CONTAINER_OF(req, struct record_buf, req);
+
+	k_mem_slab_free(&record_slab, (void **)&rec);
+}
+
+static int write_sync(struct fs_file_t *file, const uint8_t *record)
+{
+	ssize_t rc = fs_write(file, record, RECORD_SIZE);
+
+	return (rc < 0) ? rc : fs_sync(file);
+}
+
+static int write_async(struct fs_file_t *file, const uint8_t *record)
+{
+	struct record_buf *rec;
+	int rc;
+
+	(void)k_mem_slab_alloc(&record_slab, (void **)&rec, K_FOREVER);
+	memcpy(rec->data, record, RECORD_SIZE);
+	fs_async_req_init(&rec->req, record_done, NULL);
+
+	rc = fs_write_async(file, rec->data, RECORD_SIZE, FS_ASYNC_FLAG_SYNC,
+			    &rec->req);
+	if (rc < 0) {
+		k_mem_slab_free(&record_slab, (void **)&rec);
+	}
+
+	return rc;
+}
+
+static void run(const char *name,
+		int (*write_fn)(struct fs_file_t *file, const uint8_t *record))
+{
+	static uint8_t record[RECORD_SIZE];
+	struct fs_file_t file;
+	uint64_t total = 0;
+	uint32_t max = 0;
+
+	fs_file_t_init(&file);
+	if (fs_open(&file, "/bench/log", FS_O_CREATE | FS_O_WRITE) != 0) {
+		printk("%s: open failed\n", name);
+		return;
+	}
+
+	written = 0;
+	for (int i = 0; i < N_RECORDS; i++) {
+		uint32_t start, cycles;
+		int rc;
+
+		memset(record, i, sizeof(record));
+
+		start = k_cycle_get_32();
+		rc = write_fn(&file, record);
+		cycles = k_cycle_get_32() - start;
+
+		if (rc < 0) {
+			printk("%s: write failed (%d)\n", name, rc);
+			break;
+		}
+
+		total += cycles;
+		max = MAX(max, cycles);
+
+		k_usleep(PERIOD_US);
+	}
+
+	(void)fs_close(&file);
+
+	printk("%s: avg %u us max %u us\n", name,
+	       (uint32_t)k_cyc_to_us_floor64(total / N_RECORDS),
+	       (uint32_t)k_cyc_to_us_floor64(max));
+}
+
+void main(void)
+{
+	if ((fs_register(FS_TYPE_EXTERNAL_BASE, &bench_fs) != 0) ||
+	    (fs_mount(&mnt) != 0)) {
+		printk("mount failed\n");
+		return;
+	}
+
+	run("sync", write_sync);
+	run("async", write_async);
+
+	printk("fin\n");
+}
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/zephyr.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/dummy.h>
+
+/* IPv4 fragmentation benchmark.
+ *
+ * UDP datagrams of 1 to 8 kB are sent to a peer address over a dummy
+ * interface whose MTU is 576 bytes, and received one after the other.
+ * The interface reflects every packet it sends back into the stack with
+ * its addresses swapped, so each datagram is split into fragments on
+ * transmission, and reassembled on reception. Addresses of the host
+ * itself are not used, as their packets are looped back before reaching
+ * the interface. The same amount of data is then sent as datagrams which
+ * fit in the MTU, to compare the throughput with the unfragmented case.
+ */
+
+#define N_DATAGRAMS	200
+#define PORT		4242
+#define MAX_DATAGRAM	8192
+#define MTU		576
+
+/* Largest UDP payload which is not fragmented on the interface */
+#define MTU_PAYLOAD	(MTU - NET_IPV4UDPH_LEN)
+
+static const uint16_t datagram_sizes[] = { 1024, 2048, 4096, 8192 };
+
+static struct sockaddr_in local_addr = {
+	.sin_family = AF_INET,
+	.sin_port = htons(PORT),
+};
+
+static struct sockaddr_in peer_addr = {
+	.sin_family = AF_INET,
+	.sin_port = htons(PORT),
+	.sin_addr = { { { 192, 0, 2, 2 } } },
+};
+
+static uint8_t tx_buf[MAX_DATAGRAM];
+static uint8_t rx_buf[MAX_DATAGRAM];
+
+/* Number of packets sent by the interface */
+static atomic_t tx_packets;
+
+static int reflect_dev_init(const struct device *dev)
+{
+	return 0;
+}
+
+static void reflect_iface_init(struct net_if *iface)
+{
+	static uint8_t mac[] = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x01 };
+
+	net_if_set_link_addr(iface, mac, sizeof(mac), NET_LINK_DUMMY);
+}
+
+static int reflect_send(const struct device *dev, struct net_pkt *pkt)
+{
+	struct net_ipv4_hdr *hdr = NET_IPV4_HDR(pkt);
+	struct net_pkt *rx;
+	uint8_t addr[sizeof(struct in_addr)];
+
+	atomic_inc(&tx_packets);
+
+	memcpy(addr, hdr->src, sizeof(addr));
+	memcpy(hdr->src, hdr->dst, sizeof(addr));
+	memcpy(hdr->dst, addr, sizeof(addr));
+
+	rx = net_pkt_rx_clone(pkt, K_MSEC(100));
+	if (!rx) {
+		return -ENOMEM;
+	}
+
+	if (net_recv_data(net_pkt_iface(rx), rx) < 0) {
+		net_pkt_unref(rx);
+		return -EIO;
+	}
+
+	return 0;
+}
+
+static struct dummy_api reflect_api = {
+	.iface_api.init = reflect_iface_init,
+	.send = reflect_send,
+};
+
+NET_DEVICE_INIT(reflect, "reflect", reflect_dev_init, NULL, NULL, NULL,
+		CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &reflect_api, DUMMY_L2,
+		NET_L2_GET_CTX_TYPE(DUMMY_L2), MTU);
+
+/* Send len bytes as datagrams of at most chunk bytes, and receive them */
+static int64_t bench_datagrams(int tx_sock, int rx_sock, size_t len,
+			       size_t chunk)
+{
+	timing_t start, end;
+	size_t sent;
+	ssize_t ret;
+	int i;
+
+	atomic_clear(&tx_packets);
+
+	start = timing_counter_get();
+
+	for (i = 0; i < N_DATAGRAMS; i++) {
+		for (sent = 0; sent < len; sent += ret) {
+			ret = send(tx_sock, tx_buf, MIN(len - sent, chunk), 0);
+			if (ret < 0) {
+				return -errno;
+			}
+
+			if (recv(rx_sock, rx_buf, sizeof(rx_buf), 0) != ret) {
+				return -EMSGSIZE;
+			}
+		}
+	}
+
+	end = timing_counter_get();
+
+	return timing_cycles_to_ns(timing_cycles_get(&start, &end));
+}
+
+void main(void)
+{
+	struct timeval timeo = { .tv_sec = 1 };
+	int64_t frag_ns, mtu_ns;
+	uint32_t frags;
+	int tx_sock, rx_sock;
+	int i;
+
+	rx_sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	tx_sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	if (rx_sock < 0 || tx_sock < 0) {
+		printk("Cannot create the sockets (%d)\n", -errno);
+		return;
+	}
+
+	if (setsockopt(rx_sock, SOL_SOCKET, SO_RCVTIMEO, &timeo,
+		       sizeof(timeo)) < 0 ||
+	    bind(rx_sock, (struct sockaddr *)&local_addr,
+		 sizeof(local_addr)) < 0 ||
+	    connect(tx_sock, (struct sockaddr *)&peer_addr,
+		    sizeof(peer_addr)) < 0) {
+		printk("Cannot set up the sockets (%d)\n", -errno);
+		return;
+	}
+
+	for (i = 0; i < sizeof(tx_buf); i++) {
+		tx_buf[i] = i;
+	}
+
+	timing_init();
+	timing_start();
+
+	for (i = 0; i < ARRAY_SIZE(datagram_sizes); i++) {
+		uint16_t len = datagram_sizes[i];
+
+		frag_ns = bench_datagrams(tx_sock, rx_sock, len, len);
+		frags = atomic_get(&tx_packets) / N_DATAGRAMS;
+		mtu_ns = bench_datagrams(tx_sock, rx_sock, len, MTU_PAYLOAD);
+		if (frag_ns < 0 || mtu_ns < 0) {
+			printk("%u byte datagrams: failed (%d)\n", len,
+			       (int)MIN(frag_ns, mtu_ns));
+			continue;
+		}
+
+		printk("%u byte datagrams: %u fragments, %u us per datagram, "
+		       "%u bytes/s, %u bytes/s unfragmented\n", len, frags,
+		       (uint32_t)(frag_ns / N_DATAGRAMS / NSEC_PER_USEC),
+		       (uint32_t)(((uint64_t)N_DATAGRAMS * len * NSEC_PER_SEC) /
+				  MAX(frag_ns, 1)),
+		       (uint32_t)(((uint64_t)N_DATAGRAMS * len * NSEC_PER_SEC) /
+				  MAX(mtu_ns, 1)));
+	}
+
+	timing_stop();
+
+	(void)close(tx_sock);
+	(void)close(rx_sock);
+
+	printk("fin\n");
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measure the cost of a system call on a dynamically allocated kernel
+ * object, depending on the number of dynamic objects in the system.
+ *
+ * A user thread gives a dynamically allocated semaphore in a loop. The
+ * time of a run without any system call, which is the cost of creating and
+ * joining the thread, is subtracted.
+ *
+ * The hash table only holds up to three quarters of
+ * CONFIG_DYNAMIC_OBJECTS_HASH_SIZE objects, so the scenario sizes it for
+ * MAX_OBJECTS; otherwise the last counts measure the tree fallback.
+ */
+
+#include <zephyr/zephyr.h>
+#include <zephyr/timing/timing.h>
+#include "utils.h"
+
+#define TEST_COUNT	1000
+#define MAX_OBJECTS	256
+#define STACK_SIZE	(512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+#if CONFIG_DYNAMIC_OBJECTS_HASH_SIZE > 0
+BUILD_ASSERT(MAX_OBJECTS <= CONFIG_DYNAMIC_OBJECTS_HASH_SIZE * 3 / 4,
+	     "hash table too small for MAX_OBJECTS");
+#endif
+
+static const int obj_counts[] = { 1, 16, 64, MAX_OBJECTS };
+
+static struct k_sem *dyn_sem[MAX_OBJECTS];
+
+static K_THREAD_STACK_DEFINE(user_stack, STACK_SIZE);
+static struct k_thread user_thread;
+
+static void user_give(void *p1, void *p2, void *p3)
+{
+	struct k_sem *sem = p1;
+	uint32_t count = POINTER_TO_UINT(p2);
+
+	ARG_UNUSED(p3);
+
+	for (uint32_t i = 0; i < count; i++) {
+		k_sem_give(sem);
+	}
+}
+
+static uint32_t user_run(struct k_sem *sem, uint32_t count)
+{
+	timing_t start, end;
+
+	k_thread_create(&user_thread, user_stack, STACK_SIZE, user_give,
+			sem, UINT_TO_POINTER(count), NULL,
+			K_PRIO_PREEMPT(5), K_USER, K_FOREVER);
+	k_object_access_grant(sem, &user_thread);
+
+	start = timing_counter_get();
+	k_thread_start(&user_thread);
+	k_thread_join(&user_thread, K_FOREVER);
+	end = timing_counter_get();
+
+	return timing_cycles_get(&start, &end);
+}
+
+void dyn_obj_syscall(void)
+{
+	char tag[64];
+	int allocated = 0;
+
+	k_thread_system_pool_assign(k_current_get());
+
+	timing_start();
+
+	for (int c = 0; c < ARRAY_SIZE(obj_counts); c++) {
+		struct k_sem *sem;
+		uint32_t base, sum;
+
+		while (allocated < obj_counts[c]) {
+			dyn_sem[allocated] = k_object_alloc(K_OBJ_SEM);
+			if (dyn_sem[allocated] == NULL) {
+				printk("Failed to allocate object %d, "
+				       "please increase heap size\n", allocated);
+				error_count++;
+				goto out;
+			}
+			k_sem_init(dyn_sem[allocated], 0, 1);
+			allocated++;
+		}
+
+		/* Most recently allocated object */
+		sem = dyn_sem[allocated - 1];
+
+		base = user_run(sem, 0);
+		sum = user_run(sem, TEST_COUNT);
+		sum = (sum > base) ? (sum - base) : 0U;
+
+		snprintk(tag, sizeof(tag),
+			 "Syscall on a dynamic object, %d objects", allocated);
+		PRINT_STATS_AVG(tag, sum, TEST_COUNT);
+	}
+
+out:
+	for (int i = 0; i < allocated; i++) {
+		k_object_free(dyn_sem[i]);
+	}
+
+	timing_stop();
+}
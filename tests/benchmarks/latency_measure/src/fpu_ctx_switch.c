@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * This file contains the benchmark that measures the cost of preemptive
+ * context switches between two threads sharing the FPU registers.
+ *
+ * A control thread repeatedly raises an interrupt whose handler wakes up a
+ * higher priority DSP thread, which runs and blocks again, so that each round
+ * trip is made of a preemptive switch to the DSP thread and of a switch back
+ * to the control thread. Both threads are created with K_FP_REGS, and the
+ * test is run with floating point instructions executed by none, one or both
+ * of them. With lazy FPU context switching, the floating point context is
+ * only switched when a thread actually uses the FPU.
+ */
+
+#include <zephyr/zephyr.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/irq_offload.h>
+#include "timestamp.h"
+#include "utils.h"
+
+#ifdef CONFIG_FPU_SHARING
+
+#define NB_OF_ROUND_TRIPS 1000
+
+#define FPU_STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define FPU_CTL_PRIORITY K_PRIO_PREEMPT(9)
+#define FPU_DSP_PRIORITY K_PRIO_PREEMPT(8)
+
+K_THREAD_STACK_DEFINE(fpu_ctl_stack, FPU_STACK_SIZE);
+K_THREAD_STACK_DEFINE(fpu_dsp_stack, FPU_STACK_SIZE);
+static struct k_thread fpu_ctl_thread;
+static struct k_thread fpu_dsp_thread;
+
+static K_SEM_DEFINE(fpu_sem, 0, 1);
+
+static volatile double fpu_acc;
+static timing_t timestamp_start;
+static timing_t timestamp_end;
+
+static inline void fpu_work(bool use_fpu)
+{
+	if (use_fpu) {
+		fpu_acc = fpu_acc * 1.0001 + 1.0;
+	}
+}
+
+static void fpu_isr(const void *unused)
+{
+	ARG_UNUSED(unused);
+
+	k_sem_give(&fpu_sem);
+}
+
+static void fpu_dsp(void *use_fpu, void *arg2, void *arg3)
+{
+	for (int i = 0; i < NB_OF_ROUND_TRIPS; i++) {
+		k_sem_take(&fpu_sem, K_FOREVER);
+		fpu_work(POINTER_TO_UINT(use_fpu) != 0U);
+	}
+}
+
+static void fpu_ctl(void *use_fpu, void *arg2, void *arg3)
+{
+	timestamp_start = timing_counter_get();
+
+	for (int i = 0; i < NB_OF_ROUND_TRIPS; i++) {
+		fpu_work(POINTER_TO_UINT(use_fpu) != 0U);
+		irq_offload(fpu_isr, NULL);
+	}
+
+	timestamp_end = timing_counter_get();
+}
+
+static void fpu_switch(const char *name, bool ctl_use_fpu, bool dsp_use_fpu)
+{
+	uint32_t ts_diff;
+#ifdef CONFIG_FPU_SHARING_STATS
+	struct k_float_stats ctl_stats, dsp_stats;
+#endif
+
+	timing_start();
+	bench_test_start();
+
+	k_thread_create(&fpu_dsp_thread, fpu_dsp_stack, FPU_STACK_SIZE,
+			fpu_dsp, UINT_TO_POINTER(dsp_use_fpu), NULL, NULL,
+			FPU_DSP_PRIORITY, K_FP_REGS, K_NO_WAIT);
+	k_thread_create(&fpu_ctl_thread, fpu_ctl_stack, FPU_STACK_SIZE,
+			fpu_ctl, UINT_TO_POINTER(ctl_use_fpu), NULL, NULL,
+			FPU_CTL_PRIORITY, K_FP_REGS, K_NO_WAIT);
+
+	k_thread_join(&fpu_ctl_thread, K_FOREVER);
+	k_thread_join(&fpu_dsp_thread, K_FOREVER);
+
+	if (bench_test_end() < 0) {
+		error_count++;
+		PRINT_OVERFLOW_ERROR();
+	} else {
+		ts_diff = timing_cycles_get(&timestamp_start, &timestamp_end);
+		PRINT_STATS_AVG(name, ts_diff, NB_OF_ROUND_TRIPS);
+	}
+
+#ifdef CONFIG_FPU_SHARING_STATS
+	k_float_stats_get(&fpu_ctl_thread, &ctl_stats);
+	k_float_stats_get(&fpu_dsp_thread, &dsp_stats);
+	printk(" FPU context loads/saves: control %u/%u, DSP %u/%u\n",
+	       ctl_stats.loads, ctl_stats.saves,
+	       dsp_stats.loads, dsp_stats.saves);
+#endif
+
+	timing_stop();
+}
+
+/**
+ * @brief Entry point for the FPU context switch test
+ */
+void fpu_ctx_switch(void)
+{
+	fpu_switch("FPU sharing round trip, FPU used by no thread",
+		   false, false);
+	fpu_switch("FPU sharing round trip, FPU used by DSP thread",
+		   false, true);
+	fpu_switch("FPU sharing round trip, FPU used by both threads",
+		   true, true);
+}
+
+#endif /* CONFIG_FPU_SHARING */
@@ -28,6 +28,8 @@ extern int sema_test(void);
 extern int sema_context_switch(void);
 extern int suspend_resume(void);
 extern void heap_malloc_free(void);
+extern void dyn_obj_syscall(void);
+extern void fpu_ctx_switch(void);
 
 void test_thread(void *arg1, void *arg2, void *arg3)
 {
@@ -60,6 +62,14 @@ void test_thread(void *arg1, void *arg2, void *arg3)
 
 	heap_malloc_free();
 
+#ifdef CONFIG_DYNAMIC_OBJECTS
+	dyn_obj_syscall();
+#endif
+
+#ifdef CONFIG_FPU_SHARING
+	fpu_ctx_switch();
+#endif
+
 	TC_END_REPORT(error_count);
 }
 
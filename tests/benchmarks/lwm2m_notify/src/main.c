@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/zephyr.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/coap.h>
+#include <zephyr/net/lwm2m.h>
+
+/* LwM2M resource update benchmark.
+ *
+ * The client has a number of temperature sensor instances, some of them
+ * observed by a local server, and the application updates the sensor value
+ * of each instance in turn, with the path given as a string and as a path
+ * structure. Each update of an observed value schedules a notification.
+ */
+
+#define N_INSTANCES	CONFIG_LWM2M_IPSO_TEMP_SENSOR_INSTANCE_COUNT
+#define N_OBSERVERS	4
+#define N_ROUNDS	200
+#define SERVER_PORT	5683
+#define BUF_SIZE	128
+
+#define TEMP_SENSOR_ID	3303
+#define SENSOR_VALUE_ID	5700
+
+static char paths[N_INSTANCES][sizeof("3303/65535/5700")];
+static uint8_t buf[BUF_SIZE];
+static int server_sock;
+static struct lwm2m_ctx client;
+static const struct in_addr loopback = INADDR_LOOPBACK_INIT;
+
+static int observe(int inst)
+{
+	struct sockaddr_in client_addr;
+	socklen_t addr_len = sizeof(client_addr);
+	struct zsock_pollfd pfd;
+	struct coap_packet req;
+	char inst_str[6];
+	uint8_t token[4];
+	int ret;
+
+	ret = getsockname(client.sock_fd, (struct sockaddr *)&client_addr,
+			  &addr_len);
+	if (ret < 0) {
+		return -errno;
+	}
+
+	/* The client socket is bound to any address */
+	client_addr.sin_addr = loopback;
+
+	sys_put_be32(inst, token);
+	snprintk(inst_str, sizeof(inst_str), "%d", inst);
+
+	coap_packet_init(&req, buf, sizeof(buf), COAP_VERSION_1,
+			 COAP_TYPE_CON, sizeof(token), token, COAP_METHOD_GET,
+			 coap_next_id());
+	coap_append_option_int(&req, COAP_OPTION_OBSERVE, 0);
+	coap_packet_append_option(&req, COAP_OPTION_URI_PATH, "3303", 4);
+	coap_packet_append_option(&req, COAP_OPTION_URI_PATH, inst_str,
+				  strlen(inst_str));
+	coap_packet_append_option(&req, COAP_OPTION_URI_PATH, "5700", 4);
+
+	ret = sendto(server_sock, req.data, req.offset, 0,
+		     (struct sockaddr *)&client_addr, addr_len);
+	if (ret < 0) {
+		return -errno;
+	}
+
+	/* Wait for the response of the client */
+	pfd.fd = server_sock;
+	pfd.events = ZSOCK_POLLIN;
+	if (poll(&pfd, 1, MSEC_PER_SEC) != 1) {
+		return -ETIMEDOUT;
+	}
+
+	return recv(server_sock, buf, sizeof(buf), 0);
+}
+
+static int setup(void)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(SERVER_PORT),
+		.sin_addr = INADDR_LOOPBACK_INIT,
+	};
+	int ret;
+
+	server_sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	if (server_sock < 0 ||
+	    bind(server_sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+		return -errno;
+	}
+
+	for (int i = 0; i < N_INSTANCES; i++) {
+		snprintk(paths[i], sizeof(paths[i]), "3303/%d", i);
+		ret = lwm2m_engine_create_obj_inst(paths[i]);
+		if (ret < 0) {
+			return ret;
+		}
+
+		snprintk(paths[i], sizeof(paths[i]), "3303/%d/5700", i);
+	}
+
+	ret = lwm2m_engine_set_string("0/0/0", "coap://127.0.0.1:5683");
+	if (ret < 0) {
+		return ret;
+	}
+
+	client.sock_fd = -1;
+	ret = lwm2m_engine_start(&client);
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* Observe instances spread over the table */
+	for (int i = 0; i < N_OBSERVERS; i++) {
+		ret = observe(i * N_INSTANCES / N_OBSERVERS);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+static void run(bool use_string)
+{
+	timing_t start, end;
+	double value = 0.0;
+	uint64_t ns;
+	int ret;
+
+	start = timing_counter_get();
+
+	for (int r = 0; r < N_ROUNDS; r++) {
+		value += 0.5;
+
+		for (int i = 0; i < N_INSTANCES; i++) {
+			if (use_string) {
+				ret = lwm2m_engine_set_float(paths[i], &value);
+			} else {
+				ret = lwm2m_set_float(&LWM2M_OBJ(TEMP_SENSOR_ID,
+								 i,
+								 SENSOR_VALUE_ID),
+						      &value);
+			}
+
+			if (ret < 0) {
+				printk("set failed (%d)\n", ret);
+				return;
+			}
+		}
+	}
+
+	end = timing_counter_get();
+
+	ns = timing_cycles_to_ns(timing_cycles_get(&start, &end));
+
+	printk("%d instances, %d observers, path %s: %u sets/s\n",
+	       N_INSTANCES, N_OBSERVERS, use_string ? "string" : "structure",
+	       (uint32_t)(((uint64_t)N_ROUNDS * N_INSTANCES * NSEC_PER_SEC) /
+			  MAX(ns, 1U)));
+}
+
+void main(void)
+{
+	int ret;
+
+	ret = setup();
+	if (ret < 0) {
+		printk("setup failed (%d)\n", ret);
+		return;
+	}
+
+	timing_init();
+	timing_start();
+
+	run(true);
+	run(false);
+
+	timing_stop();
+
+	printk("fin\n");
+}
@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/zephyr.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/coap.h>
+#include <zephyr/net/lwm2m.h>
+
+/* LwM2M notification traffic benchmark.
+ *
+ * A local server registers the client and observes the sensor value of
+ * each temperature sensor instance. The application then updates all the
+ * sensor values at a fixed period, and the server counts the messages and
+ * the CoAP bytes it receives for the whole workload. The result depends on
+ * the notification batching options of the engine, not on the speed of
+ * the target.
+ */
+
+#define N_SENSORS	CONFIG_LWM2M_IPSO_TEMP_SENSOR_INSTANCE_COUNT
+#define N_ROUNDS	50
+#define UPDATE_PERIOD	K_MSEC(100)
+#define SETTLE_TIME	K_SECONDS(2)
+#define SERVER_PORT	5683
+#define BUF_SIZE	512
+#define STACK_SIZE	2048
+
+#define TEMP_SENSOR_ID	3303
+#define SENSOR_VALUE_ID	5700
+
+static uint8_t rx_buf[BUF_SIZE];
+static uint8_t tx_buf[BUF_SIZE];
+static int server_sock;
+static struct sockaddr_in client_addr;
+static struct lwm2m_ctx client;
+
+static bool counting;
+static uint32_t messages;
+static uint32_t bytes;
+
+static K_SEM_DEFINE(registered, 0, 1);
+
+static bool is_registration(const struct coap_packet *pkt)
+{
+	struct coap_option options[2];
+
+	/* A registration is a POST to /rd, an update a POST to /rd/<ep> */
+	return coap_find_options(pkt, COAP_OPTION_URI_PATH, options, 2) == 1 &&
+	       options[0].len == 2 && !memcmp(options[0].value, "rd", 2);
+}
+
+static int build_reply(const struct coap_packet *pkt, struct coap_packet *reply)
+{
+	int ret;
+
+	/* Empty ACK of a notification */
+	if (coap_header_get_code(pkt) != COAP_METHOD_POST) {
+		return coap_ack_init(reply, pkt, tx_buf, sizeof(tx_buf),
+				     COAP_CODE_EMPTY);
+	}
+
+	/* Registration update and Send */
+	if (!is_registration(pkt)) {
+		return coap_ack_init(reply, pkt, tx_buf, sizeof(tx_buf),
+				     COAP_RESPONSE_CODE_CHANGED);
+	}
+
+	ret = coap_ack_init(reply, pkt, tx_buf, sizeof(tx_buf),
+			    COAP_RESPONSE_CODE_CREATED);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = coap_packet_append_option(reply, COAP_OPTION_LOCATION_PATH,
+					"rd", 2);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return coap_packet_append_option(reply, COAP_OPTION_LOCATION_PATH,
+					 "bench", 5);
+}
+
+static void server(void *p1, void *p2, void *p3)
+{
+	struct coap_packet pkt, reply;
+	socklen_t addr_len;
+	int len;
+
+	while (true) {
+		addr_len = sizeof(client_addr);
+		len = recvfrom(server_sock, rx_buf, sizeof(rx_buf), 0,
+			       (struct sockaddr *)&client_addr, &addr_len);
+		if (len <= 0 || coap_packet_parse(&pkt, rx_buf, len, NULL, 0)) {
+			continue;
+		}
+
+		if (counting) {
+			messages++;
+			bytes += len;
+		}
+
+		if (coap_header_get_type(&pkt) != COAP_TYPE_CON ||
+		    build_reply(&pkt, &reply) < 0) {
+			continue;
+		}
+
+		(void)sendto(server_sock, reply.data, reply.offset, 0,
+			     (struct sockaddr *)&client_addr, addr_len);
+	}
+}
+
+K_THREAD_DEFINE(server_thread, STACK_SIZE, server, NULL, NULL, NULL,
+		K_PRIO_PREEMPT(1), 0, -1);
+
+static void rd_client_event(struct lwm2m_ctx *ctx,
+			    enum lwm2m_rd_client_event event)
+{
+	if (event == LWM2M_RD_CLIENT_EVENT_REGISTRATION_COMPLETE) {
+		k_sem_give(&registered);
+	}
+}
+
+static int observe(int inst)
+{
+	struct coap_packet req;
+	char inst_str[6];
+	uint8_t token[4];
+	int ret;
+
+	sys_put_be32(inst, token);
+	snprintk(inst_str, sizeof(inst_str), "%d", inst);
+
+	ret = coap_packet_init(&req, tx_buf, sizeof(tx_buf), COAP_VERSION_1,
+			       COAP_TYPE_CON, sizeof(token), token,
+			       COAP_METHOD_GET, coap_next_id());
+	if (ret < 0) {
+		return ret;
+	}
+
+	coap_append_option_int(&req, COAP_OPTION_OBSERVE, 0);
+	coap_packet_append_option(&req, COAP_OPTION_URI_PATH, "3303", 4);
+	coap_packet_append_option(&req, COAP_OPTION_URI_PATH, inst_str,
+				  strlen(inst_str));
+	coap_packet_append_option(&req, COAP_OPTION_URI_PATH, "5700", 4);
+
+	ret = sendto(server_sock, req.data, req.offset, 0,
+		     (struct sockaddr *)&client_addr, sizeof(client_addr));
+
+	return ret < 0 ? -errno : 0;
+}
+
+static int setup(void)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(SERVER_PORT),
+		.sin_addr = INADDR_LOOPBACK_INIT,
+	};
+	char path[sizeof("3303/65535")];
+	int ret;
+
+	server_sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	if (server_sock < 0 ||
+	    bind(server_sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+		return -errno;
+	}
+
+	k_thread_start(server_thread);
+
+	for (int i = 0; i < N_SENSORS; i++) {
+		snprintk(path, sizeof(path), "3303/%d", i);
+		ret = lwm2m_engine_create_obj_inst(path);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	ret = lwm2m_engine_set_string("0/0/0", "coap://127.0.0.1:5683");
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* Link the security object to the server object */
+	(void)lwm2m_engine_set_u16("0/0/10", 101);
+	(void)lwm2m_engine_set_u16("1/0/0", 101);
+
+	ret = lwm2m_rd_client_start(&client, "bench", 0, rd_client_event,
+				    NULL);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (k_sem_take(&registered, K_SECONDS(5))) {
+		return -ETIMEDOUT;
+	}
+
+	for (int i = 0; i < N_SENSORS; i++) {
+		ret = observe(i);
+		if (ret < 0) {
+			return ret;
+		}
+
+		k_sleep(K_MSEC(10));
+	}
+
+	k_sleep(SETTLE_TIME);
+
+	return 0;
+}
+
+void main(void)
+{
+	double value = 0.0;
+	int ret;
+
+	ret = setup();
+	if (ret < 0) {
+		printk("setup failed (%d)\n", ret);
+		return;
+	}
+
+	counting = true;
+
+	for (int r = 0; r < N_ROUNDS; r++) {
+		value += 0.5;
+
+		for (int i = 0; i < N_SENSORS; i++) {
+			(void)lwm2m_set_float(&LWM2M_OBJ(TEMP_SENSOR_ID, i,
+							 SENSOR_VALUE_ID),
+					      &value);
+		}
+
+		k_sleep(UPDATE_PERIOD);
+	}
+
+	k_sleep(SETTLE_TIME);
+
+	counting = false;
+
+	printk("%d updates: %u messages, %u bytes\n", N_ROUNDS * N_SENSORS,
+	       messages, bytes);
+
+	printk("fin\n");
+}
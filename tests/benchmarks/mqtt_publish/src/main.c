@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/zephyr.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/mqtt.h>
+
+/* MQTT QoS 1 publish throughput benchmark.
+ *
+ * A broker stand-in on the loopback interface acknowledges the CONNECT and
+ * every PUBLISH it receives, the PUBACKs being delayed to emulate the
+ * latency of a real link. The client publishes a fixed number of messages,
+ * first with mqtt_publish() waiting for each PUBACK before the next
+ * message, as a publisher without a window of its own does, then with
+ * mqtt_publish_async().
+ *
+ * The link latency is emulated with kernel timeouts, so the time is
+ * measured with the uptime rather than with the timing functions.
+ */
+
+#define N_MESSAGES	200
+#define LINK_DELAY_MS	10
+#define PAYLOAD_SIZE	64
+#define BROKER_PORT	1883
+#define BUF_SIZE	256
+#define BROKER_BUF_SIZE	1024
+#define STACK_SIZE	2048
+
+#define PKT_TYPE_CONNECT	0x10
+#define PKT_TYPE_PUBLISH	0x30
+
+static uint8_t payload[PAYLOAD_SIZE];
+static uint8_t rx_buf[BUF_SIZE];
+static uint8_t tx_buf[BUF_SIZE];
+static uint8_t broker_buf[BROKER_BUF_SIZE];
+static struct mqtt_client client;
+static struct sockaddr_in broker_addr = {
+	.sin_family = AF_INET,
+	.sin_port = htons(BROKER_PORT),
+	.sin_addr = INADDR_LOOPBACK_INIT,
+};
+static int listen_sock;
+static int broker_sock;
+
+struct puback {
+	int64_t due;
+	uint16_t message_id;
+};
+
+K_MSGQ_DEFINE(puback_queue, sizeof(struct puback), 64, 4);
+
+static bool connected;
+static uint32_t acked;
+
+/* Answer the complete packets in the buffer, return the bytes consumed */
+static int broker_handle(int sock, uint8_t *buf, int len)
+{
+	static const uint8_t connack[] = { 0x20, 0x02, 0x00, 0x00 };
+	struct puback puback;
+	uint32_t remaining;
+	int hdr_len;
+	int pos = 0;
+
+	while (pos + 2 <= len) {
+		/* Remaining length, 1 to 4 bytes */
+		remaining = 0U;
+		hdr_len = 1;
+		do {
+			if (pos + hdr_len >= len) {
+				return pos;
+			}
+
+			remaining |= (buf[pos + hdr_len] & 0x7f) << (7 * (hdr_len - 1));
+		} while (buf[pos + hdr_len++] & 0x80);
+
+		if (pos + hdr_len + remaining > len) {
+			break;
+		}
+
+		if ((buf[pos] & 0xf0) == PKT_TYPE_CONNECT) {
+			(void)send(sock, connack, sizeof(connack), 0);
+		} else if ((buf[pos] & 0xf0) == PKT_TYPE_PUBLISH) {
+			/* The message id follows the topic of a QoS 1 PUBLISH */
+			uint16_t topic_len = sys_get_be16(&buf[pos + hdr_len]);
+
+			puback.message_id =
+				sys_get_be16(&buf[pos + hdr_len + 2 + topic_len]);
+			puback.due = k_uptime_get() + LINK_DELAY_MS;
+			(void)k_msgq_put(&puback_queue, &puback, K_FOREVER);
+		}
+
+		pos += hdr_len + remaining;
+	}
+
+	return pos;
+}
+
+static void broker(void *p1, void *p2, void *p3)
+{
+	int len, used;
+	int end = 0;
+
+	broker_sock = accept(listen_sock, NULL, NULL);
+	if (broker_sock < 0) {
+		printk("accept failed (%d)\n", errno);
+		return;
+	}
+
+	while (true) {
+		len = recv(broker_sock, broker_buf + end,
+			   sizeof(broker_buf) - end, 0);
+		if (len <= 0) {
+			break;
+		}
+
+		end += len;
+		used = broker_handle(broker_sock, broker_buf, end);
+		memmove(broker_buf, broker_buf + used, end - used);
+		end -= used;
+	}
+
+	close(broker_sock);
+}
+
+/* Send each PUBACK once the link delay of its PUBLISH has elapsed */
+static void link(void *p1, void *p2, void *p3)
+{
+	struct puback puback;
+	uint8_t pkt[4] = { 0x40, 0x02 };
+
+	while (true) {
+		(void)k_msgq_get(&puback_queue, &puback, K_FOREVER);
+		if (puback.due > k_uptime_get()) {
+			k_sleep(K_TIMEOUT_ABS_MS(puback.due));
+		}
+
+		sys_put_be16(puback.message_id, &pkt[2]);
+		(void)send(broker_sock, pkt, sizeof(pkt), 0);
+	}
+}
+
+K_THREAD_DEFINE(broker_thread, STACK_SIZE, broker, NULL, NULL, NULL,
+		K_PRIO_PREEMPT(1), 0, -1);
+K_THREAD_DEFINE(link_thread, STACK_SIZE, link, NULL, NULL, NULL,
+		K_PRIO_PREEMPT(1), 0, 0);
+
+static void mqtt_evt_handler(struct mqtt_client *const c,
+			     const struct mqtt_evt *evt)
+{
+	switch (evt->type) {
+	case MQTT_EVT_CONNACK:
+		connected = (evt->result == 0);
+		break;
+	case MQTT_EVT_PUBACK:
+		acked++;
+		break;
+	default:
+		break;
+	}
+}
+
+/* Process the data received from the broker, waiting for some if needed */
+static void input(void)
+{
+	struct zsock_pollfd fds = {
+		.fd = client.transport.tcp.sock,
+		.events = ZSOCK_POLLIN,
+	};
+
+	if (poll(&fds, 1, MSEC_PER_SEC) > 0) {
+		(void)mqtt_input(&client);
+	}
+}
+
+static int setup(void)
+{
+	mqtt_client_init(&client);
+
+	client.broker = &broker_addr;
+	client.evt_cb = mqtt_evt_handler;
+	client.client_id.utf8 = (uint8_t *)"zephyr_bench";
+	client.client_id.size = strlen("zephyr_bench");
+	client.protocol_version = MQTT_VERSION_3_1_1;
+	client.rx_buf = rx_buf;
+	client.rx_buf_size = sizeof(rx_buf);
+	client.tx_buf = tx_buf;
+	client.tx_buf_size = sizeof(tx_buf);
+	client.transport.type = MQTT_TRANSPORT_NON_SECURE;
+
+	listen_sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (listen_sock < 0 ||
+	    bind(listen_sock, (struct sockaddr *)&broker_addr,
+		 sizeof(broker_addr)) < 0 ||
+	    listen(listen_sock, 1) < 0) {
+		return -errno;
+	}
+
+	k_thread_start(broker_thread);
+
+	if (mqtt_connect(&client) < 0) {
+		return -ECONNREFUSED;
+	}
+
+	while (!connected) {
+		input();
+	}
+
+	return 0;
+}
+
+static void param_init(struct mqtt_publish_param *param, uint16_t id)
+{
+	param->message.topic.topic.utf8 = (uint8_t *)"bench/data";
+	param->message.topic.topic.size = strlen("bench/data");
+	param->message.topic.qos = MQTT_QOS_1_AT_LEAST_ONCE;
+	param->message.payload.data = payload;
+	param->message.payload.len = sizeof(payload);
+	param->message_id = id;
+	param->dup_flag = 0U;
+	param->retain_flag = 0U;
+}
+
+static void report(const char *name, int64_t start)
+{
+	int64_t ms = k_uptime_get() - start;
+
+	printk("%s, QoS 1: %u msgs/s\n", name,
+	       (uint32_t)((N_MESSAGES * MSEC_PER_SEC) / MAX(ms, 1)));
+}
+
+static void run_sync(void)
+{
+	struct mqtt_publish_param param;
+	int64_t start;
+
+	acked = 0U;
+	start = k_uptime_get();
+
+	for (int i = 0; i < N_MESSAGES; i++) {
+		param_init(&param, i + 1);
+		if (mqtt_publish(&client, &param) < 0) {
+			printk("publish failed\n");
+			return;
+		}
+
+		while (acked < i + 1) {
+			input();
+		}
+	}
+
+	report("mqtt_publish", start);
+}
+
+static void run_async(void)
+{
+	struct mqtt_publish_param param;
+	int64_t start;
+	int ret;
+
+	acked = 0U;
+	start = k_uptime_get();
+
+	for (int i = 0; i < N_MESSAGES; i++) {
+		param_init(&param, i + 1);
+
+		/* Process acknowledgments while the queue is full */
+		while ((ret = mqtt_publish_async(&client, &param)) == -ENOMEM) {
+			input();
+		}
+
+		if (ret < 0) {
+			printk("publish failed (%d)\n", ret);
+			return;
+		}
+	}
+
+	while (acked < N_MESSAGES) {
+		input();
+	}
+
+	report("mqtt_publish_async", start);
+}
+
+void main(void)
+{
+	int ret;
+
+	for (int i = 0; i < sizeof(payload); i++) {
+		payload[i] = i;
+	}
+
+	ret = setup();
+	if (ret < 0) {
+		printk("setup failed (%d)\n", ret);
+		return;
+	}
+
+	run_sync();
+	run_async();
+
+	(void)mqtt_disconnect(&client);
+
+	printk("fin\n");
+}
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/zephyr.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/timing/timing.h>
+#include <string.h>
+
+/* Message queue and pipe throughput benchmark.
+ *
+ * A producer thread streams data to the main thread in chunks of 4 B to
+ * 4 KiB, once with k_msgq_put()/k_msgq_get() and k_pipe_put()/k_pipe_get(),
+ * which copy each chunk in and out of the object's buffer, and once with
+ * the claim API, where the producer fills the buffer in place and the
+ * consumer reads it in place. The producer writes a pattern over the whole
+ * chunk and the consumer looks at its first and last bytes, so the figures
+ * include the cost of touching the data but no extra copies.
+ */
+
+#define TOTAL_BYTES	(64 * 1024)
+#define MAX_CHUNK	4096
+#define MSGQ_LEN	4
+#define STACK_SIZE	(1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static const uint32_t chunks[] = { 4, 16, 64, 256, 1024, 4096 };
+
+static char storage[MAX_CHUNK * MSGQ_LEN] __aligned(4);
+static uint8_t tx[MAX_CHUNK] __aligned(4);
+static uint8_t rx[MAX_CHUNK] __aligned(4);
+static struct k_msgq msgq;
+static struct k_pipe pipe;
+static volatile uint32_t sink;
+
+K_THREAD_STACK_DEFINE(producer_stack, STACK_SIZE);
+static struct k_thread producer_thread;
+
+static void consume(const uint8_t *data, uint32_t size)
+{
+	sink += data[0] + data[size - 1];
+}
+
+static void msgq_copy_send(uint32_t size)
+{
+	memset(tx, 0xa5, size);
+	(void)k_msgq_put(&msgq, tx, K_FOREVER);
+}
+
+static void msgq_copy_recv(uint32_t size)
+{
+	(void)k_msgq_get(&msgq, rx, K_FOREVER);
+	consume(rx, size);
+}
+
+static void msgq_claim_send(uint32_t size)
+{
+	void *slot;
+
+	(void)k_msgq_put_claim(&msgq, &slot, K_FOREVER);
+	memset(slot, 0xa5, size);
+	(void)k_msgq_put_commit(&msgq, false);
+}
+
+static void msgq_claim_recv(uint32_t size)
+{
+	void *msg;
+
+	(void)k_msgq_get_claim(&msgq, &msg, K_FOREVER);
+	consume(msg, size);
+	(void)k_msgq_get_finish(&msgq, false);
+}
+
+static void pipe_copy_send(uint32_t size)
+{
+	size_t written;
+
+	memset(tx, 0xa5, size);
+	(void)k_pipe_put(&pipe, tx, size, &written, size, K_FOREVER);
+}
+
+static void pipe_copy_recv(uint32_t size)
+{
+	size_t read;
+
+	(void)k_pipe_get(&pipe, rx, size, &read, size, K_FOREVER);
+	consume(rx, size);
+}
+
+static void pipe_claim_send(uint32_t size)
+{
+	size_t claimed;
+	void *space;
+
+	/* A claim stops at the end of the buffer */
+	while (size > 0U) {
+		claimed = size;
+		(void)k_pipe_put_claim(&pipe, &space, &claimed, K_FOREVER);
+		memset(space, 0xa5, claimed);
+		(void)k_pipe_put_commit(&pipe, claimed);
+		size -= claimed;
+	}
+}
+
+static void pipe_claim_recv(uint32_t size)
+{
+	size_t claimed;
+	void *data;
+
+	while (size > 0U) {
+		claimed = size;
+		(void)k_pipe_get_claim(&pipe, &data, &claimed, K_FOREVER);
+		consume(data, claimed);
+		(void)k_pipe_get_finish(&pipe, claimed);
+		size -= claimed;
+	}
+}
+
+struct variant {
+	const char *name;
+	void (*send)(uint32_t size);
+	void (*recv)(uint32_t size);
+};
+
+static const struct variant variants[] = {
+	{ "msgq copy", msgq_copy_send, msgq_copy_recv },
+	{ "msgq claim", msgq_claim_send, msgq_claim_recv },
+	{ "pipe copy", pipe_copy_send, pipe_copy_recv },
+	{ "pipe claim", pipe_claim_send, pipe_claim_recv },
+};
+
+static void producer(void *p1, void *p2, void *p3)
+{
+	const struct variant *v = p1;
+	uint32_t size = POINTER_TO_UINT(p2);
+	uint32_t count = TOTAL_BYTES / size;
+
+	for (uint32_t i = 0; i < count; i++) {
+		v->send(size);
+	}
+}
+
+static void run(const struct variant *v, uint32_t size)
+{
+	uint32_t count = TOTAL_BYTES / size;
+	timing_t start, end;
+	uint64_t cycles, ns, kib_s;
+
+	k_msgq_init(&msgq, storage, size, MSGQ_LEN);
+	k_pipe_init(&pipe, (unsigned char *)storage, sizeof(storage));
+
+	start = timing_counter_get();
+	k_thread_create(&producer_thread, producer_stack, STACK_SIZE,
+			producer, (void *)v, UINT_TO_POINTER(size), NULL,
+			k_thread_priority_get(k_current_get()), 0, K_NO_WAIT);
+
+	for (uint32_t i = 0; i < count; i++) {
+		v->recv(size);
+	}
+	end = timing_counter_get();
+
+	k_thread_join(&producer_thread, K_FOREVER);
+
+	cycles = timing_cycles_get(&start, &end);
+	ns = timing_cycles_to_ns(cycles);
+	kib_s = (ns == 0U) ? 0U :
+		((uint64_t)TOTAL_BYTES * NSEC_PER_SEC) / (ns * 1024U);
+
+	printk("%s %u B: %u cycles, %u KiB/s\n", v->name, size,
+	       (uint32_t)(cycles / count), (uint32_t)kib_s);
+}
+
+void main(void)
+{
+	timing_init();
+	timing_start();
+
+	for (int v = 0; v < ARRAY_SIZE(variants); v++) {
+		for (int c = 0; c < ARRAY_SIZE(chunks); c++) {
+			run(&variants[v], chunks[c]);
+		}
+	}
+
+	timing_stop();
+
+	printk("fin\n");
+}
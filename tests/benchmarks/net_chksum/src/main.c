@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_chksum_bench, LOG_LEVEL_INF);
+
+#include <zephyr/zephyr.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/net/net_pkt.h>
+
+#include "net_private.h"
+
+/* Internet checksum benchmark.
+ *
+ * The UDP checksum of IPv4 packets of increasing sizes is computed by
+ * net_calc_chksum(), as it is for every packet sent or received on an
+ * interface without checksum offload. The packet data is either held in
+ * full buffers, or in buffers whose data starts at an odd address and has
+ * an odd length, so that most 16-bit words span two buffers.
+ *
+ * The same data is also summed byte pair by byte pair, as a reference.
+ */
+
+#define N_ROUNDS	2000
+#define BUF_SIZE	CONFIG_NET_BUF_DATA_SIZE
+
+static const uint16_t pkt_sizes[] = { 64, 576, 1500 };
+
+static uint16_t byte_pairs_chksum(struct net_pkt *pkt)
+{
+	struct net_buf *buf;
+	uint32_t sum = 0U;
+	bool odd = false;
+	size_t i;
+
+	for (buf = pkt->buffer; buf; buf = buf->frags) {
+		for (i = 0; i < buf->len; i++) {
+			sum += odd ? buf->data[i] : buf->data[i] << 8;
+			odd = !odd;
+		}
+	}
+
+	while (sum >> 16) {
+		sum = (sum & 0xffff) + (sum >> 16);
+	}
+
+	return ~sum;
+}
+
+static struct net_pkt *build_pkt(size_t len, size_t reserve)
+{
+	struct net_ipv4_hdr hdr = {
+		.vhl = 0x45,
+		.ttl = 64,
+		.proto = IPPROTO_UDP,
+		.src = { 192, 0, 2, 1 },
+		.dst = { 192, 0, 2, 2 },
+	};
+	struct net_pkt *pkt;
+	struct net_buf *buf;
+	size_t pos;
+
+	pkt = net_pkt_alloc(K_NO_WAIT);
+	if (pkt == NULL) {
+		return NULL;
+	}
+
+	net_pkt_set_family(pkt, AF_INET);
+	net_pkt_set_ip_hdr_len(pkt, sizeof(hdr));
+
+	for (pos = 0; pos < len; pos += buf->len) {
+		buf = net_pkt_get_reserve_tx_data(K_NO_WAIT);
+		if (buf == NULL) {
+			net_pkt_unref(pkt);
+			return NULL;
+		}
+
+		net_buf_reserve(buf, reserve);
+		net_pkt_append_buffer(pkt, buf);
+
+		if (pos == 0) {
+			net_buf_add_mem(buf, &hdr, sizeof(hdr));
+		}
+
+		while (buf->len < BUF_SIZE - 2 * reserve &&
+		       pos + buf->len < len) {
+			net_buf_add_u8(buf, pos + buf->len);
+		}
+	}
+
+	return pkt;
+}
+
+static void bench_chksum(size_t len, const char *name, size_t reserve)
+{
+	uint64_t cycles, ref_cycles;
+	timing_t start, end;
+	struct net_pkt *pkt;
+	uint32_t sum = 0U;
+	int i;
+
+	pkt = build_pkt(len, reserve);
+	if (pkt == NULL) {
+		printk("Cannot allocate the packet\n");
+		return;
+	}
+
+	start = timing_counter_get();
+
+	for (i = 0; i < N_ROUNDS; i++) {
+		sum += net_calc_chksum(pkt, IPPROTO_UDP);
+	}
+
+	end = timing_counter_get();
+	cycles = timing_cycles_get(&start, &end);
+
+	start = timing_counter_get();
+
+	for (i = 0; i < N_ROUNDS; i++) {
+		sum += byte_pairs_chksum(pkt);
+	}
+
+	end = timing_counter_get();
+	ref_cycles = timing_cycles_get(&start, &end);
+
+	net_pkt_unref(pkt);
+
+	/* Cycles per byte, in hundredths */
+	cycles = (cycles * 100U) / ((uint64_t)N_ROUNDS * len);
+	ref_cycles = (ref_cycles * 100U) / ((uint64_t)N_ROUNDS * len);
+
+	printk("%u byte packet, %s buffers: %u.%02u cycles/byte, "
+	       "%u.%02u cycles/byte by byte pairs (sum 0x%x)\n", (uint32_t)len,
+	       name, (uint32_t)(cycles / 100U), (uint32_t)(cycles % 100U),
+	       (uint32_t)(ref_cycles / 100U), (uint32_t)(ref_cycles % 100U),
+	       sum);
+}
+
+void main(void)
+{
+	timing_init();
+	timing_start();
+
+	for (int i = 0; i < ARRAY_SIZE(pkt_sizes); i++) {
+		bench_chksum(pkt_sizes[i], "aligned", 0);
+		bench_chksum(pkt_sizes[i], "odd", 1);
+	}
+
+	timing_stop();
+
+	printk("fin\n");
+}
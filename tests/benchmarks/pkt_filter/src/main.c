@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/zephyr.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/ethernet.h>
+#include <zephyr/net/net_pkt_filter.h>
+
+/* Packet filter benchmark.
+ *
+ * An IPv4 packet received on one interface is filtered against an
+ * increasing number of rules, none of which matches it, followed by the
+ * default accept rule. In the "distinct" rule set, each rule drops packets
+ * of a given Ethernet type and size. In the "shared" rule set, each rule
+ * drops packets of a given Ethernet type received on the other interface,
+ * a condition all the rules have in common.
+ *
+ * Build with CONFIG_NET_PKT_FILTER_COMPILE enabled and disabled to compare
+ * compiled rule lists with rule by rule evaluation.
+ */
+
+#define MAX_RULES	50
+#define N_PACKETS	20000
+#define PKT_SIZE	100
+
+static int eth_fake_init(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	return 0;
+}
+
+ETH_NET_DEVICE_INIT(bench_iface_a, "bench_a", eth_fake_init, NULL,
+		    NULL, NULL, CONFIG_ETH_INIT_PRIORITY,
+		    NULL, NET_ETH_MTU);
+ETH_NET_DEVICE_INIT(bench_iface_b, "bench_b", eth_fake_init, NULL,
+		    NULL, NULL, CONFIG_ETH_INIT_PRIORITY,
+		    NULL, NET_ETH_MTU);
+#define bench_iface_a NET_IF_GET_NAME(bench_iface_a, 0)[0]
+#define bench_iface_b NET_IF_GET_NAME(bench_iface_b, 0)[0]
+
+static NPF_IFACE_MATCH(iface_b, &bench_iface_b);
+static NPF_SIZE_MAX(maxsize_1000, 1000);
+
+#define TYPE_DEFINE(i, _) \
+	static NPF_ETH_TYPE_MATCH(type_##i, 0x8800 + i)
+#define DISTINCT_RULE_DEFINE(i, _) \
+	static NPF_RULE(distinct_##i, NET_DROP, type_##i, maxsize_1000)
+#define SHARED_RULE_DEFINE(i, _) \
+	static NPF_RULE(shared_##i, NET_DROP, iface_b, type_##i)
+#define DISTINCT_RULE(i, _) &distinct_##i
+#define SHARED_RULE(i, _) &shared_##i
+
+LISTIFY(MAX_RULES, TYPE_DEFINE, (;));
+LISTIFY(MAX_RULES, DISTINCT_RULE_DEFINE, (;));
+LISTIFY(MAX_RULES, SHARED_RULE_DEFINE, (;));
+
+static struct npf_rule *distinct_rules[] = {
+	LISTIFY(MAX_RULES, DISTINCT_RULE, (,))
+};
+
+static struct npf_rule *shared_rules[] = {
+	LISTIFY(MAX_RULES, SHARED_RULE, (,))
+};
+
+static const int rule_counts[] = { 1, 10, 25, 50 };
+
+static struct net_pkt *build_pkt(void)
+{
+	static const uint8_t data[PKT_SIZE - sizeof(struct net_eth_hdr)];
+	struct net_eth_hdr eth_hdr = {
+		.src.addr = { 0x00, 0x11, 0x22, 0x33, 0x44, 0x55 },
+		.dst.addr = { 0x00, 0x66, 0x77, 0x88, 0x99, 0xaa },
+		.type = htons(NET_ETH_PTYPE_IP),
+	};
+	struct net_pkt *pkt;
+
+	pkt = net_pkt_rx_alloc_with_buffer(&bench_iface_a, PKT_SIZE,
+					   AF_UNSPEC, 0, K_NO_WAIT);
+	if (pkt == NULL) {
+		return NULL;
+	}
+
+	if (net_pkt_write(pkt, &eth_hdr, sizeof(eth_hdr)) < 0 ||
+	    net_pkt_write(pkt, data, sizeof(data)) < 0) {
+		net_pkt_unref(pkt);
+		return NULL;
+	}
+
+	return pkt;
+}
+
+static void bench_rules(const char *name, struct npf_rule **rules,
+			int nb_rules, struct net_pkt *pkt)
+{
+	timing_t start, end;
+	uint32_t accepted = 0;
+	uint64_t ns;
+	int i;
+
+	for (i = 0; i < nb_rules; i++) {
+		npf_append_recv_rule(rules[i]);
+	}
+
+	npf_append_recv_rule(&npf_default_ok);
+
+	start = timing_counter_get();
+
+	for (i = 0; i < N_PACKETS; i++) {
+		accepted += net_pkt_filter_recv_ok(pkt);
+	}
+
+	end = timing_counter_get();
+
+	(void)npf_remove_all_recv_rules();
+
+	if (accepted != N_PACKETS) {
+		printk("%d rules, %s: %u packets dropped\n", nb_rules, name,
+		       N_PACKETS - accepted);
+		return;
+	}
+
+	ns = timing_cycles_to_ns(timing_cycles_get(&start, &end));
+
+	printk("%d rules, %s: %u packets/s\n", nb_rules, name,
+	       (uint32_t)(((uint64_t)N_PACKETS * NSEC_PER_SEC) / MAX(ns, 1U)));
+}
+
+void main(void)
+{
+	struct net_pkt *pkt;
+
+	pkt = build_pkt();
+	if (pkt == NULL) {
+		printk("Cannot allocate the packet\n");
+		return;
+	}
+
+	timing_init();
+	timing_start();
+
+	for (int i = 0; i < ARRAY_SIZE(rule_counts); i++) {
+		bench_rules("distinct", distinct_rules, rule_counts[i], pkt);
+		bench_rules("shared", shared_rules, rule_counts[i], pkt);
+	}
+
+	timing_stop();
+
+	net_pkt_unref(pkt);
+
+	printk("fin\n");
+}
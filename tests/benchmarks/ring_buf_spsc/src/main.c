@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/zephyr.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/ring_buffer.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/irq_offload.h>
+
+/* Ring buffer throughput and interrupt cost benchmark.
+ *
+ * Data is streamed through a ring buffer in chunks, once through a
+ * struct ring_buf guarded by a spinlock on both sides, which is how drivers
+ * share one between an ISR and a thread, and once through the lock-free
+ * struct ring_buf_spsc. Each chunk is put and then got back, so the figures
+ * are the cost of one transfer on both ends.
+ *
+ * The interrupt cost is the time spent in an ISR that puts one chunk,
+ * measured from inside the handler.
+ */
+
+#define BUF_SIZE	256
+#define TOTAL_BYTES	(64 * 1024)
+#define N_ISR		1000
+
+static const uint32_t chunks[] = { 1, 4, 16, 64 };
+
+static uint8_t locked_data[BUF_SIZE] __aligned(4);
+static struct ring_buf locked_buf;
+static struct k_spinlock lock;
+
+RING_BUF_SPSC_DECLARE(spsc_buf, BUF_SIZE);
+
+static uint8_t src[64 + 1] __aligned(4);
+static uint8_t dst[64 + 1] __aligned(4);
+
+static void locked_put(const uint8_t *data, uint32_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	(void)ring_buf_put(&locked_buf, data, size);
+	k_spin_unlock(&lock, key);
+}
+
+static void locked_get(uint8_t *data, uint32_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	(void)ring_buf_get(&locked_buf, data, size);
+	k_spin_unlock(&lock, key);
+}
+
+static void spsc_put(const uint8_t *data, uint32_t size)
+{
+	(void)ring_buf_spsc_put(&spsc_buf, data, size);
+}
+
+static void spsc_get(uint8_t *data, uint32_t size)
+{
+	(void)ring_buf_spsc_get(&spsc_buf, data, size);
+}
+
+struct variant {
+	const char *name;
+	void (*put)(const uint8_t *data, uint32_t size);
+	void (*get)(uint8_t *data, uint32_t size);
+};
+
+static const struct variant variants[] = {
+	{ "locked", locked_put, locked_get },
+	{ "spsc", spsc_put, spsc_get },
+};
+
+static void reset(void)
+{
+	ring_buf_init(&locked_buf, sizeof(locked_data), locked_data);
+	ring_buf_spsc_init(&spsc_buf, BUF_SIZE, spsc_buf.buffer);
+}
+
+static void report(const char *name, const char *what, uint32_t size,
+		   uint64_t cycles, uint32_t count)
+{
+	uint64_t ns = timing_cycles_to_ns(cycles);
+	uint64_t kib_s = (ns == 0U) ? 0U :
+		((uint64_t)size * count * NSEC_PER_SEC) / (ns * 1024U);
+
+	printk("%s%s %u B: %u cycles, %u KiB/s\n", name, what, size,
+	       (uint32_t)(cycles / count), (uint32_t)kib_s);
+}
+
+static void run_stream(const struct variant *v, uint32_t size,
+		       const uint8_t *data, const char *what)
+{
+	uint32_t count = TOTAL_BYTES / size;
+	timing_t start, end;
+
+	reset();
+
+	start = timing_counter_get();
+	for (uint32_t i = 0; i < count; i++) {
+		v->put(data, size);
+		v->get(dst, size);
+	}
+	end = timing_counter_get();
+
+	report(v->name, what, size, timing_cycles_get(&start, &end), count);
+}
+
+static const struct variant *isr_variant;
+static uint32_t isr_size;
+static uint64_t isr_cycles;
+
+static void isr_put(const void *arg)
+{
+	timing_t start, end;
+
+	ARG_UNUSED(arg);
+
+	start = timing_counter_get();
+	isr_variant->put(src, isr_size);
+	end = timing_counter_get();
+
+	isr_cycles += timing_cycles_get(&start, &end);
+}
+
+static void run_isr(const struct variant *v, uint32_t size)
+{
+	isr_variant = v;
+	isr_size = size;
+	isr_cycles = 0U;
+
+	reset();
+
+	for (int i = 0; i < N_ISR; i++) {
+		irq_offload(isr_put, NULL);
+		v->get(dst, size);
+	}
+
+	printk("%s isr %u B: %u cycles\n", v->name, size,
+	       (uint32_t)(isr_cycles / N_ISR));
+}
+
+void main(void)
+{
+	for (int i = 0; i < sizeof(src); i++) {
+		src[i] = i;
+	}
+
+	timing_init();
+	timing_start();
+
+	for (int c = 0; c < ARRAY_SIZE(chunks); c++) {
+		for (int v = 0; v < ARRAY_SIZE(variants); v++) {
+			run_stream(&variants[v], chunks[c], src, "");
+		}
+	}
+
+	/* Word sized transfers from unaligned data */
+	for (int v = 0; v < ARRAY_SIZE(variants); v++) {
+		run_stream(&variants[v], 64, &src[1], " unaligned");
+	}
+
+	for (int v = 0; v < ARRAY_SIZE(variants); v++) {
+		run_isr(&variants[v], 16);
+	}
+
+	timing_stop();
+
+	printk("fin\n");
+}
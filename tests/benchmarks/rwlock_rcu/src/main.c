@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/zephyr.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/timing/timing.h>
+
+/* Read-mostly synchronization benchmark.
+ *
+ * One reader thread per CPU repeatedly reads a small shared structure
+ * under a k_mutex, under a k_rwlock held for reading and in an RCU
+ * read-side critical section. The mutex serializes the readers, while the
+ * other two let them run in parallel, so on SMP the cost per read should
+ * stay flat for them as CPUs are added. Build with CONFIG_MP_NUM_CPUS set
+ * to 1, 2 and 4 to compare.
+ */
+
+#define N_READERS	CONFIG_MP_NUM_CPUS
+#define N_READS		10000
+#define STACK_SIZE	(1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+struct data {
+	uint32_t a;
+	uint32_t b;
+};
+
+static struct data copy;
+static struct data *shared = &copy;
+static volatile uint32_t sink;
+
+static K_MUTEX_DEFINE(mutex);
+static K_RWLOCK_DEFINE(rwlock);
+
+K_THREAD_STACK_ARRAY_DEFINE(reader_stacks, N_READERS, STACK_SIZE);
+static struct k_thread reader_threads[N_READERS];
+
+static void read_mutex(void)
+{
+	k_mutex_lock(&mutex, K_FOREVER);
+	sink += shared->a + shared->b;
+	k_mutex_unlock(&mutex);
+}
+
+static void read_rwlock(void)
+{
+	k_rwlock_rdlock(&rwlock, K_FOREVER);
+	sink += shared->a + shared->b;
+	k_rwlock_rdunlock(&rwlock);
+}
+
+static void read_rcu(void)
+{
+	struct data *d;
+
+	k_rcu_read_lock();
+	d = k_rcu_dereference(shared);
+	sink += d->a + d->b;
+	k_rcu_read_unlock();
+}
+
+struct variant {
+	const char *name;
+	void (*read)(void);
+};
+
+static const struct variant variants[] = {
+	{ "mutex", read_mutex },
+	{ "rwlock", read_rwlock },
+	{ "rcu", read_rcu },
+};
+
+static void reader(void *p1, void *p2, void *p3)
+{
+	const struct variant *v = p1;
+
+	for (int i = 0; i < N_READS; i++) {
+		v->read();
+	}
+}
+
+static void run(const struct variant *v)
+{
+	timing_t start, end;
+	uint64_t cycles;
+
+	/* Create all readers first so that they start together */
+	for (int i = 0; i < N_READERS; i++) {
+		k_thread_create(&reader_threads[i], reader_stacks[i],
+				STACK_SIZE, reader, (void *)v, NULL, NULL,
+				K_PRIO_PREEMPT(1), 0, K_FOREVER);
+	}
+
+	start = timing_counter_get();
+	for (int i = 0; i < N_READERS; i++) {
+		k_thread_start(&reader_threads[i]);
+	}
+	for (int i = 0; i < N_READERS; i++) {
+		k_thread_join(&reader_threads[i], K_FOREVER);
+	}
+	end = timing_counter_get();
+
+	cycles = timing_cycles_get(&start, &end);
+
+	printk("%s, %u readers: %u cycles per read\n", v->name, N_READERS,
+	       (uint32_t)(cycles / N_READS));
+}
+
+void main(void)
+{
+	timing_init();
+	timing_start();
+
+	/* Let the readers run while main waits for them */
+	k_thread_priority_set(k_current_get(), K_PRIO_COOP(1));
+
+	for (int v = 0; v < ARRAY_SIZE(variants); v++) {
+		run(&variants[v]);
+	}
+
+	timing_stop();
+
+	printk("fin\n");
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <zephyr/zephyr.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/settings/settings.h>
+
+/* Settings FCB benchmark.
+ *
+ * Fills the settings FCB with N_UPDATES generations of N_NAMES settings,
+ * the way counters and configuration updated at run time accumulate, then
+ * loads them back. Flash reads are charged by the flash simulator, so the
+ * reported times follow the number of reads the back-end makes.
+ *
+ * Build with and without CONFIG_FCB_ENTRY_INDEX and
+ * CONFIG_SETTINGS_FCB_NAME_MAP and compare the reported times.
+ */
+
+#define N_NAMES		32
+#define N_UPDATES	8
+
+static uint32_t values[N_NAMES];
+static uint32_t loaded;
+
+static int bench_set(const char *name, size_t len, settings_read_cb read_cb,
+		     void *cb_arg)
+{
+	unsigned int idx;
+
+	if ((sscanf(name, "k%u", &idx) != 1) || (idx >= N_NAMES) ||
+	    (len != sizeof(values[0]))) {
+		return -ENOENT;
+	}
+
+	loaded++;
+
+	return (read_cb(cb_arg, &values[idx], len) == len) ? 0 : -EIO;
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(bench, "bench", NULL, bench_set, NULL, NULL);
+
+void main(void)
+{
+	const struct flash_area *fap;
+	char name[16];
+	uint32_t start, cycles;
+	int rc;
+
+	rc = flash_area_open(FLASH_AREA_ID(storage), &fap);
+	if (rc == 0) {
+		rc = flash_area_erase(fap, 0, fap->fa_size);
+		flash_area_close(fap);
+	}
+	if (rc == 0) {
+		rc = settings_subsys_init();
+	}
+	if (rc != 0) {
+		printk("settings init failed (%d)\n", rc);
+		return;
+	}
+
+	start = k_cycle_get_32();
+	for (uint32_t gen = 0; gen < N_UPDATES; gen++) {
+		for (int i = 0; i < N_NAMES; i++) {
+			uint32_t val = gen * N_NAMES + i;
+
+			snprintf(name, sizeof(name), "bench/k%u", i);
+			rc = settings_save_one(name, &val, sizeof(val));
+			if (rc != 0) {
+				printk("save of %s failed (%d)\n", name, rc);
+				return;
+			}
+		}
+	}
+	cycles = k_cycle_get_32() - start;
+	printk("save: %u us\n", (uint32_t)k_cyc_to_us_floor64(cycles));
+
+	start = k_cycle_get_32();
+	rc = settings_load();
+	cycles = k_cycle_get_32() - start;
+	if (rc != 0) {
+		printk("load failed (%d)\n", rc);
+		return;
+	}
+
+	for (int i = 0; i < N_NAMES; i++) {
+		if (values[i] != (N_UPDATES - 1) * N_NAMES + i) {
+			printk("k%d loaded as %u\n", i, values[i]);
+		}
+	}
+
+	printk("load: %u us, %u values\n", (uint32_t)k_cyc_to_us_floor64(cycles),
+	       loaded);
+	printk("fin\n");
+}
@@ -0,0 +1,113 @@
+/* mutex.c */
+
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "syskernel.h"
+
+struct k_mutex mutex1;
+
+/* Shared data of the critical section */
+static volatile uint32_t shared;
+
+/**
+ *
+ * @brief Mutex test thread
+ *
+ * Locks the mutex and holds it across a yield, so that the other thread
+ * running the same loop finds it locked.
+ *
+ * @param par1   Address of the counter, or NULL.
+ * @param par2   Number of test loops.
+ * @param par3   Unused
+ *
+ */
+void mutex_thread(void *par1, void *par2, void *par3)
+{
+	int i;
+	int *pcounter = (int *)par1;
+	int num_loops = POINTER_TO_INT(par2);
+
+	ARG_UNUSED(par3);
+
+	for (i = 0; i < num_loops; i++) {
+		k_mutex_lock(&mutex1, K_FOREVER);
+		shared++;
+		k_yield();
+		shared++;
+		k_mutex_unlock(&mutex1);
+		if (pcounter != NULL) {
+			(*pcounter)++;
+		}
+	}
+}
+
+
+/**
+ *
+ * @brief The main test entry
+ *
+ * @return 1 if success and 0 on failure
+ */
+int mutex_test(void)
+{
+	uint32_t t;
+	int i = 0;
+	int return_value = 0;
+
+	fprintf(output_file, sz_test_case_fmt,
+			"Mutex #1");
+	fprintf(output_file, sz_description,
+			"\n\tk_mutex_init"
+			"\n\tk_mutex_lock(K_FOREVER), uncontended"
+			"\n\tk_mutex_unlock");
+	printf(sz_test_start_fmt);
+
+	k_mutex_init(&mutex1);
+
+	t = BENCH_START();
+
+	for (i = 0; i < number_of_loops; i++) {
+		k_mutex_lock(&mutex1, K_FOREVER);
+		shared++;
+		k_mutex_unlock(&mutex1);
+	}
+
+	t = TIME_STAMP_DELTA_GET(t);
+
+	return_value += check_result(i, t);
+
+	fprintf(output_file, sz_test_case_fmt,
+			"Mutex #2");
+	fprintf(output_file, sz_description,
+			"\n\tk_mutex_init"
+			"\n\tk_mutex_lock(K_FOREVER), contended"
+			"\n\tk_mutex_unlock");
+	printf(sz_test_start_fmt);
+
+	k_mutex_init(&mutex1);
+	i = 0;
+
+	t = BENCH_START();
+
+	/* Start both threads together so that they contend from the start */
+	k_thread_create(&thread_data1, thread_stack1, STACK_SIZE, mutex_thread,
+			 NULL, INT_TO_POINTER(number_of_loops), NULL,
+			 K_PRIO_COOP(3), 0, K_FOREVER);
+	k_thread_create(&thread_data2, thread_stack2, STACK_SIZE, mutex_thread,
+			 (void *) &i, INT_TO_POINTER(number_of_loops), NULL,
+			 K_PRIO_COOP(3), 0, K_FOREVER);
+	k_thread_start(&thread_data1);
+	k_thread_start(&thread_data2);
+	k_thread_join(&thread_data1, K_FOREVER);
+	k_thread_join(&thread_data2, K_FOREVER);
+
+	t = TIME_STAMP_DELTA_GET(t);
+
+	return_value += check_result(i, t);
+
+	return return_value;
+}
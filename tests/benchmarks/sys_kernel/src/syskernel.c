@@ -29,6 +29,13 @@ const char sz_fail[] = "FAILED";
 /* time necessary to read the time */
 uint32_t tm_off;
 
+/* sema/lifo/fifo/stack/mem_slab account for 14 tests, mutex for 2 */
+#if CONFIG_MP_NUM_CPUS == 1
+#define N_TESTS 16
+#else
+#define N_TESTS 2
+#endif
+
 /* Holds the loop count that need to be carried out. */
 uint32_t number_of_loops;
 
@@ -157,15 +164,18 @@ void main(void)
 
 		test_result = 0;
 
+#if CONFIG_MP_NUM_CPUS == 1
 		test_result += sema_test();
 		test_result += lifo_test();
 		test_result += fifo_test();
 		test_result += stack_test();
 		test_result += mem_slab_test();
+#endif
+		/* The mutex tests are also meant to compare SMP configurations */
+		test_result += mutex_test();
 
 		if (test_result) {
-			/* sema/lifo/fifo/stack/mem_slab account for 14 tests in total */
-			if (test_result == 14) {
+			if (test_result == N_TESTS) {
 				fprintf(output_file, sz_module_result_fmt,
 					sz_success);
 			} else {
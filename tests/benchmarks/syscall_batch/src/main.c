@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/zephyr.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/syscall_batch.h>
+
+/* Batched system call benchmark.
+ *
+ * A user thread gives a semaphore N_OPS times, once with one system call
+ * per give and once through a k_syscall_ring holding BATCH requests. The
+ * time is taken by the supervisor thread around the run of the user thread,
+ * minus the time of a run doing nothing, which is the cost of creating and
+ * joining the thread.
+ */
+
+#define N_OPS		8192
+#define MAX_BATCH	32
+#define STACK_SIZE	1024
+
+K_SEM_DEFINE(sem, 0, 1);
+
+static K_THREAD_STACK_DEFINE(user_stack, STACK_SIZE);
+static struct k_thread user_thread;
+
+static void user_single(void *p1, void *p2, void *p3)
+{
+	uint32_t ops = POINTER_TO_UINT(p1);
+
+	for (uint32_t i = 0; i < ops; i++) {
+		k_sem_give(&sem);
+	}
+}
+
+static void user_batch(void *p1, void *p2, void *p3)
+{
+	struct k_syscall_req reqs[MAX_BATCH];
+	struct k_syscall_ring ring;
+	uint32_t ops = POINTER_TO_UINT(p1);
+	uint32_t batch = POINTER_TO_UINT(p2);
+
+	k_syscall_ring_init(&ring, reqs, batch);
+
+	for (uint32_t i = 0; i < ops; i += batch) {
+		for (uint32_t j = 0; j < batch; j++) {
+			struct k_syscall_req *req;
+
+			req = k_syscall_ring_push(&ring, K_SYSCALL_K_SEM_GIVE);
+			req->args[0] = (uintptr_t)&sem;
+		}
+
+		(void)k_syscall_ring_submit(&ring);
+	}
+}
+
+static uint32_t run(k_thread_entry_t entry, uint32_t ops, uint32_t batch)
+{
+	uint32_t start;
+
+	k_thread_create(&user_thread, user_stack, STACK_SIZE, entry,
+			UINT_TO_POINTER(ops), UINT_TO_POINTER(batch), NULL,
+			K_PRIO_PREEMPT(0), K_USER, K_FOREVER);
+
+	start = k_cycle_get_32();
+	k_thread_start(&user_thread);
+	k_thread_join(&user_thread, K_FOREVER);
+
+	return k_cycle_get_32() - start;
+}
+
+static void report(const char *name, k_thread_entry_t entry, uint32_t batch)
+{
+	uint32_t base = run(entry, 0, batch);
+	uint32_t cycles = run(entry, N_OPS, batch);
+	uint64_t ns = k_cyc_to_ns_floor64((cycles > base) ? (cycles - base) : 1U);
+
+	printk("%s: %u ops/s\n", name,
+	       (uint32_t)(((uint64_t)N_OPS * NSEC_PER_SEC) / MAX(ns, 1U)));
+}
+
+void main(void)
+{
+	k_object_access_all_grant(&sem);
+
+	report("single", user_single, 1);
+	report("batch 8", user_batch, 8);
+	report("batch 32", user_batch, 32);
+
+	printk("fin\n");
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/zephyr.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/timing/timing.h>
+#ifdef CONFIG_PTHREAD_POOL
+#include <zephyr/posix/pthread.h>
+#endif
+
+/* Short-lived thread benchmark.
+ *
+ * A worker thread that returns at once is created and waited for
+ * repeatedly, with k_thread_create() on a stack owned by the caller, with
+ * k_thread_pool_spawn(), and with pthread_create() backed by the pthread
+ * thread pool when CONFIG_PTHREAD_POOL is enabled. The worker runs at a
+ * higher priority than the main thread, so each iteration covers creating,
+ * running and exiting the thread, and waking up the main thread.
+ *
+ * The ID of a pool thread must not be joined once the thread may have
+ * exited, so the pool worker signals its completion with a semaphore
+ * instead.
+ */
+
+#define N_ITERATIONS	1000
+#define STACK_SIZE	(1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define PRIO		K_PRIO_PREEMPT(1)
+
+K_THREAD_STACK_DEFINE(worker_stack, STACK_SIZE);
+static struct k_thread worker_thread;
+K_THREAD_POOL_DEFINE(worker_pool, 1, STACK_SIZE);
+static volatile uint32_t runs;
+K_SEM_DEFINE(pool_done, 0, 1);
+
+static void worker(void *p1, void *p2, void *p3)
+{
+	runs++;
+}
+
+static void pool_worker(void *p1, void *p2, void *p3)
+{
+	runs++;
+	k_sem_give(&pool_done);
+}
+
+static void run_create(void)
+{
+	k_thread_create(&worker_thread, worker_stack, STACK_SIZE, worker,
+			NULL, NULL, NULL, PRIO, 0, K_NO_WAIT);
+	k_thread_join(&worker_thread, K_FOREVER);
+}
+
+static void run_pool(void)
+{
+	(void)k_thread_pool_spawn(&worker_pool, pool_worker, NULL, NULL, NULL,
+				  PRIO, 0, K_NO_WAIT);
+	k_sem_take(&pool_done, K_FOREVER);
+}
+
+#ifdef CONFIG_PTHREAD_POOL
+static void *pthread_worker(void *arg)
+{
+	runs++;
+
+	return NULL;
+}
+
+static void run_pthread(void)
+{
+	pthread_t thread;
+
+	(void)pthread_create(&thread, NULL, pthread_worker, NULL);
+	(void)pthread_join(thread, NULL);
+}
+#endif
+
+static void run(const char *name, void (*fn)(void))
+{
+	timing_t start, end;
+	uint64_t cycles;
+
+	runs = 0U;
+
+	start = timing_counter_get();
+	for (int i = 0; i < N_ITERATIONS; i++) {
+		fn();
+	}
+	end = timing_counter_get();
+
+	cycles = timing_cycles_get(&start, &end);
+
+	if (runs != N_ITERATIONS) {
+		printk("%s: %u of %u threads ran\n", name, runs, N_ITERATIONS);
+	}
+	printk("%s: %u cycles per thread\n", name,
+	       (uint32_t)(cycles / N_ITERATIONS));
+}
+
+void main(void)
+{
+	timing_init();
+	timing_start();
+
+	k_thread_priority_set(k_current_get(), K_PRIO_PREEMPT(2));
+
+	run("k_thread_create", run_create);
+	run("k_thread_pool_spawn", run_pool);
+#ifdef CONFIG_PTHREAD_POOL
+	run("pthread_create", run_pthread);
+#endif
+
+	timing_stop();
+
+	printk("fin\n");
+}
@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <fcntl.h>
+#include <zephyr/zephyr.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/tls_credentials.h>
+
+/* TLS handshake benchmark.
+ *
+ * A TLS server on the loopback interface accepts connections, reads one
+ * byte and closes them. The client connects a number of times with an
+ * ECDHE-PSK ciphersuite, first with the session cache disabled so that every
+ * connection runs a full handshake, then with the session cache enabled so
+ * that the connections resume the session of the first one, with a session
+ * ticket as the server issues them.
+ *
+ * Finally the client connects with non-blocking sockets, whose handshakes
+ * are run by the TLS handshake thread, and measures the time spent in
+ * connect() against the time until poll() reports the socket as writable.
+ */
+
+#define N_CONNECTIONS	20
+#define SERVER_PORT	4243
+#define PSK_TAG		1
+#define STACK_SIZE	8192
+
+/* TLS-ECDHE-PSK-WITH-AES-128-CBC-SHA256 */
+#define CIPHERSUITE	0xC037
+
+static const unsigned char psk[] = {
+	0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+	0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+};
+static const char psk_id[] = "bench_identity";
+
+static const sec_tag_t sec_tags[] = {
+	PSK_TAG,
+};
+
+static struct sockaddr_in server_addr = {
+	.sin_family = AF_INET,
+	.sin_port = htons(SERVER_PORT),
+	.sin_addr = INADDR_LOOPBACK_INIT,
+};
+
+static int listen_sock;
+
+static void server(void *p1, void *p2, void *p3)
+{
+	uint8_t byte;
+	int sock;
+
+	while (true) {
+		sock = accept(listen_sock, NULL, NULL);
+		if (sock < 0) {
+			continue;
+		}
+
+		(void)recv(sock, &byte, sizeof(byte), 0);
+		(void)close(sock);
+	}
+}
+
+K_THREAD_DEFINE(server_thread, STACK_SIZE, server, NULL, NULL, NULL,
+		K_PRIO_PREEMPT(1), 0, -1);
+
+static int tls_socket(bool cache)
+{
+	int ciphersuites[] = { CIPHERSUITE };
+	int cache_opt = cache ? TLS_SESSION_CACHE_ENABLED :
+				TLS_SESSION_CACHE_DISABLED;
+	int sock;
+
+	sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TLS_1_2);
+	if (sock < 0) {
+		return sock;
+	}
+
+	(void)setsockopt(sock, SOL_TLS, TLS_SEC_TAG_LIST, sec_tags,
+			 sizeof(sec_tags));
+	(void)setsockopt(sock, SOL_TLS, TLS_CIPHERSUITE_LIST, ciphersuites,
+			 sizeof(ciphersuites));
+	(void)setsockopt(sock, SOL_TLS, TLS_SESSION_CACHE, &cache_opt,
+			 sizeof(cache_opt));
+
+	return sock;
+}
+
+static int server_start(void)
+{
+	int cache_opt = TLS_SESSION_CACHE_ENABLED;
+	int ret;
+
+	ret = tls_credential_add(PSK_TAG, TLS_CREDENTIAL_PSK, psk, sizeof(psk));
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = tls_credential_add(PSK_TAG, TLS_CREDENTIAL_PSK_ID, psk_id,
+				 strlen(psk_id));
+	if (ret < 0) {
+		return ret;
+	}
+
+	listen_sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TLS_1_2);
+	if (listen_sock < 0) {
+		return -errno;
+	}
+
+	(void)setsockopt(listen_sock, SOL_TLS, TLS_SEC_TAG_LIST, sec_tags,
+			 sizeof(sec_tags));
+	(void)setsockopt(listen_sock, SOL_TLS, TLS_SESSION_CACHE, &cache_opt,
+			 sizeof(cache_opt));
+
+	if (bind(listen_sock, (struct sockaddr *)&server_addr,
+		 sizeof(server_addr)) < 0 || listen(listen_sock, 2) < 0) {
+		return -errno;
+	}
+
+	k_thread_start(server_thread);
+
+	return 0;
+}
+
+static void print_result(const char *name, uint64_t cycles)
+{
+	printk("%s: %u us, %u cycles per handshake\n", name,
+	       (uint32_t)(timing_cycles_to_ns_avg(cycles, N_CONNECTIONS) /
+			  NSEC_PER_USEC),
+	       (uint32_t)(cycles / N_CONNECTIONS));
+}
+
+static int bench_blocking(const char *name, bool cache)
+{
+	uint64_t cycles = 0;
+	timing_t start, end;
+	uint8_t byte = 0;
+	int sock;
+	int i;
+
+	/* The first connection is not measured, it establishes the session
+	 * the next ones resume.
+	 */
+	for (i = 0; i <= N_CONNECTIONS; i++) {
+		sock = tls_socket(cache);
+		if (sock < 0) {
+			return -errno;
+		}
+
+		start = timing_counter_get();
+		if (connect(sock, (struct sockaddr *)&server_addr,
+			    sizeof(server_addr)) < 0) {
+			(void)close(sock);
+			return -errno;
+		}
+		end = timing_counter_get();
+
+		if (i > 0) {
+			cycles += timing_cycles_get(&start, &end);
+		}
+
+		(void)send(sock, &byte, sizeof(byte), 0);
+		(void)close(sock);
+	}
+
+	print_result(name, cycles);
+
+	return 0;
+}
+
+static int bench_offload(void)
+{
+	uint64_t connect_cycles = 0;
+	uint64_t cycles = 0;
+	struct zsock_pollfd fds;
+	timing_t start, connected, end;
+	uint8_t byte = 0;
+	int sock;
+	int i;
+
+	for (i = 0; i < N_CONNECTIONS; i++) {
+		sock = tls_socket(false);
+		if (sock < 0) {
+			return -errno;
+		}
+
+		(void)fcntl(sock, F_SETFL, O_NONBLOCK);
+
+		start = timing_counter_get();
+		if (connect(sock, (struct sockaddr *)&server_addr,
+			    sizeof(server_addr)) < 0 && errno != EINPROGRESS) {
+			(void)close(sock);
+			return -errno;
+		}
+		connected = timing_counter_get();
+
+		fds.fd = sock;
+		fds.events = ZSOCK_POLLOUT;
+		if (poll(&fds, 1, SYS_FOREVER_MS) != 1 ||
+		    !(fds.revents & ZSOCK_POLLOUT)) {
+			(void)close(sock);
+			return -ECONNABORTED;
+		}
+		end = timing_counter_get();
+
+		connect_cycles += timing_cycles_get(&start, &connected);
+		cycles += timing_cycles_get(&start, &end);
+
+		(void)send(sock, &byte, sizeof(byte), 0);
+		(void)close(sock);
+	}
+
+	print_result("offloaded handshake, connect()", connect_cycles);
+	print_result("offloaded handshake, complete", cycles);
+
+	return 0;
+}
+
+void main(void)
+{
+	int ret;
+
+	timing_init();
+	timing_start();
+
+	ret = server_start();
+	if (ret < 0) {
+		printk("Cannot start the server (%d)\n", ret);
+		return;
+	}
+
+	ret = bench_blocking("full handshake", false);
+	if (ret == 0) {
+		ret = bench_blocking("resumed handshake", true);
+	}
+
+	if (ret == 0 && IS_ENABLED(CONFIG_NET_SOCKETS_TLS_HANDSHAKE_OFFLOAD)) {
+		ret = bench_offload();
+	}
+
+	if (ret < 0) {
+		printk("Handshake failed (%d)\n", ret);
+	}
+
+	timing_stop();
+
+	printk("fin\n");
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * FPU context switch statistics test
+ *
+ * This module checks that the floating point context of a thread created
+ * with floating point support is only switched in once the thread actually
+ * executes floating point instructions.
+ */
+
+#include <ztest.h>
+
+#include "test_common.h"
+
+#ifdef CONFIG_FPU_SHARING_STATS
+
+static K_THREAD_STACK_DEFINE(stats_thread_stack, THREAD_STACK_SIZE);
+static struct k_thread stats_thread;
+
+static volatile double stats_acc;
+
+static void no_fp_entry(void *p1, void *p2, void *p3)
+{
+	k_yield();
+}
+
+static void fp_entry(void *p1, void *p2, void *p3)
+{
+	stats_acc = stats_acc * 1.5 + 1.0;
+	k_yield();
+	stats_acc = stats_acc * 1.5 + 1.0;
+}
+
+static void run_stats_thread(k_thread_entry_t entry,
+			     struct k_float_stats *stats)
+{
+	k_thread_create(&stats_thread, stats_thread_stack, THREAD_STACK_SIZE,
+			entry, NULL, NULL, NULL,
+			K_PRIO_COOP(THREAD_HIGH_PRIORITY), THREAD_FP_FLAGS,
+			K_NO_WAIT);
+	k_thread_join(&stats_thread, K_FOREVER);
+
+	k_float_stats_get(&stats_thread, stats);
+}
+
+void test_float_stats(void)
+{
+	struct k_float_stats stats;
+
+	/**TESTPOINT: no FP context is loaded for a thread not using the FPU */
+	run_stats_thread(no_fp_entry, &stats);
+	zassert_equal(stats.loads, 0, "%u FP context loads", stats.loads);
+	zassert_equal(stats.saves, 0, "%u FP context saves", stats.saves);
+
+	/**TESTPOINT: the FP context of a thread using the FPU is loaded */
+	run_stats_thread(fp_entry, &stats);
+	zassert_true(stats.loads >= 1, "no FP context load");
+}
+
+#else
+
+void test_float_stats(void)
+{
+	ztest_test_skip();
+}
+
+#endif /* CONFIG_FPU_SHARING_STATS */
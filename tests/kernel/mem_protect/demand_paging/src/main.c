@@ -111,6 +111,26 @@ void print_paging_stats(struct k_mem_paging_stats_t *stats, const char *scope)
 	       stats->eviction.clean);
 	printk("    - Dirty pages evicted: %lu\n",
 	       stats->eviction.dirty);
+
+#ifdef CONFIG_DEMAND_PAGING_PREFETCH
+	printk("* Prefetch (%s):\n", scope);
+	printk("    - Batches: %lu\n", stats->prefetch.batches);
+	printk("    - Pages prefetched: %lu\n", stats->prefetch.pages);
+#endif
+
+#ifdef CONFIG_DEMAND_PAGING_REGION_STATS
+	static const char * const region_names[] = { "image", "anon" };
+
+	for (int i = 0; i < K_MEM_PAGING_REGION_NUM; i++) {
+		printk("* Region %s (%s):\n", region_names[i], scope);
+		printk("    - Page faults: %lu (%lu/s)\n",
+		       stats->regions[i].faults, stats->regions[i].fault_rate);
+		printk("    - Resident pages: %lu\n",
+		       stats->regions[i].resident);
+		printk("    - Working set: %lu\n",
+		       stats->regions[i].working_set);
+	}
+#endif
 }
 
 void test_touch_anon_pages(void)
@@ -153,6 +173,15 @@ void test_touch_anon_pages(void)
 	print_paging_stats(&stats, "kernel");
 	zassert_not_equal(stats.eviction.dirty, 0UL,
 			  "there should be dirty pages being evicted.");
+#ifdef CONFIG_DEMAND_PAGING_REGION_STATS
+	zassert_not_equal(stats.regions[K_MEM_PAGING_REGION_ANON].faults, 0UL,
+			  "anonymous memory faults not accounted to its region");
+	zassert_not_equal(stats.regions[K_MEM_PAGING_REGION_ANON].resident, 0UL,
+			  "no anonymous memory pages resident");
+	zassert_true(stats.regions[K_MEM_PAGING_REGION_ANON].working_set <=
+		     stats.regions[K_MEM_PAGING_REGION_ANON].resident,
+		     "working set larger than resident pages");
+#endif /* CONFIG_DEMAND_PAGING_REGION_STATS */
 
 #ifdef CONFIG_EVICTION_NRU
 	k_msleep(CONFIG_EVICTION_NRU_PERIOD * 2);
@@ -190,16 +219,34 @@ void test_touch_anon_pages(void)
 	}
 }
 
+#ifdef CONFIG_DEMAND_PAGING_PREFETCH
+/* The first fault of a sequential access pages in one page, each following
+ * one the faulting page and up to CONFIG_DEMAND_PAGING_PREFETCH_PAGES after
+ * it.
+ */
+#define HALF_SEQ_FAULTS	(1 + ceiling_fraction(HALF_PAGES - 1, \
+					      CONFIG_DEMAND_PAGING_PREFETCH_PAGES + 1))
+#else
+#define HALF_SEQ_FAULTS	HALF_PAGES
+#endif
+
 void test_k_mem_page_out(void)
 {
-	unsigned long faults;
+	unsigned long write_faults, read_faults;
+	size_t bad = HALF_BYTES;
 	int key, ret;
 
 	/* Lock IRQs to prevent other pagefaults from happening while we
 	 * are measuring stuff
 	 */
 	key = irq_lock();
-	faults = z_num_pagefaults_get();
+
+	/* Make the page after the region resident, so that prefetching stops
+	 * at the end of the region
+	 */
+	(void)*(volatile char *)&arena[HALF_BYTES];
+
+	write_faults = z_num_pagefaults_get();
 	ret = k_mem_page_out(arena, HALF_BYTES);
 	zassert_equal(ret, 0, "k_mem_page_out failed with %d", ret);
 
@@ -207,12 +254,32 @@ void test_k_mem_page_out(void)
 	for (size_t i = 0; i < HALF_BYTES; i++) {
 		arena[i] = nums[i % 10];
 	}
-	faults = z_num_pagefaults_get() - faults;
+	write_faults = z_num_pagefaults_get() - write_faults;
+
+	/* Evict the written pages and read them back, which pages them in
+	 * from the backing store, prefetched ones included
+	 */
+	ret = k_mem_page_out(arena, HALF_BYTES);
+	zassert_equal(ret, 0, "k_mem_page_out failed with %d", ret);
+
+	read_faults = z_num_pagefaults_get();
+	for (size_t i = 0; i < HALF_BYTES; i++) {
+		if (arena[i] != nums[i % 10]) {
+			bad = i;
+			break;
+		}
+	}
+	read_faults = z_num_pagefaults_get() - read_faults;
 	irq_unlock(key);
 
-	zassert_equal(faults, HALF_PAGES,
-		      "unexpected num pagefaults expected %lu got %d",
-		      HALF_PAGES, faults);
+	zassert_equal(write_faults, HALF_SEQ_FAULTS,
+		      "unexpected num pagefaults expected %lu got %lu",
+		      (unsigned long)HALF_SEQ_FAULTS, write_faults);
+	zassert_equal(bad, HALF_BYTES, "wrong data read back at offset %zu",
+		      bad);
+	zassert_equal(read_faults, HALF_SEQ_FAULTS,
+		      "unexpected num pagefaults reading back expected %lu "
+		      "got %lu", (unsigned long)HALF_SEQ_FAULTS, read_faults);
 
 	ret = k_mem_page_out(arena, arena_size);
 	zassert_equal(ret, -ENOMEM, "k_mem_page_out should have failed");
@@ -6,6 +6,7 @@
 
 #include <zephyr/zephyr.h>
 #include <zephyr/syscall_handler.h>
+#include <zephyr/sys/syscall_batch.h>
 #include <ztest.h>
 #include <zephyr/linker/linker-defs.h>
 #include "test_syscalls.h"
@@ -432,6 +433,61 @@ void test_syscall_context(void)
 	k_thread_user_mode_enter(test_syscall_context_user, NULL, NULL, NULL);
 }
 
+K_SEM_DEFINE(batch_sem, 0, 10);
+
+/* Show that queued system calls are executed in order by one submission */
+void test_syscall_batch(void)
+{
+	struct k_syscall_req reqs[4];
+	struct k_syscall_req *req[4];
+	struct k_syscall_ring ring;
+
+	k_syscall_ring_init(&ring, reqs, ARRAY_SIZE(reqs));
+
+	for (int i = 0; i < 3; i++) {
+		req[i] = k_syscall_ring_push(&ring, K_SYSCALL_K_SEM_GIVE);
+		zassert_not_null(req[i], NULL);
+		req[i]->args[0] = (uintptr_t)&batch_sem;
+	}
+	req[3] = k_syscall_ring_push(&ring, K_SYSCALL_K_SEM_COUNT_GET);
+	zassert_not_null(req[3], NULL);
+	req[3]->args[0] = (uintptr_t)&batch_sem;
+	zassert_is_null(k_syscall_ring_push(&ring, K_SYSCALL_K_SEM_GIVE),
+			"pushed to a full ring");
+
+	zassert_equal(k_syscall_ring_submit(&ring), 4, NULL);
+	zassert_equal(ring.head, ring.tail, "requests left in the ring");
+	zassert_equal(req[3]->ret, 3, "wrong semaphore count");
+
+	/* Requests for system calls which are not batchable complete with
+	 * -ENOSYS, the following ones are still executed.
+	 */
+	req[0] = k_syscall_ring_push(&ring, K_SYSCALL_K_SYSCALL_RING_SUBMIT);
+	req[0]->args[0] = (uintptr_t)&ring;
+	req[1] = k_syscall_ring_push(&ring, K_SYSCALL_LIMIT);
+	req[2] = k_syscall_ring_push(&ring, K_SYSCALL_K_SEM_RESET);
+	req[2]->args[0] = (uintptr_t)&batch_sem;
+
+	zassert_equal(k_syscall_ring_submit(&ring), 3, NULL);
+	zassert_equal((int)req[0]->ret, -ENOSYS, NULL);
+	zassert_equal((int)req[1]->ret, -ENOSYS, NULL);
+	zassert_equal(k_sem_count_get(&batch_sem), 0, "semaphore not reset");
+
+	/* Inconsistent ring state */
+	ring.tail = ring.head + ARRAY_SIZE(reqs) + 1;
+	zassert_equal(k_syscall_ring_submit(&ring), -EINVAL, NULL);
+}
+
+/* Batches are only meant for user threads */
+void test_syscall_batch_supervisor(void)
+{
+	struct k_syscall_req reqs[1];
+	struct k_syscall_ring ring;
+
+	k_syscall_ring_init(&ring, reqs, ARRAY_SIZE(reqs));
+	zassert_equal(k_syscall_ring_submit(&ring), -ENOTSUP, NULL);
+}
+
 K_HEAP_DEFINE(test_heap, BUF_SIZE * (4 * NR_THREADS));
 
 void test_main(void)
@@ -439,6 +495,7 @@ void test_main(void)
 	sprintf(kernel_string, "this is a kernel string");
 	sprintf(user_string, "this is a user string");
 	k_thread_heap_assign(k_current_get(), &test_heap);
+	k_object_access_all_grant(&batch_sem);
 
 	ztest_test_suite(syscalls,
 			 ztest_unit_test(test_string_nlen),
@@ -449,7 +506,9 @@ void test_main(void)
 			 ztest_user_unit_test(test_arg64),
 			 ztest_user_unit_test(test_more_args),
 			 ztest_unit_test(test_syscall_torture),
-			 ztest_unit_test(test_syscall_context)
+			 ztest_unit_test(test_syscall_context),
+			 ztest_user_unit_test(test_syscall_batch),
+			 ztest_unit_test(test_syscall_batch_supervisor)
 			 );
 	ztest_run_test_suite(syscalls);
 }
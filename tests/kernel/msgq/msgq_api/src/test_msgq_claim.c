@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_msgq.h"
+
+K_THREAD_STACK_EXTERN(tstack);
+extern struct k_thread tdata;
+extern struct k_msgq msgq;
+static char __aligned(4) tbuffer[MSG_SIZE * MSGQ_LEN];
+static uint32_t data[MSGQ_LEN] = { MSG0, MSG1 };
+
+static void put_claim_entry(void *p1, void *p2, void *p3)
+{
+	struct k_msgq *q = p1;
+	void *slot;
+
+	zassert_equal(k_msgq_put_claim(q, &slot, TIMEOUT), 0, NULL);
+	*(uint32_t *)slot = MSG1;
+	zassert_equal(k_msgq_put_commit(q, false), 0, NULL);
+}
+
+static void get_claim_entry(void *p1, void *p2, void *p3)
+{
+	struct k_msgq *q = p1;
+	void *msg;
+
+	zassert_equal(k_msgq_get_claim(q, &msg, TIMEOUT), 0, NULL);
+	zassert_equal(*(uint32_t *)msg, MSG0, NULL);
+	zassert_equal(k_msgq_get_finish(q, false), 0, NULL);
+}
+
+/**
+ * @addtogroup kernel_message_queue_tests
+ * @{
+ */
+
+/**
+ * @brief Test building and consuming messages in place
+ * @see k_msgq_put_claim(), k_msgq_put_commit(), k_msgq_get_claim(),
+ * k_msgq_get_finish()
+ */
+void test_msgq_claim(void)
+{
+	void *slot, *msg;
+	uint32_t rx;
+
+	k_msgq_init(&msgq, tbuffer, MSG_SIZE, MSGQ_LEN);
+
+	/**TESTPOINT: a claimed slot is sent on commit only */
+	zassert_equal(k_msgq_put_claim(&msgq, &slot, K_NO_WAIT), 0, NULL);
+	zassert_equal(k_msgq_put_claim(&msgq, &msg, K_NO_WAIT), -EBUSY, NULL);
+	zassert_equal(k_msgq_put(&msgq, &data[1], K_NO_WAIT), -EBUSY, NULL);
+	*(uint32_t *)slot = MSG0;
+	zassert_equal(k_msgq_num_used_get(&msgq), 0, NULL);
+	zassert_equal(k_msgq_put_commit(&msgq, false), 0, NULL);
+	zassert_equal(k_msgq_put_commit(&msgq, false), -EINVAL, NULL);
+	zassert_equal(k_msgq_num_used_get(&msgq), 1, NULL);
+
+	/**TESTPOINT: a discarded slot is not sent */
+	zassert_equal(k_msgq_put_claim(&msgq, &slot, K_NO_WAIT), 0, NULL);
+	zassert_equal(k_msgq_put_commit(&msgq, true), 0, NULL);
+	zassert_equal(k_msgq_put(&msgq, &data[1], K_NO_WAIT), 0, NULL);
+	zassert_equal(k_msgq_put_claim(&msgq, &slot, K_NO_WAIT), -ENOMSG,
+		      NULL);
+
+	/**TESTPOINT: a claimed message stays queued until finished */
+	zassert_equal(k_msgq_get_claim(&msgq, &msg, K_NO_WAIT), 0, NULL);
+	zassert_equal(*(uint32_t *)msg, MSG0, NULL);
+	zassert_equal(k_msgq_get(&msgq, &rx, K_NO_WAIT), -EBUSY, NULL);
+	zassert_equal(k_msgq_get_finish(&msgq, true), 0, NULL);
+	zassert_equal(k_msgq_num_used_get(&msgq), 2, NULL);
+
+	zassert_equal(k_msgq_get_claim(&msgq, &msg, K_NO_WAIT), 0, NULL);
+	zassert_equal(*(uint32_t *)msg, MSG0, NULL);
+	zassert_equal(k_msgq_get_finish(&msgq, false), 0, NULL);
+	zassert_equal(k_msgq_get_finish(&msgq, false), -EINVAL, NULL);
+	zassert_equal(k_msgq_get(&msgq, &rx, K_NO_WAIT), 0, NULL);
+	zassert_equal(rx, MSG1, NULL);
+	zassert_equal(k_msgq_get_claim(&msgq, &msg, K_NO_WAIT), -ENOMSG,
+		      NULL);
+}
+
+/**
+ * @brief Test waiting for a claim
+ * @see k_msgq_put_claim(), k_msgq_get_claim()
+ */
+void test_msgq_claim_pend(void)
+{
+	void *msg;
+	uint32_t rx;
+
+	k_msgq_init(&msgq, tbuffer, MSG_SIZE, MSGQ_LEN);
+
+	for (int i = 0; i < MSGQ_LEN; i++) {
+		zassert_equal(k_msgq_put(&msgq, &data[0], K_NO_WAIT), 0, NULL);
+	}
+
+	/**TESTPOINT: a waiting put claim is given the slot a get frees */
+	k_thread_create(&tdata, tstack, STACK_SIZE, put_claim_entry, &msgq,
+			NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+	zassert_equal(k_msgq_put(&msgq, &data[1], K_NO_WAIT), -EBUSY, NULL);
+	zassert_equal(k_msgq_get(&msgq, &rx, K_NO_WAIT), 0, NULL);
+	k_thread_join(&tdata, K_FOREVER);
+
+	for (int i = 0; i < MSGQ_LEN; i++) {
+		zassert_equal(k_msgq_get(&msgq, &rx, K_NO_WAIT), 0, NULL);
+	}
+	zassert_equal(rx, MSG1, NULL);
+
+	/**TESTPOINT: a waiting get claim is given the next message */
+	k_thread_create(&tdata, tstack, STACK_SIZE, get_claim_entry, &msgq,
+			NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+	zassert_equal(k_msgq_put(&msgq, &data[0], K_NO_WAIT), 0, NULL);
+	k_thread_join(&tdata, K_FOREVER);
+	zassert_equal(k_msgq_num_used_get(&msgq), 0, NULL);
+
+	/**TESTPOINT: a claim times out like a put */
+	zassert_equal(k_msgq_get_claim(&msgq, &msg, TIMEOUT), -EAGAIN, NULL);
+	zassert_equal(k_msgq_put(&msgq, &data[0], K_NO_WAIT), 0, NULL);
+	zassert_equal(k_msgq_get_claim(&msgq, &msg, TIMEOUT), 0, NULL);
+	zassert_equal(*(uint32_t *)msg, MSG0, NULL);
+	zassert_equal(k_msgq_get_finish(&msgq, false), 0, NULL);
+}
+
+/**
+ * @}
+ */
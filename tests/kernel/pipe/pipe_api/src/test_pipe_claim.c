@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @brief Tests for the Pipe claim / commit API
+ * @ingroup kernel_pipe_tests
+ * @{
+ */
+
+#include <ztest.h>
+#include <string.h>
+
+#define STACK_SIZE	(1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define CLAIM_PIPE_LEN	8
+#define TIMEOUT_MS	100
+
+static unsigned char __aligned(4) claim_buffer[CLAIM_PIPE_LEN];
+static struct k_pipe claim_pipe;
+K_THREAD_STACK_EXTERN(tstack);
+extern struct k_thread tdata;
+
+static void writer_entry(void *p1, void *p2, void *p3)
+{
+	size_t written;
+
+	zassert_equal(k_pipe_put(&claim_pipe, "ijkl", 4, &written, 4,
+				 K_MSEC(TIMEOUT_MS)), 0, NULL);
+}
+
+static void put_claim_entry(void *p1, void *p2, void *p3)
+{
+	size_t size = CLAIM_PIPE_LEN;
+	void *space;
+
+	zassert_equal(k_pipe_put_claim(&claim_pipe, &space, &size,
+				       K_MSEC(TIMEOUT_MS)), 0, NULL);
+	zassert_true(size > 0, NULL);
+	memset(space, 'z', size);
+	zassert_equal(k_pipe_put_commit(&claim_pipe, 1), 0, NULL);
+}
+
+/**
+ * @brief Test writing and reading data in place
+ * @see k_pipe_put_claim(), k_pipe_put_commit(), k_pipe_get_claim(),
+ * k_pipe_get_finish()
+ */
+void test_pipe_claim(void)
+{
+	unsigned char rx[CLAIM_PIPE_LEN];
+	size_t size, xferred;
+	void *space, *other;
+
+	k_pipe_init(&claim_pipe, claim_buffer, sizeof(claim_buffer));
+
+	/**TESTPOINT: claimed space becomes data on commit only */
+	size = 6;
+	zassert_equal(k_pipe_put_claim(&claim_pipe, &space, &size, K_NO_WAIT),
+		      0, NULL);
+	zassert_equal(size, 6, NULL);
+	zassert_equal(k_pipe_put_claim(&claim_pipe, &other, &size, K_NO_WAIT),
+		      -EBUSY, NULL);
+	zassert_equal(k_pipe_put(&claim_pipe, "x", 1, &xferred, 1, K_NO_WAIT),
+		      -EBUSY, NULL);
+	memcpy(space, "abcdef", 6);
+	zassert_equal(k_pipe_read_avail(&claim_pipe), 0, NULL);
+	zassert_equal(k_pipe_put_commit(&claim_pipe, 7), -EINVAL, NULL);
+	zassert_equal(k_pipe_put_commit(&claim_pipe, 5), 0, NULL);
+	zassert_equal(k_pipe_put_commit(&claim_pipe, 0), -EINVAL, NULL);
+	zassert_equal(k_pipe_read_avail(&claim_pipe), 5, NULL);
+
+	/**TESTPOINT: claims stop at the end of the buffer */
+	size = CLAIM_PIPE_LEN;
+	zassert_equal(k_pipe_put_claim(&claim_pipe, &space, &size, K_NO_WAIT),
+		      0, NULL);
+	zassert_equal(size, CLAIM_PIPE_LEN - 5, NULL);
+	zassert_equal(k_pipe_put_commit(&claim_pipe, 0), 0, NULL);
+
+	/**TESTPOINT: claimed data stays in the pipe until finished */
+	size = 3;
+	zassert_equal(k_pipe_get_claim(&claim_pipe, &space, &size, K_NO_WAIT),
+		      0, NULL);
+	zassert_equal(size, 3, NULL);
+	zassert_mem_equal(space, "abc", 3, NULL);
+	zassert_equal(k_pipe_get(&claim_pipe, rx, 1, &xferred, 1, K_NO_WAIT),
+		      -EBUSY, NULL);
+	zassert_equal(k_pipe_get_finish(&claim_pipe, 2), 0, NULL);
+	zassert_equal(k_pipe_get_finish(&claim_pipe, 0), -EINVAL, NULL);
+
+	zassert_equal(k_pipe_get(&claim_pipe, rx, sizeof(rx), &xferred, 0,
+				 K_NO_WAIT), 0, NULL);
+	zassert_equal(xferred, 3, NULL);
+	zassert_mem_equal(rx, "cde", 3, NULL);
+
+	size = 1;
+	zassert_equal(k_pipe_get_claim(&claim_pipe, &space, &size, K_NO_WAIT),
+		      -EIO, NULL);
+	zassert_equal(k_pipe_get_claim(&claim_pipe, &space, &size,
+				       K_MSEC(TIMEOUT_MS)), -EAGAIN, NULL);
+}
+
+/**
+ * @brief Test waiting for a claim and waking up waiters on commit
+ * @see k_pipe_put_claim(), k_pipe_get_finish()
+ */
+void test_pipe_claim_pend(void)
+{
+	unsigned char rx[CLAIM_PIPE_LEN];
+	size_t size, xferred;
+	void *space;
+
+	k_pipe_init(&claim_pipe, claim_buffer, sizeof(claim_buffer));
+
+	zassert_equal(k_pipe_put(&claim_pipe, "abcdefgh", CLAIM_PIPE_LEN,
+				 &xferred, CLAIM_PIPE_LEN, K_NO_WAIT), 0, NULL);
+
+	/**TESTPOINT: a writer waiting on a full pipe is served on finish */
+	k_thread_create(&tdata, tstack, STACK_SIZE, writer_entry, NULL, NULL,
+			NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+
+	size = CLAIM_PIPE_LEN;
+	zassert_equal(k_pipe_get_claim(&claim_pipe, &space, &size, K_NO_WAIT),
+		      0, NULL);
+	zassert_equal(size, CLAIM_PIPE_LEN, NULL);
+	zassert_equal(k_pipe_get_finish(&claim_pipe, 4), 0, NULL);
+	k_thread_join(&tdata, K_FOREVER);
+
+	zassert_equal(k_pipe_get(&claim_pipe, rx, sizeof(rx), &xferred,
+				 sizeof(rx), K_NO_WAIT), 0, NULL);
+	zassert_mem_equal(rx, "efghijkl", sizeof(rx), NULL);
+
+	/**TESTPOINT: a waiting put claim retries once there is space */
+	zassert_equal(k_pipe_put(&claim_pipe, "abcdefgh", CLAIM_PIPE_LEN,
+				 &xferred, CLAIM_PIPE_LEN, K_NO_WAIT), 0, NULL);
+	k_thread_create(&tdata, tstack, STACK_SIZE, put_claim_entry, NULL,
+			NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+	zassert_equal(k_pipe_get(&claim_pipe, rx, 2, &xferred, 2, K_NO_WAIT),
+		      0, NULL);
+	k_thread_join(&tdata, K_FOREVER);
+
+	zassert_equal(k_pipe_get(&claim_pipe, rx, sizeof(rx), &xferred, 0,
+				 K_NO_WAIT), 0, NULL);
+	zassert_equal(xferred, 7, NULL);
+	zassert_mem_equal(rx, "cdefghz", 7, NULL);
+
+	/**TESTPOINT: a reader waiting on an empty pipe is served on commit */
+	k_thread_create(&tdata, tstack, STACK_SIZE, put_claim_entry, NULL,
+			NULL, NULL, K_PRIO_PREEMPT(0), 0, K_MSEC(TIMEOUT_MS >> 1));
+	zassert_equal(k_pipe_get(&claim_pipe, rx, 1, &xferred, 1,
+				 K_MSEC(TIMEOUT_MS)), 0, NULL);
+	zassert_equal(rx[0], 'z', NULL);
+	k_thread_join(&tdata, K_FOREVER);
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @brief Tests for the RCU read-mostly synchronization API
+ *
+ * - API coverage
+ *   -# k_rcu_read_lock k_rcu_read_unlock
+ *   -# k_rcu_synchronize
+ *   -# k_rcu_assign_pointer k_rcu_dereference
+ *
+ * @defgroup kernel_rcu_tests RCU
+ * @ingroup all_tests
+ * @{
+ * @}
+ */
+
+#include <ztest.h>
+#include <zephyr/irq_offload.h>
+
+#define STACK_SIZE	(1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define N_UPDATES	200
+#define POISON		0xdeadbeef
+
+K_THREAD_STACK_DEFINE(reader_stack, STACK_SIZE);
+static struct k_thread reader_thread;
+
+struct config {
+	uint32_t a;
+	uint32_t b;
+};
+
+static struct config copies[2];
+static struct config *current_config;
+static volatile bool done;
+static volatile bool high_ran;
+
+static void check_config(void)
+{
+	struct config *c;
+
+	k_rcu_read_lock();
+	c = k_rcu_dereference(current_config);
+	zassert_not_equal(c->a, POISON, "reclaimed copy in use");
+	zassert_equal(c->a, c->b, "torn copy in use");
+	k_rcu_read_unlock();
+}
+
+static void reader_entry(void *p1, void *p2, void *p3)
+{
+	while (!done) {
+		check_config();
+		k_yield();
+	}
+}
+
+static void isr_reader(const void *arg)
+{
+	check_config();
+}
+
+/**
+ * @brief Test replacing data while readers use it
+ * @see k_rcu_assign_pointer(), k_rcu_dereference(), k_rcu_synchronize()
+ */
+void test_rcu_update(void)
+{
+	struct config *old, *new;
+
+	copies[0].a = copies[0].b = 0U;
+	current_config = &copies[0];
+	done = false;
+
+	k_thread_create(&reader_thread, reader_stack, STACK_SIZE,
+			reader_entry, NULL, NULL, NULL,
+			k_thread_priority_get(k_current_get()), 0, K_NO_WAIT);
+
+	/**TESTPOINT: a copy is never reclaimed while a reader uses it */
+	for (uint32_t i = 1U; i <= N_UPDATES; i++) {
+		old = current_config;
+		new = (old == &copies[0]) ? &copies[1] : &copies[0];
+		new->a = i;
+		new->b = i;
+
+		k_rcu_assign_pointer(current_config, new);
+		k_rcu_synchronize();
+		old->a = POISON;
+
+		irq_offload(isr_reader, NULL);
+		k_yield();
+	}
+
+	done = true;
+	k_thread_join(&reader_thread, K_FOREVER);
+}
+
+static void high_entry(void *p1, void *p2, void *p3)
+{
+	high_ran = true;
+}
+
+/**
+ * @brief Test that readers are not preempted
+ * @see k_rcu_read_lock(), k_rcu_read_unlock()
+ */
+void test_rcu_read_nesting(void)
+{
+	high_ran = false;
+	k_thread_priority_set(k_current_get(), K_PRIO_PREEMPT(10));
+
+	/**TESTPOINT: nested critical sections end with the outermost one */
+	k_rcu_read_lock();
+	k_rcu_read_lock();
+	k_thread_create(&reader_thread, reader_stack, STACK_SIZE, high_entry,
+			NULL, NULL, NULL, K_PRIO_PREEMPT(5), 0,
+			K_NO_WAIT);
+	zassert_false(high_ran, NULL);
+	k_rcu_read_unlock();
+	zassert_false(high_ran, NULL);
+	k_rcu_read_unlock();
+	zassert_true(high_ran, NULL);
+	k_thread_join(&reader_thread, K_FOREVER);
+
+	k_rcu_synchronize();
+}
+
+/*test case main entry*/
+void test_main(void)
+{
+	ztest_test_suite(rcu,
+			 ztest_unit_test(test_rcu_update),
+			 ztest_1cpu_unit_test(test_rcu_read_nesting));
+	ztest_run_test_suite(rcu);
+}
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @brief Tests for the reader-writer lock kernel object
+ *
+ * - API coverage
+ *   -# k_rwlock_init K_RWLOCK_DEFINE
+ *   -# k_rwlock_rdlock k_rwlock_rdunlock
+ *   -# k_rwlock_wrlock k_rwlock_wrunlock
+ *
+ * @defgroup kernel_rwlock_tests Reader-writer lock
+ * @ingroup all_tests
+ * @{
+ * @}
+ */
+
+#include <ztest.h>
+
+#define STACK_SIZE	(1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define PRIO_MAIN	K_PRIO_PREEMPT(10)
+#define PRIO_HIGH	K_PRIO_PREEMPT(5)
+#define TIMEOUT_MS	100
+
+K_THREAD_STACK_DEFINE(stack_1, STACK_SIZE);
+K_THREAD_STACK_DEFINE(stack_2, STACK_SIZE);
+static struct k_thread thread_1;
+static struct k_thread thread_2;
+
+K_RWLOCK_DEFINE(rwlock);
+
+static char order[4];
+static int order_len;
+
+static void record(char c)
+{
+	order[order_len++] = c;
+}
+
+static void reader_entry(void *p1, void *p2, void *p3)
+{
+	k_timeout_t timeout = K_MSEC(POINTER_TO_INT(p1));
+	int expected = POINTER_TO_INT(p2);
+
+	zassert_equal(k_rwlock_rdlock(&rwlock, timeout), expected, NULL);
+	if (expected == 0) {
+		record('R');
+		zassert_equal(k_rwlock_rdunlock(&rwlock), 0, NULL);
+	}
+}
+
+static void writer_entry(void *p1, void *p2, void *p3)
+{
+	k_timeout_t timeout = K_MSEC(POINTER_TO_INT(p1));
+	int expected = POINTER_TO_INT(p2);
+
+	zassert_equal(k_rwlock_wrlock(&rwlock, timeout), expected, NULL);
+	if (expected == 0) {
+		record('W');
+		zassert_equal(k_rwlock_wrunlock(&rwlock), 0, NULL);
+	}
+}
+
+static void wrunlock_entry(void *p1, void *p2, void *p3)
+{
+	zassert_equal(k_rwlock_wrunlock(&rwlock), -EPERM, NULL);
+}
+
+static void spawn(struct k_thread *thread, k_thread_stack_t *stack,
+		  k_thread_entry_t entry, int timeout_ms, int expected)
+{
+	k_thread_create(thread, stack, STACK_SIZE, entry,
+			INT_TO_POINTER(timeout_ms), INT_TO_POINTER(expected),
+			NULL, PRIO_HIGH, 0, K_NO_WAIT);
+}
+
+static void setup(void)
+{
+	k_thread_priority_set(k_current_get(), PRIO_MAIN);
+	zassert_equal(k_rwlock_init(&rwlock), 0, NULL);
+	order_len = 0;
+}
+
+/**
+ * @brief Test that readers share the lock and writers do not
+ * @see k_rwlock_rdlock(), k_rwlock_wrlock()
+ */
+void test_rwlock_share(void)
+{
+	setup();
+
+	/**TESTPOINT: any number of readers hold the lock */
+	zassert_equal(k_rwlock_rdlock(&rwlock, K_NO_WAIT), 0, NULL);
+	spawn(&thread_1, stack_1, reader_entry, 0, 0);
+	k_thread_join(&thread_1, K_FOREVER);
+	zassert_equal(k_rwlock_rdlock(&rwlock, K_NO_WAIT), 0, NULL);
+
+	/**TESTPOINT: readers exclude writers */
+	spawn(&thread_1, stack_1, writer_entry, 0, -EBUSY);
+	k_thread_join(&thread_1, K_FOREVER);
+	zassert_equal(k_rwlock_wrlock(&rwlock, K_NO_WAIT), -EBUSY, NULL);
+
+	zassert_equal(k_rwlock_rdunlock(&rwlock), 0, NULL);
+	zassert_equal(k_rwlock_rdunlock(&rwlock), 0, NULL);
+	zassert_equal(k_rwlock_rdunlock(&rwlock), -EINVAL, NULL);
+
+	/**TESTPOINT: a writer excludes readers and writers */
+	zassert_equal(k_rwlock_wrlock(&rwlock, K_NO_WAIT), 0, NULL);
+	zassert_equal(k_rwlock_wrlock(&rwlock, K_NO_WAIT), -EDEADLK, NULL);
+	zassert_equal(k_rwlock_rdlock(&rwlock, K_NO_WAIT), -EBUSY, NULL);
+	spawn(&thread_1, stack_1, reader_entry, 0, -EBUSY);
+	k_thread_join(&thread_1, K_FOREVER);
+	spawn(&thread_1, stack_1, writer_entry, 0, -EBUSY);
+	k_thread_join(&thread_1, K_FOREVER);
+	spawn(&thread_1, stack_1, wrunlock_entry, 0, 0);
+	k_thread_join(&thread_1, K_FOREVER);
+
+	zassert_equal(k_rwlock_wrunlock(&rwlock), 0, NULL);
+	zassert_equal(k_rwlock_wrunlock(&rwlock), -EINVAL, NULL);
+	zassert_equal(order_len, 1, NULL);
+}
+
+/**
+ * @brief Test that waiting writers are served before new readers
+ * @see k_rwlock_rdlock(), k_rwlock_wrlock(), k_rwlock_rdunlock(),
+ * k_rwlock_wrunlock()
+ */
+void test_rwlock_writer_preference(void)
+{
+	setup();
+
+	zassert_equal(k_rwlock_rdlock(&rwlock, K_NO_WAIT), 0, NULL);
+
+	/**TESTPOINT: new readers wait behind a waiting writer */
+	spawn(&thread_1, stack_1, writer_entry, TIMEOUT_MS * 10, 0);
+	zassert_equal(k_rwlock_rdlock(&rwlock, K_NO_WAIT), -EBUSY, NULL);
+	spawn(&thread_2, stack_2, reader_entry, TIMEOUT_MS * 10, 0);
+	zassert_equal(order_len, 0, NULL);
+
+	/**TESTPOINT: the last reader hands the lock to the writer, which
+	 * hands it to the waiting readers
+	 */
+	zassert_equal(k_rwlock_rdunlock(&rwlock), 0, NULL);
+	k_thread_join(&thread_1, K_FOREVER);
+	k_thread_join(&thread_2, K_FOREVER);
+	zassert_equal(order_len, 2, NULL);
+	zassert_mem_equal(order, "WR", 2, NULL);
+}
+
+/**
+ * @brief Test timing out while waiting for the lock
+ * @see k_rwlock_rdlock(), k_rwlock_wrlock()
+ */
+void test_rwlock_timeout(void)
+{
+	setup();
+
+	/**TESTPOINT: readers waiting behind a writer that times out get the
+	 * lock
+	 */
+	zassert_equal(k_rwlock_rdlock(&rwlock, K_NO_WAIT), 0, NULL);
+	spawn(&thread_1, stack_1, writer_entry, TIMEOUT_MS, -EAGAIN);
+	spawn(&thread_2, stack_2, reader_entry, TIMEOUT_MS * 10, 0);
+	zassert_equal(k_thread_join(&thread_2, K_MSEC(TIMEOUT_MS * 5)), 0,
+		      NULL);
+	k_thread_join(&thread_1, K_FOREVER);
+	zassert_equal(k_rwlock_rdunlock(&rwlock), 0, NULL);
+
+	/**TESTPOINT: a reader times out while a writer holds the lock */
+	zassert_equal(k_rwlock_wrlock(&rwlock, K_NO_WAIT), 0, NULL);
+	spawn(&thread_1, stack_1, reader_entry, TIMEOUT_MS, -EAGAIN);
+	k_thread_join(&thread_1, K_FOREVER);
+	zassert_equal(k_rwlock_wrunlock(&rwlock), 0, NULL);
+	zassert_mem_equal(order, "R", 1, NULL);
+}
+
+/**
+ * @brief Test that the writer inherits the priority of the waiters
+ * @see k_rwlock_rdlock(), k_rwlock_wrlock(), k_rwlock_wrunlock()
+ */
+void test_rwlock_priority_inheritance(void)
+{
+	setup();
+
+	zassert_equal(k_rwlock_wrlock(&rwlock, K_NO_WAIT), 0, NULL);
+
+	/**TESTPOINT: a waiting reader raises the writer's priority until it
+	 * unlocks
+	 */
+	spawn(&thread_1, stack_1, reader_entry, TIMEOUT_MS * 10, 0);
+	zassert_equal(k_thread_priority_get(k_current_get()), PRIO_HIGH, NULL);
+	zassert_equal(k_rwlock_wrunlock(&rwlock), 0, NULL);
+	zassert_equal(k_thread_priority_get(k_current_get()), PRIO_MAIN, NULL);
+	k_thread_join(&thread_1, K_FOREVER);
+
+	/**TESTPOINT: the priority is restored when the waiter times out */
+	zassert_equal(k_rwlock_wrlock(&rwlock, K_NO_WAIT), 0, NULL);
+	spawn(&thread_1, stack_1, writer_entry, TIMEOUT_MS, -EAGAIN);
+	zassert_equal(k_thread_priority_get(k_current_get()), PRIO_HIGH, NULL);
+	k_thread_join(&thread_1, K_FOREVER);
+	zassert_equal(k_thread_priority_get(k_current_get()), PRIO_MAIN, NULL);
+	zassert_equal(k_rwlock_wrunlock(&rwlock), 0, NULL);
+	zassert_mem_equal(order, "R", 1, NULL);
+}
+
+/*test case main entry*/
+void test_main(void)
+{
+	ztest_test_suite(rwlock,
+			 ztest_1cpu_unit_test(test_rwlock_share),
+			 ztest_1cpu_unit_test(test_rwlock_writer_preference),
+			 ztest_1cpu_unit_test(test_rwlock_timeout),
+			 ztest_1cpu_unit_test(test_rwlock_priority_inheritance));
+	ztest_run_test_suite(rwlock);
+}
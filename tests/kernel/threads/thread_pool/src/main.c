@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @brief Tests for thread pools
+ *
+ * - API coverage
+ *   -# K_THREAD_POOL_DEFINE
+ *   -# k_thread_pool_spawn
+ *   -# k_thread_pool_alloc k_thread_pool_stack_get k_thread_pool_free
+ *
+ * @defgroup kernel_thread_pool_tests Thread pools
+ * @ingroup all_tests
+ * @{
+ * @}
+ */
+
+#include <ztest.h>
+
+#define POOL_SIZE	2
+#define STACK_SIZE	(1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define PRIO		K_PRIO_PREEMPT(5)
+
+K_THREAD_POOL_DEFINE(pool, POOL_SIZE, STACK_SIZE);
+K_SEM_DEFINE(go, 0, POOL_SIZE);
+
+static void wait_entry(void *p1, void *p2, void *p3)
+{
+	k_sem_take(&go, K_FOREVER);
+}
+
+static void stack_entry(void *p1, void *p2, void *p3)
+{
+	const struct _thread_stack_info *info = &k_current_get()->stack_info;
+	uintptr_t start = (uintptr_t)p1;
+	size_t size = POINTER_TO_UINT(p2);
+
+	zassert_true((info->start >= start) && (info->start < start + size),
+		     "not running on the pool stack");
+}
+
+static void free_self_entry(void *p1, void *p2, void *p3)
+{
+	k_thread_pool_free(&pool, k_current_get());
+}
+
+/**
+ * @brief Test spawning threads until the pool is empty
+ * @see k_thread_pool_spawn()
+ */
+void test_thread_pool_spawn(void)
+{
+	k_tid_t tids[POOL_SIZE];
+
+	/**TESTPOINT: every thread of the pool can be spawned, and no more */
+	for (int i = 0; i < POOL_SIZE; i++) {
+		tids[i] = k_thread_pool_spawn(&pool, wait_entry, NULL, NULL,
+					      NULL, PRIO, 0, K_NO_WAIT);
+		zassert_not_null(tids[i], NULL);
+	}
+	zassert_not_equal(tids[0], tids[1], NULL);
+	zassert_is_null(k_thread_pool_spawn(&pool, wait_entry, NULL, NULL,
+					    NULL, PRIO, 0, K_NO_WAIT), NULL);
+
+	/**TESTPOINT: threads go back to the pool when they exit, and the
+	 * most recently freed one is used first
+	 */
+	k_sem_give(&go);
+	k_sem_give(&go);
+	for (int i = 0; i < POOL_SIZE; i++) {
+		zassert_equal(k_thread_join(tids[i], K_FOREVER), 0, NULL);
+	}
+
+	zassert_equal(k_thread_pool_spawn(&pool, wait_entry, NULL, NULL, NULL,
+					  PRIO, 0, K_NO_WAIT), tids[1], NULL);
+	k_sem_give(&go);
+	zassert_equal(k_thread_join(tids[1], K_FOREVER), 0, NULL);
+}
+
+/**
+ * @brief Test the lifetime of allocated threads
+ * @see k_thread_pool_alloc(), k_thread_pool_stack_get(),
+ * k_thread_pool_free()
+ */
+void test_thread_pool_alloc(void)
+{
+	struct k_thread *threads[POOL_SIZE];
+	k_thread_stack_t *stack;
+	size_t size;
+
+	for (int i = 0; i < POOL_SIZE; i++) {
+		threads[i] = k_thread_pool_alloc(&pool);
+		zassert_not_null(threads[i], NULL);
+	}
+	zassert_is_null(k_thread_pool_alloc(&pool), NULL);
+
+	/**TESTPOINT: an allocated thread runs on its pool stack */
+	stack = k_thread_pool_stack_get(&pool, threads[0], &size);
+	zassert_true(size >= STACK_SIZE, NULL);
+	k_thread_create(threads[0], stack, size, stack_entry, stack,
+			UINT_TO_POINTER(K_THREAD_STACK_LEN(STACK_SIZE)), NULL,
+			PRIO, 0, K_NO_WAIT);
+	zassert_equal(k_thread_join(threads[0], K_FOREVER), 0, NULL);
+
+	/**TESTPOINT: an exited thread stays allocated until freed */
+	zassert_is_null(k_thread_pool_alloc(&pool), NULL);
+	k_thread_pool_free(&pool, threads[0]);
+	zassert_equal(k_thread_pool_alloc(&pool), threads[0], NULL);
+
+	/**TESTPOINT: a thread freed while running goes back to the pool
+	 * when it exits
+	 */
+	stack = k_thread_pool_stack_get(&pool, threads[1], &size);
+	k_thread_create(threads[1], stack, size, free_self_entry, NULL, NULL,
+			NULL, PRIO, 0, K_FOREVER);
+	k_thread_pool_free(&pool, threads[0]);
+	zassert_equal(k_thread_pool_alloc(&pool), threads[0], NULL);
+	zassert_is_null(k_thread_pool_alloc(&pool), NULL);
+
+	k_thread_start(threads[1]);
+	zassert_equal(k_thread_join(threads[1], K_FOREVER), 0, NULL);
+	zassert_equal(k_thread_pool_alloc(&pool), threads[1], NULL);
+
+	k_thread_pool_free(&pool, threads[0]);
+	k_thread_pool_free(&pool, threads[1]);
+}
+
+/*test case main entry*/
+void test_main(void)
+{
+	ztest_test_suite(thread_pool,
+			 ztest_1cpu_unit_test(test_thread_pool_spawn),
+			 ztest_1cpu_unit_test(test_thread_pool_alloc));
+	ztest_run_test_suite(thread_pool);
+}
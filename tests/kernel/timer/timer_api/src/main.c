@@ -811,6 +811,71 @@ void test_sleep_abs(void)
 		     start + sleep_ticks, end, late);
 }
 
+#ifdef CONFIG_TIMEOUT_SLACK
+#define SLACK_DURATION 20
+#define SLACK_LATER 30
+
+static struct k_timer slack_timer;
+static struct k_timer slack_later_timer;
+static ZTEST_BMEM uint32_t slack_expiry;
+static ZTEST_BMEM uint32_t slack_later_expiry;
+
+/* Timeouts expired by the same announcement all see the uptime of their
+ * own expiry, so the cycle count tells when they actually expired
+ */
+static void slack_expire(struct k_timer *timer)
+{
+	slack_expiry = k_cycle_get_32();
+}
+
+static void slack_later_expire(struct k_timer *timer)
+{
+	slack_later_expiry = k_cycle_get_32();
+}
+#endif
+
+void test_timer_slack(void)
+{
+#ifdef CONFIG_TIMEOUT_SLACK
+	uint32_t start;
+
+	if (!IS_ENABLED(CONFIG_TICKLESS_KERNEL)) {
+		/* Ticks are announced one by one anyway */
+		ztest_test_skip();
+	}
+
+	/** TESTPOINT: a timer expires together with a later one that is
+	 * due within its slack
+	 */
+	k_usleep(1); /* tick align */
+	start = k_cycle_get_32();
+
+	k_timer_slack_set(&slack_timer, K_MSEC(SLACK_LATER));
+	k_timer_start(&slack_timer, K_MSEC(SLACK_DURATION), K_NO_WAIT);
+	k_timer_start(&slack_later_timer, K_MSEC(SLACK_LATER), K_NO_WAIT);
+
+	k_timer_status_sync(&slack_later_timer);
+
+	zassert_true(slack_expiry - start >= k_ms_to_cyc_floor32(SLACK_LATER),
+		     "timer not deferred");
+	zassert_true(slack_later_expiry - slack_expiry < k_ticks_to_cyc_ceil32(1),
+		     "expiries not coalesced");
+
+	/** TESTPOINT: a timer with no slack expires on time */
+	k_timer_slack_set(&slack_timer, K_NO_WAIT);
+	k_timer_start(&slack_timer, K_MSEC(SLACK_DURATION), K_NO_WAIT);
+	k_timer_start(&slack_later_timer, K_MSEC(SLACK_LATER), K_NO_WAIT);
+
+	k_timer_status_sync(&slack_later_timer);
+
+	zassert_true(slack_later_expiry - slack_expiry >=
+		     k_ms_to_cyc_floor32(SLACK_LATER - SLACK_DURATION - 1),
+		     "timer expired late");
+#else
+	ztest_test_skip();
+#endif
+}
+
 static void timer_init(struct k_timer *timer, k_timer_expiry_t expiry_fn,
 		       k_timer_stop_t stop_fn)
 {
@@ -832,10 +897,18 @@ void test_main(void)
 	timer_init(&status_anytime_timer, NULL, NULL);
 	timer_init(&status_sync_timer, duration_expire, duration_stop);
 	timer_init(&remain_timer, duration_expire, duration_stop);
+#ifdef CONFIG_TIMEOUT_SLACK
+	timer_init(&slack_timer, slack_expire, NULL);
+	timer_init(&slack_later_timer, slack_later_expire, NULL);
+#endif
 
 	if (IS_ENABLED(CONFIG_MULTITHREADING)) {
 		k_thread_access_grant(k_current_get(), &ktimer, &timer0, &timer1,
 			      &timer2, &timer3, &timer4);
+#ifdef CONFIG_TIMEOUT_SLACK
+		k_thread_access_grant(k_current_get(), &slack_timer,
+				      &slack_later_timer);
+#endif
 	}
 
 	ztest_test_suite(timer_api,
@@ -853,6 +926,7 @@ void test_main(void)
 			 ztest_user_unit_test(test_timer_user_data),
 			 ztest_user_unit_test(test_timer_remaining),
 			 ztest_user_unit_test(test_timeout_abs),
-			 ztest_user_unit_test(test_sleep_abs));
+			 ztest_user_unit_test(test_sleep_abs),
+			 ztest_user_unit_test(test_timer_slack));
 	ztest_run_test_suite(timer_api);
 }
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <ztest.h>
+#include <ztress.h>
+#include <zephyr/sys/ring_buffer.h>
+
+/**
+ * @defgroup lib_ringbuffer_tests Ringbuffer
+ * @ingroup all_tests
+ * @{
+ * @}
+ */
+
+#define RINGBUFFER 32
+
+RING_BUF_SPSC_DECLARE(spsc_buf, RINGBUFFER);
+
+/* Index values just below the 32-bit roll-over */
+static const uint32_t offsets[] = { 0, UINT32_MAX - RINGBUFFER / 2 };
+
+void test_ringbuffer_spsc_declare(void)
+{
+	zassert_equal(spsc_buf.size, RINGBUFFER, NULL);
+	zassert_true(IS_PTR_ALIGNED(spsc_buf.buffer, uint32_t), NULL);
+	zassert_true(((uintptr_t)&spsc_buf.get -
+		      (uintptr_t)&spsc_buf.put) >= RING_BUF_SPSC_ALIGN, NULL);
+	zassert_true(ring_buf_spsc_is_empty(&spsc_buf), NULL);
+	zassert_equal(ring_buf_spsc_space_get(&spsc_buf), RINGBUFFER, NULL);
+}
+
+void test_ringbuffer_spsc_put_get(void)
+{
+	uint8_t indata[RINGBUFFER + 8];
+	uint8_t outdata[RINGBUFFER + 8];
+
+	for (int i = 0; i < sizeof(indata); i++) {
+		indata[i] = i;
+	}
+
+	for (int o = 0; o < ARRAY_SIZE(offsets); o++) {
+		ring_buf_spsc_internal_reset(&spsc_buf, offsets[o]);
+
+		/* Fill up, only the capacity is accepted */
+		zassert_equal(ring_buf_spsc_put(&spsc_buf, indata,
+						sizeof(indata)),
+			      RINGBUFFER, NULL);
+		zassert_equal(ring_buf_spsc_space_get(&spsc_buf), 0, NULL);
+		zassert_equal(ring_buf_spsc_put(&spsc_buf, indata, 1), 0,
+			      NULL);
+
+		zassert_equal(ring_buf_spsc_get(&spsc_buf, outdata, 5), 5,
+			      NULL);
+		zassert_mem_equal(outdata, indata, 5, NULL);
+
+		/* Wrapping write and read */
+		zassert_equal(ring_buf_spsc_put(&spsc_buf, &indata[RINGBUFFER],
+						5), 5, NULL);
+		zassert_equal(ring_buf_spsc_size_get(&spsc_buf), RINGBUFFER,
+			      NULL);
+		zassert_equal(ring_buf_spsc_get(&spsc_buf, outdata,
+						sizeof(outdata)),
+			      RINGBUFFER, NULL);
+		zassert_mem_equal(outdata, &indata[5], RINGBUFFER, NULL);
+		zassert_true(ring_buf_spsc_is_empty(&spsc_buf), NULL);
+
+		/* Discarding get */
+		zassert_equal(ring_buf_spsc_put(&spsc_buf, indata, 7), 7, NULL);
+		zassert_equal(ring_buf_spsc_get(&spsc_buf, NULL, 7), 7, NULL);
+		zassert_true(ring_buf_spsc_is_empty(&spsc_buf), NULL);
+	}
+}
+
+void test_ringbuffer_spsc_claim_finish(void)
+{
+	uint8_t *data;
+	uint32_t len;
+
+	for (int o = 0; o < ARRAY_SIZE(offsets); o++) {
+		ring_buf_spsc_internal_reset(&spsc_buf, offsets[o]);
+
+		len = ring_buf_spsc_put_claim(&spsc_buf, &data, 20);
+		zassert_equal(len, 20, NULL);
+		memset(data, 0xaa, len);
+
+		/* Not published before finish */
+		zassert_true(ring_buf_spsc_is_empty(&spsc_buf), NULL);
+		zassert_equal(ring_buf_spsc_put_finish(&spsc_buf, 21), -EINVAL,
+			      NULL);
+		zassert_equal(ring_buf_spsc_put_finish(&spsc_buf, 16), 0, NULL);
+		zassert_equal(ring_buf_spsc_size_get(&spsc_buf), 16, NULL);
+
+		len = ring_buf_spsc_get_claim(&spsc_buf, &data, 32);
+		zassert_equal(len, 16, NULL);
+		zassert_equal(data[0], 0xaa, NULL);
+		zassert_equal(ring_buf_spsc_get_finish(&spsc_buf, 17), -EINVAL,
+			      NULL);
+		zassert_equal(ring_buf_spsc_get_finish(&spsc_buf, 16), 0, NULL);
+
+		/* Claim stops at the end of the buffer */
+		len = ring_buf_spsc_put_claim(&spsc_buf, &data, RINGBUFFER);
+		zassert_equal(len, RINGBUFFER - 16, NULL);
+		len = ring_buf_spsc_put_claim(&spsc_buf, &data, RINGBUFFER);
+		zassert_equal(len, 16, NULL);
+		zassert_equal(data, spsc_buf.buffer, NULL);
+		zassert_equal(ring_buf_spsc_put_finish(&spsc_buf, RINGBUFFER),
+			      0, NULL);
+		zassert_equal(ring_buf_spsc_space_get(&spsc_buf), 0, NULL);
+
+		len = ring_buf_spsc_get_claim(&spsc_buf, &data, RINGBUFFER);
+		zassert_equal(len, RINGBUFFER - 16, NULL);
+		zassert_equal(ring_buf_spsc_get_finish(&spsc_buf, len), 0,
+			      NULL);
+		len = ring_buf_spsc_get_claim(&spsc_buf, &data, RINGBUFFER);
+		zassert_equal(len, 16, NULL);
+		zassert_equal(ring_buf_spsc_get_finish(&spsc_buf, len), 0,
+			      NULL);
+		zassert_true(ring_buf_spsc_is_empty(&spsc_buf), NULL);
+	}
+}
+
+static bool produce_spsc(void *user_data, uint32_t iter_cnt, bool last,
+			 int prio)
+{
+	static uint8_t cnt;
+	uint8_t buf[7];
+	uint32_t len;
+
+	if (iter_cnt == 0) {
+		cnt = 0;
+	}
+
+	for (int i = 0; i < sizeof(buf); i++) {
+		buf[i] = cnt + i;
+	}
+
+	len = ring_buf_spsc_put(&spsc_buf, buf, sizeof(buf));
+	cnt += len;
+
+	return true;
+}
+
+static bool consume_spsc(void *user_data, uint32_t iter_cnt, bool last,
+			 int prio)
+{
+	static uint8_t cnt;
+	uint8_t *data;
+	uint32_t len;
+
+	if (iter_cnt == 0) {
+		cnt = 0;
+	}
+
+	len = ring_buf_spsc_get_claim(&spsc_buf, &data, 5);
+	for (uint32_t i = 0; i < len; i++) {
+		zassert_equal(data[i], cnt,
+			      "Got %02x, exp: %02x", data[i], cnt);
+		cnt++;
+	}
+
+	zassert_equal(ring_buf_spsc_get_finish(&spsc_buf, len), 0, NULL);
+
+	return true;
+}
+
+static void test_spsc_ztress(ztress_handler high_handler,
+			     ztress_handler low_handler)
+{
+	k_timeout_t timeout;
+
+	ring_buf_spsc_internal_reset(&spsc_buf, offsets[1]);
+
+	timeout = (CONFIG_SYS_CLOCK_TICKS_PER_SEC < 10000) ? K_MSEC(1000) : K_MSEC(10000);
+
+	ztress_set_timeout(timeout);
+	ZTRESS_EXECUTE(ZTRESS_THREAD(high_handler, NULL, 0, 0, Z_TIMEOUT_TICKS(20)),
+		       ZTRESS_THREAD(low_handler, NULL, 0, 2000, Z_TIMEOUT_TICKS(20)));
+}
+
+/* Lock-free API. Test is validating single producer, single consumer from
+ * different priorities.
+ */
+void test_ringbuffer_spsc_stress(void)
+{
+	PRINT("Producing interrupts consuming\n");
+	test_spsc_ztress(produce_spsc, consume_spsc);
+
+	PRINT("Consuming interrupts producing\n");
+	test_spsc_ztress(consume_spsc, produce_spsc);
+}
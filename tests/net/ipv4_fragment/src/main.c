@@ -0,0 +1,482 @@
+/* main.c - Application main entry point */
+
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_IPV4_LOG_LEVEL);
+
+#include <zephyr/types.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <errno.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/linker/sections.h>
+
+#include <ztest.h>
+
+#include <zephyr/net/dummy.h>
+#include <zephyr/net/buf.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_if.h>
+
+#define NET_LOG_ENABLED 1
+#include "net_private.h"
+
+#include "icmpv4.h"
+#include "ipv4.h"
+#include "udp_internal.h"
+
+#define MTU 576
+
+/* The UDP datagram is split into 4 fragments of at most 552 bytes */
+#define DATA_LEN 2000
+#define FRAG_LEN ((MTU - NET_IPV4H_LEN) & ~7)
+#define FRAG_COUNT ((NET_UDPH_LEN + DATA_LEN + FRAG_LEN - 1) / FRAG_LEN)
+
+#define SRC_PORT 4352
+#define DST_PORT 25348
+
+#define WAIT_TIME K_SECONDS(1)
+#define NO_DATA_WAIT_TIME K_MSEC(200)
+
+#define ALLOC_TIMEOUT K_MSEC(500)
+
+static struct in_addr my_addr = { { { 192, 0, 2, 1 } } };
+static struct in_addr peer_addr = { { { 192, 0, 2, 2 } } };
+
+static struct net_if *iface1;
+
+/* Copies of the packets sent by the interface */
+static struct net_pkt *sent[FRAG_COUNT];
+static int sent_count;
+static bool capture;
+static struct k_sem wait_sent;
+
+static struct k_sem wait_data;
+static size_t recv_len;
+static bool recv_data_ok;
+
+static int net_iface_dev_init(const struct device *dev)
+{
+	return 0;
+}
+
+static uint8_t mac_addr[] = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x01 };
+
+static void net_iface_init(struct net_if *iface)
+{
+	net_if_set_link_addr(iface, mac_addr, sizeof(mac_addr),
+			     NET_LINK_ETHERNET);
+}
+
+static int sender_iface(const struct device *dev, struct net_pkt *pkt)
+{
+	if (!pkt->buffer) {
+		NET_DBG("No data to send!");
+		return -ENODATA;
+	}
+
+	if (capture && sent_count < ARRAY_SIZE(sent)) {
+		sent[sent_count] = net_pkt_rx_clone(pkt, K_NO_WAIT);
+		if (sent[sent_count]) {
+			sent_count++;
+			k_sem_give(&wait_sent);
+		}
+	}
+
+	return 0;
+}
+
+static struct dummy_api net_iface_api = {
+	.iface_api.init = net_iface_init,
+	.send = sender_iface,
+};
+
+NET_DEVICE_INIT(net_ipv4_fragment_test, "iface1",
+		net_iface_dev_init, NULL, NULL, NULL,
+		CONFIG_KERNEL_INIT_PRIORITY_DEFAULT,
+		&net_iface_api, DUMMY_L2,
+		NET_L2_GET_CTX_TYPE(DUMMY_L2), MTU);
+
+static enum net_verdict udp_data_received(struct net_conn *conn,
+					  struct net_pkt *pkt,
+					  union net_ip_header *ip_hdr,
+					  union net_proto_header *proto_hdr,
+					  void *user_data)
+{
+	uint8_t data;
+	size_t i;
+
+	NET_DBG("Data %p received", pkt);
+
+	recv_len = net_pkt_get_len(pkt) - NET_IPV4UDPH_LEN;
+	recv_data_ok = recv_len == DATA_LEN;
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+	net_pkt_skip(pkt, NET_IPV4UDPH_LEN);
+
+	for (i = 0; recv_data_ok && i < recv_len; i++) {
+		if (net_pkt_read_u8(pkt, &data) || data != (uint8_t)i) {
+			recv_data_ok = false;
+		}
+	}
+
+	net_pkt_unref(pkt);
+
+	k_sem_give(&wait_data);
+
+	return NET_OK;
+}
+
+static void release_sent(void)
+{
+	int i;
+
+	for (i = 0; i < sent_count; i++) {
+		if (sent[i]) {
+			net_pkt_unref(sent[i]);
+			sent[i] = NULL;
+		}
+	}
+
+	sent_count = 0;
+}
+
+static void test_setup(void)
+{
+	struct sockaddr remote_addr = { 0 };
+	struct sockaddr local_addr = { 0 };
+	struct net_conn_handle *handle;
+	struct net_if_addr *ifaddr;
+	int ret;
+
+	k_sem_init(&wait_sent, 0, UINT_MAX);
+	k_sem_init(&wait_data, 0, UINT_MAX);
+
+	iface1 = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+	zassert_not_null(iface1, "Interface 1");
+
+	ifaddr = net_if_ipv4_addr_add(iface1, &my_addr, NET_ADDR_MANUAL, 0);
+	zassert_not_null(ifaddr, "Cannot add IPv4 address");
+
+	net_if_up(iface1);
+
+	/* The fragments which are sent are fed back into the stack after
+	 * their addresses are swapped.
+	 */
+	net_ipaddr_copy(&net_sin(&local_addr)->sin_addr, &my_addr);
+	local_addr.sa_family = AF_INET;
+
+	net_ipaddr_copy(&net_sin(&remote_addr)->sin_addr, &peer_addr);
+	remote_addr.sa_family = AF_INET;
+
+	ret = net_udp_register(AF_INET, &remote_addr, &local_addr,
+			       SRC_PORT, DST_PORT, NULL, udp_data_received,
+			       NULL, &handle);
+	zassert_equal(ret, 0, "Cannot register UDP handler");
+}
+
+static struct net_pkt *create_datagram(uint8_t flags)
+{
+	struct net_pkt *pkt;
+	int ret;
+	int i;
+
+	pkt = net_pkt_alloc_with_buffer(iface1, NET_UDPH_LEN + DATA_LEN,
+					AF_INET, IPPROTO_UDP, ALLOC_TIMEOUT);
+	zassert_not_null(pkt, "Cannot allocate packet");
+
+	ret = net_ipv4_create_full(pkt, &my_addr, &peer_addr, 0U, 0U, flags,
+				   0U, 0U);
+	zassert_equal(ret, 0, "Cannot create IPv4 header");
+
+	ret = net_udp_create(pkt, htons(SRC_PORT), htons(DST_PORT));
+	zassert_equal(ret, 0, "Cannot create UDP header");
+
+	for (i = 0; i < DATA_LEN; i++) {
+		ret = net_pkt_write_u8(pkt, (uint8_t)i);
+		zassert_equal(ret, 0, "Cannot append data");
+	}
+
+	net_pkt_cursor_init(pkt);
+
+	ret = net_ipv4_finalize(pkt, IPPROTO_UDP);
+	zassert_equal(ret, 0, "Cannot finalize packet");
+
+	return pkt;
+}
+
+/* Send a datagram, and keep a copy of its fragments with their addresses
+ * swapped, so that they can be received back.
+ */
+static void send_datagram(void)
+{
+	struct net_pkt *pkt;
+	int ret;
+	int i;
+
+	pkt = create_datagram(0U);
+
+	capture = true;
+
+	ret = net_send_data(pkt);
+	zassert_equal(ret, 0, "Cannot send packet (%d)", ret);
+
+	for (i = 0; i < FRAG_COUNT; i++) {
+		zassert_equal(k_sem_take(&wait_sent, WAIT_TIME), 0,
+			      "Fragment %d not sent", i);
+	}
+
+	capture = false;
+
+	zassert_equal(sent_count, FRAG_COUNT, "Invalid fragment count");
+
+	for (i = 0; i < sent_count; i++) {
+		struct net_ipv4_hdr *hdr = NET_IPV4_HDR(sent[i]);
+		uint8_t addr[sizeof(struct in_addr)];
+
+		memcpy(addr, hdr->src, sizeof(addr));
+		memcpy(hdr->src, hdr->dst, sizeof(addr));
+		memcpy(hdr->dst, addr, sizeof(addr));
+	}
+}
+
+static void test_send_ipv4_fragment(void)
+{
+	uint16_t expected_offset = 0U;
+	uint16_t id = 0U;
+	int i;
+
+	send_datagram();
+
+	for (i = 0; i < sent_count; i++) {
+		struct net_pkt *pkt = sent[i];
+		struct net_ipv4_hdr *hdr = NET_IPV4_HDR(pkt);
+		uint16_t flag = (hdr->offset[0] << 8) | hdr->offset[1];
+		size_t len = net_pkt_get_len(pkt);
+
+		zassert_true(len <= MTU, "Fragment %d exceeds the MTU", i);
+		zassert_equal(ntohs(hdr->len), len, "Invalid length %d", i);
+		zassert_equal(hdr->vhl, 0x45, "Invalid header %d", i);
+		zassert_equal(hdr->proto, IPPROTO_UDP, "Invalid protocol %d", i);
+
+		net_pkt_set_ip_hdr_len(pkt, NET_IPV4H_LEN);
+		net_pkt_set_ipv4_opts_len(pkt, 0);
+		zassert_equal(net_calc_chksum_ipv4(pkt), 0,
+			      "Invalid checksum %d", i);
+
+		if (i == 0) {
+			id = (hdr->id[0] << 8) | hdr->id[1];
+		} else {
+			zassert_equal((hdr->id[0] << 8) | hdr->id[1], id,
+				      "Invalid id %d", i);
+		}
+
+		zassert_equal((flag & NET_IPV4_FRAGH_OFFSET_MASK) * 8,
+			      expected_offset, "Invalid offset %d", i);
+
+		if (i < sent_count - 1) {
+			zassert_true(flag & NET_IPV4_MORE_FRAG_MASK,
+				     "MF not set %d", i);
+			zassert_equal((len - NET_IPV4H_LEN) % 8, 0,
+				      "Invalid fragment length %d", i);
+		} else {
+			zassert_false(flag & NET_IPV4_MORE_FRAG_MASK,
+				      "MF set in last fragment");
+		}
+
+		expected_offset += len - NET_IPV4H_LEN;
+	}
+
+	zassert_equal(expected_offset, NET_UDPH_LEN + DATA_LEN,
+		      "Invalid total length");
+}
+
+static void test_send_ipv4_fragment_df(void)
+{
+	struct net_pkt *pkt;
+	int ret;
+
+	pkt = create_datagram(NET_IPV4_DF);
+
+	capture = true;
+
+	ret = net_send_data(pkt);
+	zassert_true(ret < 0, "Packet with DF set was sent");
+
+	net_pkt_unref(pkt);
+
+	zassert_not_equal(k_sem_take(&wait_sent, NO_DATA_WAIT_TIME), 0,
+			  "Fragment sent");
+
+	capture = false;
+}
+
+static void test_recv_ipv4_fragment(void)
+{
+	int ret;
+	int i;
+
+	/* Feed the fragments sent by the previous test in reverse order */
+	for (i = sent_count - 1; i >= 0; i--) {
+		ret = net_recv_data(iface1, sent[i]);
+		zassert_equal(ret, 0, "Cannot receive fragment %d", i);
+
+		sent[i] = NULL;
+	}
+
+	sent_count = 0;
+
+	zassert_equal(k_sem_take(&wait_data, WAIT_TIME), 0,
+		      "Datagram not received");
+	zassert_equal(recv_len, DATA_LEN, "Invalid length %zd", recv_len);
+	zassert_true(recv_data_ok, "Invalid data");
+}
+
+static void test_recv_ipv4_fragment_duplicate(void)
+{
+	struct net_pkt *dup;
+	int ret;
+	int i;
+
+	send_datagram();
+
+	dup = net_pkt_rx_clone(sent[1], ALLOC_TIMEOUT);
+	zassert_not_null(dup, "Cannot clone fragment");
+
+	ret = net_recv_data(iface1, dup);
+	zassert_equal(ret, 0, "Cannot receive fragment");
+
+	/* The retransmitted fragment is ignored */
+	for (i = 0; i < sent_count; i++) {
+		ret = net_recv_data(iface1, sent[i]);
+		zassert_equal(ret, 0, "Cannot receive fragment %d", i);
+
+		sent[i] = NULL;
+	}
+
+	sent_count = 0;
+
+	zassert_equal(k_sem_take(&wait_data, WAIT_TIME), 0,
+		      "Datagram with duplicated fragment not received");
+	zassert_equal(recv_len, DATA_LEN, "Invalid length %zd", recv_len);
+	zassert_true(recv_data_ok, "Invalid data");
+}
+
+static void test_recv_ipv4_fragment_overlap(void)
+{
+	struct net_ipv4_hdr *hdr;
+	struct net_pkt *overlap;
+	uint16_t flag;
+	int ret;
+	int i;
+
+	send_datagram();
+
+	/* Move a copy of the third fragment 8 bytes backwards, so that it
+	 * overlaps the end of the second one.
+	 */
+	overlap = net_pkt_rx_clone(sent[2], ALLOC_TIMEOUT);
+	zassert_not_null(overlap, "Cannot clone fragment");
+
+	hdr = NET_IPV4_HDR(overlap);
+	flag = ((hdr->offset[0] << 8) | hdr->offset[1]) - 1;
+	hdr->offset[0] = flag >> 8;
+	hdr->offset[1] = flag;
+
+	net_pkt_set_ip_hdr_len(overlap, NET_IPV4H_LEN);
+	net_pkt_set_ipv4_opts_len(overlap, 0);
+	hdr->chksum = 0U;
+	hdr->chksum = net_calc_chksum_ipv4(overlap);
+
+	ret = net_recv_data(iface1, overlap);
+	zassert_equal(ret, 0, "Cannot receive fragment");
+
+	/* The overlapping fragment cancels the whole reassembly */
+	for (i = 0; i < sent_count; i++) {
+		ret = net_recv_data(iface1, sent[i]);
+		zassert_equal(ret, 0, "Cannot receive fragment %d", i);
+
+		sent[i] = NULL;
+	}
+
+	sent_count = 0;
+
+	zassert_not_equal(k_sem_take(&wait_data, NO_DATA_WAIT_TIME), 0,
+			  "Datagram with overlapping fragments received");
+}
+
+static void test_recv_ipv4_fragment_timeout(void)
+{
+	struct net_ipv4_hdr *hdr;
+	struct net_icmp_hdr *icmp_hdr;
+	struct net_pkt *last;
+	int ret;
+	int i;
+
+	/* Let the reassembly of the previous test time out */
+	k_sleep(K_MSEC(CONFIG_NET_IPV4_FRAGMENT_TIMEOUT * MSEC_PER_SEC + 500));
+
+	send_datagram();
+
+	last = sent[sent_count - 1];
+
+	for (i = 0; i < sent_count - 1; i++) {
+		ret = net_recv_data(iface1, sent[i]);
+		zassert_equal(ret, 0, "Cannot receive fragment %d", i);
+
+		sent[i] = NULL;
+	}
+
+	sent_count = 0;
+
+	/* An ICMPv4 Time Exceeded is sent back once the reassembly times out
+	 * as its first fragment was received.
+	 */
+	capture = true;
+
+	zassert_equal(k_sem_take(&wait_sent,
+				 K_MSEC(CONFIG_NET_IPV4_FRAGMENT_TIMEOUT *
+					MSEC_PER_SEC + 500)), 0,
+		      "ICMPv4 error not sent");
+
+	capture = false;
+
+	hdr = NET_IPV4_HDR(sent[0]);
+	zassert_equal(hdr->proto, IPPROTO_ICMP, "Invalid protocol");
+
+	icmp_hdr = (struct net_icmp_hdr *)((uint8_t *)hdr + NET_IPV4H_LEN);
+	zassert_equal(icmp_hdr->type, NET_ICMPV4_TIME_EXCEEDED,
+		      "Invalid ICMPv4 type");
+	zassert_equal(icmp_hdr->code, NET_ICMPV4_TIME_EXCEEDED_FRAG,
+		      "Invalid ICMPv4 code");
+
+	release_sent();
+
+	ret = net_recv_data(iface1, last);
+	zassert_equal(ret, 0, "Cannot receive last fragment");
+
+	zassert_not_equal(k_sem_take(&wait_data, NO_DATA_WAIT_TIME), 0,
+			  "Datagram received after timeout");
+}
+
+void test_main(void)
+{
+	ztest_test_suite(net_ipv4_fragment_test,
+			 ztest_unit_test(test_setup),
+			 ztest_unit_test(test_send_ipv4_fragment),
+			 ztest_unit_test(test_recv_ipv4_fragment),
+			 ztest_unit_test(test_send_ipv4_fragment_df),
+			 ztest_unit_test(test_recv_ipv4_fragment_duplicate),
+			 ztest_unit_test(test_recv_ipv4_fragment_overlap),
+			 ztest_unit_test(test_recv_ipv4_fragment_timeout)
+			 );
+
+	ztest_run_test_suite(net_ipv4_fragment_test);
+}
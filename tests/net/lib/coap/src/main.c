@@ -963,6 +963,137 @@ static void test_observer_client(void)
 	zassert_not_null(reply, "Couldn't find a matching waiting reply");
 }
 
+static const char * const index_path_a[] = { "a", NULL };
+static const char * const index_path_ab[] = { "a", "b", NULL };
+static const char * const index_path_abc[] = { "ab", "c", NULL };
+static const char * const index_path_wild[] = { "w", "+", NULL };
+static const char * const index_path_wx[] = { "w", "x", NULL };
+static const char * const index_path_root[] = { NULL };
+
+static struct coap_resource index_resources[] = {
+	{ .path = index_path_a },
+	{ .path = index_path_ab },
+	{ .path = index_path_abc },
+	{ .path = index_path_wild },
+	{ .path = index_path_wx },
+	{ .path = index_path_root },
+	{ },
+};
+
+COAP_RESOURCE_INDEX_DEFINE(resource_index, ARRAY_SIZE(index_resources), 4);
+
+static struct coap_resource *find_indexed(const char * const *path)
+{
+	struct coap_packet req;
+	struct coap_option options[4] = {};
+	uint8_t *data = data_buf[0];
+	uint8_t opt_num = ARRAY_SIZE(options) - 1;
+	int r;
+
+	r = coap_packet_init(&req, data, COAP_BUF_SIZE,
+			     COAP_VERSION_1, COAP_TYPE_CON, 0, NULL,
+			     COAP_METHOD_GET, coap_next_id());
+	zassert_equal(r, 0, "Unable to initialize request");
+
+	for (; *path; path++) {
+		r = coap_packet_append_option(&req, COAP_OPTION_URI_PATH,
+					      *path, strlen(*path));
+		zassert_equal(r, 0, "Unable to add option to request");
+	}
+
+	r = coap_packet_parse(&req, data, req.offset, options, opt_num);
+	zassert_equal(r, 0, "Could not parse req packet");
+
+	return coap_resource_index_find(&resource_index, &req, options,
+					opt_num);
+}
+
+static void test_resource_index(void)
+{
+	const char * const path_b[] = { "b", NULL };
+	const char * const path_wy[] = { "w", "y", NULL };
+	const char * const path_abcd[] = { "a", "b", "c", NULL };
+	int r;
+
+	r = coap_resource_index_init(&resource_index, index_resources);
+	zassert_equal(r, 0, "Could not build the index");
+
+	/**TESTPOINT: each resource is found from its own path */
+	zassert_equal_ptr(find_indexed(index_path_a), &index_resources[0],
+			  "Wrong resource for a");
+	zassert_equal_ptr(find_indexed(index_path_ab), &index_resources[1],
+			  "Wrong resource for a/b");
+	zassert_equal_ptr(find_indexed(index_path_abc), &index_resources[2],
+			  "Wrong resource for ab/c");
+	zassert_equal_ptr(find_indexed(index_path_root), &index_resources[5],
+			  "Wrong resource for the root");
+
+	/**TESTPOINT: as with a linear search, the first matching resource
+	 * is found, even if it has a wildcard
+	 */
+	zassert_equal_ptr(find_indexed(index_path_wx), &index_resources[3],
+			  "Wrong resource for w/x");
+	zassert_equal_ptr(find_indexed(path_wy), &index_resources[3],
+			  "Wrong resource for w/y");
+
+	/**TESTPOINT: unknown paths match no resource */
+	zassert_is_null(find_indexed(path_b), "Resource found for b");
+	zassert_is_null(find_indexed(path_abcd), "Resource found for a/b/c");
+
+	/**TESTPOINT: the index cannot hold more resources than its size */
+	r = coap_resource_index_init(&resource_index, server_resources);
+	zassert_equal(r, 0, "Could not build the index");
+
+	resource_index.max_resources = 1;
+	r = coap_resource_index_init(&resource_index, index_resources);
+	zassert_equal(r, -ENOMEM, "Too many resources indexed");
+	resource_index.max_resources = ARRAY_SIZE(index_resources);
+}
+
+static void test_resource_find_observer(void)
+{
+	struct coap_resource resource = { };
+	struct sockaddr_in6 other_addr = dummy_addr;
+	struct coap_observer *o;
+
+	other_addr.sin6_port = htons(MY_PORT);
+
+	memcpy(&observers[0].addr, &dummy_addr, sizeof(dummy_addr));
+	memcpy(observers[0].token, "tok0", 4);
+	observers[0].tkl = 4;
+	memcpy(&observers[1].addr, &dummy_addr, sizeof(dummy_addr));
+	memcpy(observers[1].token, "tok1", 4);
+	observers[1].tkl = 4;
+
+	coap_register_observer(&resource, &observers[0]);
+	coap_register_observer(&resource, &observers[1]);
+
+	/**TESTPOINT: observers are matched by address and token */
+	o = coap_resource_find_observer(&resource,
+					(struct sockaddr *)&dummy_addr,
+					"tok1", 4);
+	zassert_equal_ptr(o, &observers[1], "Wrong observer");
+
+	o = coap_resource_find_observer(&resource,
+					(struct sockaddr *)&dummy_addr,
+					NULL, 0);
+	zassert_equal_ptr(o, &observers[0], "Wrong observer");
+
+	o = coap_resource_find_observer(&resource,
+					(struct sockaddr *)&dummy_addr,
+					"tok2", 4);
+	zassert_is_null(o, "Observer found for unknown token");
+
+	o = coap_resource_find_observer(&resource,
+					(struct sockaddr *)&other_addr,
+					NULL, 0);
+	zassert_is_null(o, "Observer found for unknown address");
+
+	coap_remove_observer(&resource, &observers[0]);
+	coap_remove_observer(&resource, &observers[1]);
+	(void)memset(observers, 0, sizeof(observers));
+}
+
 void test_main(void)
 {
 	ztest_test_suite(coap_tests,
@@ -983,7 +1114,9 @@ void test_main(void)
 			 ztest_unit_test(test_block2_size),
 			 ztest_unit_test(test_retransmit_second_round),
 			 ztest_unit_test(test_observer_server),
-			 ztest_unit_test(test_observer_client));
+			 ztest_unit_test(test_observer_client),
+			 ztest_unit_test(test_resource_index),
+			 ztest_unit_test(test_resource_find_observer));
 
 	ztest_run_test_suite(coap_tests);
 }
@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_DNS_RESOLVER_LOG_LEVEL);
+
+#include <ztest.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/dns_resolve.h>
+
+/* The DNS server of the test is a local UDP responder that answers the
+ * A queries it receives according to the first label of the name:
+ *
+ * - "cached" and "coalesced": one address with a TTL of 60 s
+ * - "short": one address with a TTL of 1 s
+ * - "alias": a CNAME with a TTL of 1 s, then an address with a TTL of 60 s
+ * - anything else: a name error
+ */
+
+#define RESPONDER_PORT 15353
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define THREAD_PRIORITY K_PRIO_COOP(2)
+#define MAX_BUF_SIZE 512
+
+#define DNS_TIMEOUT 500 /* ms */
+#define WAIT_TIME K_MSEC(DNS_TIMEOUT + 300)
+
+#define SHORT_TTL 1
+#define LONG_TTL 60
+
+static const uint8_t answer_addr[] = { 192, 0, 2, 42 };
+
+static uint8_t responder_buf[MAX_BUF_SIZE];
+static int responder_sock;
+static int queries_received;
+
+struct lookup {
+	struct k_sem done;
+	int status;
+	int addrs;
+	struct in_addr addr;
+};
+
+static void put_be16(uint8_t *buf, uint16_t val)
+{
+	buf[0] = val >> 8;
+	buf[1] = val;
+}
+
+static int put_rr(uint8_t *buf, uint16_t name_ptr, uint16_t type,
+		  uint32_t ttl, const uint8_t *rdata, uint16_t rdlength)
+{
+	put_be16(buf, 0xc000 | name_ptr);
+	put_be16(buf + 2, type);
+	put_be16(buf + 4, 1); /* class IN */
+	put_be16(buf + 6, ttl >> 16);
+	put_be16(buf + 8, ttl);
+	put_be16(buf + 10, rdlength);
+	memcpy(buf + 12, rdata, rdlength);
+
+	return 12 + rdlength;
+}
+
+/* Turn the query in buf into a response, return its length */
+static int build_response(uint8_t *buf, int len)
+{
+	static const uint8_t cname[] = "\x06target\x06zephyr\x04test";
+	static const uint8_t soa[22];
+	uint8_t *label = buf + 12;
+	int ancount = 0;
+	int pos = len;
+
+	if (!memcmp(label, "\x06" "cached", 7) ||
+	    !memcmp(label, "\x09" "coalesced", 10)) {
+		pos += put_rr(buf + pos, 12, 1, LONG_TTL, answer_addr,
+			      sizeof(answer_addr));
+		ancount = 1;
+	} else if (!memcmp(label, "\x05" "short", 6)) {
+		pos += put_rr(buf + pos, 12, 1, SHORT_TTL, answer_addr,
+			      sizeof(answer_addr));
+		ancount = 1;
+	} else if (!memcmp(label, "\x05" "alias", 6)) {
+		int target = pos + 12;
+
+		pos += put_rr(buf + pos, 12, 5, SHORT_TTL, cname,
+			      sizeof(cname));
+		pos += put_rr(buf + pos, target, 1, LONG_TTL, answer_addr,
+			      sizeof(answer_addr));
+		ancount = 2;
+	} else {
+		/* Name error, with the SOA record of the zone */
+		pos += put_rr(buf + pos, 12, 6, LONG_TTL, soa, sizeof(soa));
+		buf[3] = 3; /* rcode */
+		put_be16(buf + 8, 1);
+	}
+
+	buf[2] = 0x81; /* QR, RD */
+	buf[3] |= 0x80; /* RA */
+	put_be16(buf + 6, ancount);
+
+	return pos;
+}
+
+static void responder(void *p1, void *p2, void *p3)
+{
+	struct sockaddr_in peer;
+	socklen_t peer_len;
+	int len;
+
+	while (true) {
+		peer_len = sizeof(peer);
+		len = recvfrom(responder_sock, responder_buf,
+			       sizeof(responder_buf) / 2, 0,
+			       (struct sockaddr *)&peer, &peer_len);
+		if (len < 12) {
+			continue;
+		}
+
+		queries_received++;
+
+		len = build_response(responder_buf, len);
+		(void)sendto(responder_sock, responder_buf, len, 0,
+			     (struct sockaddr *)&peer, peer_len);
+	}
+}
+
+K_THREAD_DEFINE(responder_thread, STACK_SIZE, responder, NULL, NULL, NULL,
+		THREAD_PRIORITY, 0, -1);
+
+static void lookup_cb(enum dns_resolve_status status,
+		      struct dns_addrinfo *info,
+		      void *user_data)
+{
+	struct lookup *lookup = user_data;
+
+	if (status == DNS_EAI_INPROGRESS && info) {
+		lookup->addr = net_sin(&info->ai_addr)->sin_addr;
+		lookup->addrs++;
+		return;
+	}
+
+	lookup->status = status;
+	k_sem_give(&lookup->done);
+}
+
+static void lookup_start(const char *name, struct lookup *lookup)
+{
+	int ret;
+
+	k_sem_init(&lookup->done, 0, 1);
+	lookup->status = 0;
+	lookup->addrs = 0;
+
+	ret = dns_get_addr_info(name, DNS_QUERY_TYPE_A, NULL, lookup_cb,
+				lookup, DNS_TIMEOUT);
+	zassert_equal(ret, 0, "cannot resolve %s (%d)", name, ret);
+}
+
+static void lookup_wait(struct lookup *lookup, int status)
+{
+	zassert_equal(k_sem_take(&lookup->done, WAIT_TIME), 0,
+		      "lookup timed out");
+	zassert_equal(lookup->status, status, "unexpected status %d",
+		      lookup->status);
+
+	if (status == DNS_EAI_ALLDONE) {
+		zassert_equal(lookup->addrs, 1, "%d addresses", lookup->addrs);
+		zassert_mem_equal(&lookup->addr, answer_addr,
+				  sizeof(answer_addr), "wrong address");
+	}
+}
+
+static void resolve(const char *name, int status, int queries)
+{
+	struct lookup lookup;
+	int received = queries_received;
+
+	lookup_start(name, &lookup);
+	lookup_wait(&lookup, status);
+
+	zassert_equal(queries_received - received, queries,
+		      "%d queries sent for %s", queries_received - received,
+		      name);
+}
+
+void test_dns_cache_setup(void)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(RESPONDER_PORT),
+		.sin_addr = INADDR_LOOPBACK_INIT,
+	};
+	int ret;
+
+	responder_sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	zassert_true(responder_sock >= 0, "cannot create socket");
+
+	ret = bind(responder_sock, (struct sockaddr *)&addr, sizeof(addr));
+	zassert_equal(ret, 0, "cannot bind socket (%d)", errno);
+
+	k_thread_start(responder_thread);
+}
+
+void test_dns_cache_positive(void)
+{
+	struct dns_resolve_cache_stats before, after;
+
+	dns_resolve_cache_stats_get(&before);
+
+	/**TESTPOINT: the first lookup is sent to the server, and the next
+	 * ones are answered from the cache
+	 */
+	resolve("cached.zephyr.test", DNS_EAI_ALLDONE, 1);
+	resolve("cached.zephyr.test", DNS_EAI_ALLDONE, 0);
+	resolve("cached.zephyr.test", DNS_EAI_ALLDONE, 0);
+
+	dns_resolve_cache_stats_get(&after);
+	zassert_equal(after.hits - before.hits, 2, "wrong hit count");
+	zassert_equal(after.misses - before.misses, 1, "wrong miss count");
+	zassert_true(after.entries >= 1, "no cache entry");
+}
+
+void test_dns_cache_ttl(void)
+{
+	/**TESTPOINT: an answer is cached for its TTL */
+	resolve("short.zephyr.test", DNS_EAI_ALLDONE, 1);
+	resolve("short.zephyr.test", DNS_EAI_ALLDONE, 0);
+
+	k_sleep(K_MSEC(SHORT_TTL * MSEC_PER_SEC + 100));
+
+	resolve("short.zephyr.test", DNS_EAI_ALLDONE, 1);
+}
+
+void test_dns_cache_cname(void)
+{
+	/**TESTPOINT: an answer reached through a CNAME is cached for the
+	 * lowest TTL of the chain
+	 */
+	resolve("alias.zephyr.test", DNS_EAI_ALLDONE, 1);
+	resolve("alias.zephyr.test", DNS_EAI_ALLDONE, 0);
+
+	k_sleep(K_MSEC(SHORT_TTL * MSEC_PER_SEC + 100));
+
+	resolve("alias.zephyr.test", DNS_EAI_ALLDONE, 1);
+}
+
+void test_dns_cache_negative(void)
+{
+	struct dns_resolve_cache_stats before, after;
+
+	dns_resolve_cache_stats_get(&before);
+
+	/**TESTPOINT: a name error is cached as well */
+	resolve("nonexistent.zephyr.test", DNS_EAI_NODATA, 1);
+	resolve("nonexistent.zephyr.test", DNS_EAI_NODATA, 0);
+
+	dns_resolve_cache_stats_get(&after);
+	zassert_equal(after.negative_hits - before.negative_hits, 1,
+		      "wrong negative hit count");
+
+	k_sleep(K_SECONDS(CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL));
+
+	resolve("nonexistent.zephyr.test", DNS_EAI_NODATA, 1);
+}
+
+void test_dns_cache_coalesce(void)
+{
+	struct dns_resolve_cache_stats before, after;
+	struct lookup first, second;
+	int received = queries_received;
+
+	dns_resolve_cache_stats_get(&before);
+
+	/**TESTPOINT: a lookup for a name being resolved already waits for
+	 * the pending query instead of sending another one
+	 */
+	lookup_start("coalesced.zephyr.test", &first);
+	lookup_start("coalesced.zephyr.test", &second);
+
+	lookup_wait(&first, DNS_EAI_ALLDONE);
+	lookup_wait(&second, DNS_EAI_ALLDONE);
+
+	zassert_equal(queries_received - received, 1, "%d queries sent",
+		      queries_received - received);
+
+	dns_resolve_cache_stats_get(&after);
+	zassert_equal(after.coalesced - before.coalesced, 1,
+		      "wrong coalesced count");
+}
+
+void test_dns_cache_flush(void)
+{
+	struct dns_resolve_cache_stats stats;
+
+	/**TESTPOINT: flushing the cache empties it */
+	dns_resolve_cache_flush();
+	dns_resolve_cache_stats_get(&stats);
+	zassert_equal(stats.entries, 0, "%u entries left", stats.entries);
+
+	resolve("cached.zephyr.test", DNS_EAI_ALLDONE, 1);
+}
+
+void test_main(void)
+{
+	ztest_test_suite(dns_cache,
+			 ztest_unit_test(test_dns_cache_setup),
+			 ztest_unit_test(test_dns_cache_positive),
+			 ztest_unit_test(test_dns_cache_ttl),
+			 ztest_unit_test(test_dns_cache_cname),
+			 ztest_unit_test(test_dns_cache_negative),
+			 ztest_unit_test(test_dns_cache_coalesce),
+			 ztest_unit_test(test_dns_cache_flush));
+
+	ztest_run_test_suite(dns_cache);
+}
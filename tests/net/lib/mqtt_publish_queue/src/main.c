@@ -0,0 +1,378 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/mqtt.h>
+
+/* Publish queue tests, against a broker stand-in on the loopback interface
+ * driven by the test itself, so that the acknowledgments are sent exactly
+ * when each test needs them.
+ */
+
+#define BROKER_PORT	1883
+#define BUF_SIZE	256
+#define WAIT_MS		100
+#define MAX_PUBLISH	8
+
+#define PKT_TYPE_CONNECT	0x10
+#define PKT_TYPE_PUBLISH	0x30
+#define PKT_TYPE_PUBACK		0x40
+#define PKT_TYPE_PUBCOMP	0x70
+#define PKT_FLAG_DUP		0x08
+
+#define INFLIGHT_MAX	CONFIG_MQTT_PUBLISH_INFLIGHT_MAX
+#define QUEUE_SIZE	CONFIG_MQTT_PUBLISH_QUEUE_SIZE
+
+static uint8_t rx_buf[BUF_SIZE];
+static uint8_t tx_buf[BUF_SIZE];
+static uint8_t broker_buf[BUF_SIZE];
+static int broker_buf_len;
+static const uint8_t payload[] = "payload";
+static struct mqtt_client client;
+static struct sockaddr_in broker_addr = {
+	.sin_family = AF_INET,
+	.sin_port = htons(BROKER_PORT),
+	.sin_addr = INADDR_LOOPBACK_INIT,
+};
+static int listen_sock;
+static int broker_sock;
+
+static bool connected;
+static int sent_count;
+static int puback_count;
+
+/* PUBLISH packets received by the broker */
+struct publish_rx {
+	uint16_t message_id;
+	bool dup;
+};
+
+static void mqtt_evt_handler(struct mqtt_client *const c,
+			     const struct mqtt_evt *evt)
+{
+	switch (evt->type) {
+	case MQTT_EVT_CONNACK:
+		connected = (evt->result == 0);
+		break;
+	case MQTT_EVT_PUBACK:
+		puback_count++;
+		break;
+	case MQTT_EVT_PUBLISH_SENT:
+		zassert_equal(evt->result, 0, "Queued message dropped");
+		sent_count++;
+		break;
+	default:
+		break;
+	}
+}
+
+/* Process what the broker sent to the client */
+static void client_input(void)
+{
+	struct zsock_pollfd fds = {
+		.fd = client.transport.tcp.sock,
+		.events = ZSOCK_POLLIN,
+	};
+
+	zassert_equal(poll(&fds, 1, WAIT_MS), 1, "Nothing for the client");
+	zassert_equal(mqtt_input(&client), 0, "mqtt_input failed");
+}
+
+/* Parse the complete packets received by the broker, return the PUBLISH
+ * ones, and answer the CONNECT.
+ */
+static int broker_parse(struct publish_rx *publish, int max)
+{
+	static const uint8_t connack[] = { 0x20, 0x02, 0x00, 0x00 };
+	uint32_t remaining;
+	uint16_t topic_len;
+	int hdr_len;
+	int count = 0;
+	int pos = 0;
+
+	while (pos + 2 <= broker_buf_len) {
+		remaining = 0U;
+		hdr_len = 1;
+		do {
+			if (pos + hdr_len >= broker_buf_len) {
+				goto out;
+			}
+
+			remaining |= (broker_buf[pos + hdr_len] & 0x7f) <<
+				     (7 * (hdr_len - 1));
+		} while (broker_buf[pos + hdr_len++] & 0x80);
+
+		if (pos + hdr_len + remaining > broker_buf_len) {
+			break;
+		}
+
+		if ((broker_buf[pos] & 0xf0) == PKT_TYPE_CONNECT) {
+			zassert_equal(send(broker_sock, connack,
+					   sizeof(connack), 0),
+				      sizeof(connack), "CONNACK not sent");
+		} else if ((broker_buf[pos] & 0xf0) == PKT_TYPE_PUBLISH) {
+			zassert_true(count < max, "Too many PUBLISH");
+
+			/* The message id follows the topic */
+			topic_len = sys_get_be16(&broker_buf[pos + hdr_len]);
+			publish[count].message_id = sys_get_be16(
+				&broker_buf[pos + hdr_len + 2 + topic_len]);
+			publish[count].dup = broker_buf[pos] & PKT_FLAG_DUP;
+			count++;
+		}
+
+		pos += hdr_len + remaining;
+	}
+
+out:
+	memmove(broker_buf, broker_buf + pos, broker_buf_len - pos);
+	broker_buf_len -= pos;
+
+	return count;
+}
+
+/* Receive what the client sent until nothing arrives for WAIT_MS */
+static int broker_input(struct publish_rx *publish, int max)
+{
+	struct zsock_pollfd fds = {
+		.fd = broker_sock,
+		.events = ZSOCK_POLLIN,
+	};
+	int count = 0;
+	int len;
+
+	while (poll(&fds, 1, WAIT_MS) == 1) {
+		len = recv(broker_sock, broker_buf + broker_buf_len,
+			   sizeof(broker_buf) - broker_buf_len, 0);
+		zassert_true(len > 0, "Broker connection closed");
+
+		broker_buf_len += len;
+		count += broker_parse(publish + count, max - count);
+	}
+
+	return count;
+}
+
+static void broker_ack(uint8_t type, uint16_t message_id)
+{
+	uint8_t pkt[4] = { type, 0x02 };
+
+	sys_put_be16(message_id, &pkt[2]);
+	zassert_equal(send(broker_sock, pkt, sizeof(pkt), 0), sizeof(pkt),
+		      "Acknowledgment not sent");
+
+	client_input();
+}
+
+/* Acknowledge a message, and return the messages it releases */
+static int broker_puback(uint16_t message_id, struct publish_rx *publish,
+			 int max)
+{
+	broker_ack(PKT_TYPE_PUBACK, message_id);
+
+	return broker_input(publish, max);
+}
+
+static void param_init(struct mqtt_publish_param *param, uint16_t message_id)
+{
+	memset(param, 0, sizeof(*param));
+
+	param->message.topic.topic.utf8 = (uint8_t *)"test/queue";
+	param->message.topic.topic.size = strlen("test/queue");
+	param->message.topic.qos = MQTT_QOS_1_AT_LEAST_ONCE;
+	param->message.payload.data = (uint8_t *)payload;
+	param->message.payload.len = sizeof(payload);
+	param->message_id = message_id;
+}
+
+static int publish_async(uint16_t message_id)
+{
+	struct mqtt_publish_param param;
+
+	param_init(&param, message_id);
+
+	return mqtt_publish_async(&client, &param);
+}
+
+static int publish_sync(uint16_t message_id, bool dup)
+{
+	struct mqtt_publish_param param;
+
+	param_init(&param, message_id);
+	param.dup_flag = dup;
+
+	return mqtt_publish(&client, &param);
+}
+
+static void test_connect(void)
+{
+	struct publish_rx publish[1];
+
+	mqtt_client_init(&client);
+
+	client.broker = &broker_addr;
+	client.evt_cb = mqtt_evt_handler;
+	client.client_id.utf8 = (uint8_t *)"zephyr_test";
+	client.client_id.size = strlen("zephyr_test");
+	client.protocol_version = MQTT_VERSION_3_1_1;
+	client.rx_buf = rx_buf;
+	client.rx_buf_size = sizeof(rx_buf);
+	client.tx_buf = tx_buf;
+	client.tx_buf_size = sizeof(tx_buf);
+	client.transport.type = MQTT_TRANSPORT_NON_SECURE;
+
+	listen_sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	zassert_true(listen_sock >= 0, "socket failed (%d)", errno);
+	zassert_equal(bind(listen_sock, (struct sockaddr *)&broker_addr,
+			   sizeof(broker_addr)), 0, "bind failed (%d)", errno);
+	zassert_equal(listen(listen_sock, 1), 0, "listen failed (%d)", errno);
+
+	zassert_equal(mqtt_connect(&client), 0, "mqtt_connect failed");
+
+	broker_sock = accept(listen_sock, NULL, NULL);
+	zassert_true(broker_sock >= 0, "accept failed (%d)", errno);
+
+	zassert_equal(broker_input(publish, ARRAY_SIZE(publish)), 0,
+		      "Unexpected PUBLISH");
+
+	client_input();
+	zassert_true(connected, "Not connected");
+}
+
+static void test_inflight_window(void)
+{
+	struct publish_rx publish[MAX_PUBLISH];
+	uint16_t id;
+	int count;
+
+	sent_count = 0;
+	puback_count = 0;
+
+	/* The first messages fill the window, the next ones the queue */
+	for (id = 1; id <= INFLIGHT_MAX + QUEUE_SIZE; id++) {
+		zassert_equal(publish_async(id), 0, "Message %u not queued",
+			      id);
+	}
+
+	zassert_equal(publish_async(id), -ENOMEM, "Queue not full");
+
+	count = broker_input(publish, ARRAY_SIZE(publish));
+	zassert_equal(count, INFLIGHT_MAX, "Window not respected");
+	zassert_equal(sent_count, INFLIGHT_MAX, "Wrong sent events");
+
+	for (int i = 0; i < count; i++) {
+		zassert_equal(publish[i].message_id, i + 1, "Wrong order");
+		zassert_false(publish[i].dup, "Unexpected dup flag");
+	}
+
+	/* Each acknowledgment releases one queued message */
+	for (id = 1; id <= QUEUE_SIZE; id++) {
+		count = broker_puback(id, publish, ARRAY_SIZE(publish));
+		zassert_equal(count, 1, "No message released by PUBACK %u",
+			      id);
+		zassert_equal(publish[0].message_id, id + INFLIGHT_MAX,
+			      "Wrong message released");
+	}
+
+	for (; id <= INFLIGHT_MAX + QUEUE_SIZE; id++) {
+		count = broker_puback(id, publish, ARRAY_SIZE(publish));
+		zassert_equal(count, 0, "Unexpected PUBLISH");
+	}
+
+	zassert_equal(sent_count, INFLIGHT_MAX + QUEUE_SIZE,
+		      "Wrong sent events");
+	zassert_equal(puback_count, INFLIGHT_MAX + QUEUE_SIZE,
+		      "Wrong PUBACK events");
+	zassert_equal(client.publish_queue.inflight_count, 0,
+		      "Messages still in flight");
+}
+
+static void test_retransmit_ack(void)
+{
+	struct publish_rx publish[MAX_PUBLISH];
+	const uint16_t first_id = 100;
+	const uint16_t queued_id = first_id + INFLIGHT_MAX;
+	const uint16_t sync_id = 200;
+	int count;
+
+	for (uint16_t id = first_id; id <= queued_id; id++) {
+		zassert_equal(publish_async(id), 0, "Message %u not queued",
+			      id);
+	}
+
+	count = broker_input(publish, ARRAY_SIZE(publish));
+	zassert_equal(count, INFLIGHT_MAX, "Window not respected");
+
+	/* The queue owns the ids of its messages until they are acked */
+	zassert_equal(publish_sync(first_id, false), -EBUSY,
+		      "Id of a message in flight reused");
+	zassert_equal(publish_sync(queued_id, false), -EBUSY,
+		      "Id of a queued message reused");
+	zassert_equal(publish_sync(queued_id, true), -EBUSY,
+		      "Message retransmitted before being sent");
+	zassert_equal(publish_async(first_id), -EBUSY,
+		      "Id of a message in flight queued again");
+	zassert_equal(publish_async(queued_id), -EBUSY,
+		      "Id of a queued message queued again");
+
+	/* A message in flight may be retransmitted */
+	zassert_equal(publish_sync(first_id, true), 0, "Retransmission failed");
+	count = broker_input(publish, ARRAY_SIZE(publish));
+	zassert_equal(count, 1, "Retransmission not received");
+	zassert_equal(publish[0].message_id, first_id, "Wrong message id");
+	zassert_true(publish[0].dup, "Retransmission without dup flag");
+
+	/* The acknowledgment of another message does not release a slot */
+	zassert_equal(publish_sync(sync_id, false), 0, "mqtt_publish failed");
+	count = broker_input(publish, ARRAY_SIZE(publish));
+	zassert_equal(count, 1, "Message not received");
+	zassert_equal(publish[0].message_id, sync_id, "Wrong message id");
+
+	count = broker_puback(sync_id, publish, ARRAY_SIZE(publish));
+	zassert_equal(count, 0, "Slot released by another PUBACK");
+
+	/* Nor does an acknowledgment of the wrong type */
+	broker_ack(PKT_TYPE_PUBCOMP, first_id);
+	count = broker_input(publish, ARRAY_SIZE(publish));
+	zassert_equal(count, 0, "QoS 1 slot released by a PUBCOMP");
+
+	/* The single PUBACK of the retransmitted message releases it */
+	count = broker_puback(first_id, publish, ARRAY_SIZE(publish));
+	zassert_equal(count, 1, "Slot not released");
+	zassert_equal(publish[0].message_id, queued_id,
+		      "Wrong message released");
+
+	count = broker_puback(first_id, publish, ARRAY_SIZE(publish));
+	zassert_equal(count, 0, "Duplicate PUBACK released a slot");
+
+	for (uint16_t id = first_id + 1; id <= queued_id; id++) {
+		(void)broker_puback(id, publish, ARRAY_SIZE(publish));
+	}
+
+	zassert_equal(client.publish_queue.inflight_count, 0,
+		      "Messages still in flight");
+}
+
+static void test_disconnect(void)
+{
+	zassert_equal(mqtt_disconnect(&client), 0, "mqtt_disconnect failed");
+
+	close(broker_sock);
+	close(listen_sock);
+}
+
+void test_main(void)
+{
+	ztest_test_suite(mqtt_publish_queue,
+			 ztest_unit_test(test_connect),
+			 ztest_unit_test(test_inflight_window),
+			 ztest_unit_test(test_retransmit_ack),
+			 ztest_unit_test(test_disconnect));
+
+	ztest_run_test_suite(mqtt_publish_queue);
+}
@@ -306,6 +306,70 @@ static void test_npf_eth_mac_addr_mask(void)
 	zassert_true(npf_remove_all_recv_rules(), "");
 }
 
+/*
+ * Conditions shared by several rules
+ */
+
+static int custom_calls;
+
+static bool custom_test_fn(struct npf_test *test, struct net_pkt *pkt)
+{
+	custom_calls++;
+
+	return false;
+}
+
+static struct npf_test custom_test = {
+	.fn = custom_test_fn,
+};
+
+static NPF_SIZE_MIN(minsize_150, 150);
+
+static NPF_RULE(drop_big_ip, NET_DROP, ip_packet, minsize_150);
+static struct npf_rule drop_custom_ip = {
+	.result = NET_DROP,
+	.nb_tests = 2,
+	.tests = { &ip_packet.test, &custom_test },
+};
+static struct npf_rule drop_custom = {
+	.result = NET_DROP,
+	.nb_tests = 1,
+	.tests = { &custom_test },
+};
+
+static void test_npf_shared_conditions(void)
+{
+	struct net_pkt *pkt;
+
+	npf_append_recv_rule(&drop_big_ip);
+	npf_append_recv_rule(&drop_custom_ip);
+	npf_append_recv_rule(&drop_custom);
+	npf_append_recv_rule(&npf_default_ok);
+
+	/* not IP: the second rule fails on its first condition */
+	custom_calls = 0;
+	pkt = build_test_pkt(NET_ETH_PTYPE_ARP, 100, NULL);
+	zassert_true(net_pkt_filter_recv_ok(pkt), "");
+	zassert_equal(custom_calls, 1, "");
+	net_pkt_unref(pkt);
+
+	/* big IP packet: the first rule matches */
+	custom_calls = 0;
+	pkt = build_test_pkt(NET_ETH_PTYPE_IP, 200, NULL);
+	zassert_false(net_pkt_filter_recv_ok(pkt), "");
+	zassert_equal(custom_calls, 0, "");
+	net_pkt_unref(pkt);
+
+	/* small IP packet: the custom condition is tested by both rules */
+	custom_calls = 0;
+	pkt = build_test_pkt(NET_ETH_PTYPE_IP, 100, NULL);
+	zassert_true(net_pkt_filter_recv_ok(pkt), "");
+	zassert_equal(custom_calls, 2, "");
+	net_pkt_unref(pkt);
+
+	zassert_true(npf_remove_all_recv_rules(), "");
+}
+
 void test_main(void)
 {
 	ztest_test_suite(net_pkt_filter_test,
@@ -313,7 +377,8 @@ void test_main(void)
 			 ztest_unit_test(test_npf_example1),
 			 ztest_unit_test(test_npf_example2),
 			 ztest_unit_test(test_npf_eth_mac_address),
-			 ztest_unit_test(test_npf_eth_mac_addr_mask));
+			 ztest_unit_test(test_npf_eth_mac_addr_mask),
+			 ztest_unit_test(test_npf_shared_conditions));
 
 	ztest_run_test_suite(net_pkt_filter_test);
 }
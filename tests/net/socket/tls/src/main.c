@@ -471,6 +471,176 @@ void test_v6_msg_trunc(void)
 		       (struct sockaddr *)&server_addr, sizeof(server_addr));
 }
 
+#if defined(CONFIG_NET_SOCKETS_TLS_HANDSHAKE_OFFLOAD)
+#define HANDSHAKE_POLL_TIMEOUT_MS 5000
+
+static void test_set_nonblocking(int sock)
+{
+	int flags = fcntl(sock, F_GETFL, 0);
+
+	zassert_true(flags >= 0, "fcntl F_GETFL failed (%d)", errno);
+	zassert_equal(fcntl(sock, F_SETFL, flags | O_NONBLOCK), 0,
+		      "fcntl F_SETFL failed (%d)", errno);
+}
+
+static void test_connect_in_progress(int sock, struct sockaddr *addr,
+				     socklen_t addrlen)
+{
+	zassert_equal(connect(sock, addr, addrlen), -1,
+		      "connect should not complete immediately");
+	zassert_equal(errno, EINPROGRESS, "Invalid errno (%d)", errno);
+}
+
+void test_v4_handshake_offload(void)
+{
+	int c_sock;
+	int s_sock;
+	int new_sock;
+	struct sockaddr_in c_saddr;
+	struct sockaddr_in s_saddr;
+	struct sockaddr addr;
+	socklen_t addrlen = sizeof(addr);
+	struct pollfd fds;
+	uint8_t rx_buf[sizeof(TEST_STR_SMALL) - 1];
+	int ret;
+
+	prepare_sock_tls_v4(CONFIG_NET_CONFIG_MY_IPV4_ADDR, ANY_PORT,
+			    &c_sock, &c_saddr, IPPROTO_TLS_1_2);
+	prepare_sock_tls_v4(CONFIG_NET_CONFIG_MY_IPV4_ADDR, SERVER_PORT,
+			    &s_sock, &s_saddr, IPPROTO_TLS_1_2);
+
+	test_config_psk(s_sock, c_sock);
+
+	test_bind(s_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_listen(s_sock);
+
+	test_set_nonblocking(c_sock);
+	test_connect_in_progress(c_sock, (struct sockaddr *)&s_saddr,
+				 sizeof(s_saddr));
+
+	/* The client handshake runs in the background, while the server
+	 * one blocks in accept().
+	 */
+	test_accept(s_sock, &new_sock, &addr, &addrlen);
+
+	fds.fd = c_sock;
+	fds.events = POLLOUT;
+	ret = poll(&fds, 1, HANDSHAKE_POLL_TIMEOUT_MS);
+	zassert_equal(ret, 1, "poll failed (%d)", errno);
+	zassert_equal(fds.revents, POLLOUT, "Invalid revents (%x)",
+		      fds.revents);
+
+	test_send(c_sock, TEST_STR_SMALL, sizeof(rx_buf), 0);
+
+	ret = recv(new_sock, rx_buf, sizeof(rx_buf), MSG_WAITALL);
+	zassert_equal(ret, sizeof(rx_buf), "Invalid length received");
+	zassert_mem_equal(rx_buf, TEST_STR_SMALL, sizeof(rx_buf),
+			  "Invalid data received");
+
+	test_close(new_sock);
+	test_close(s_sock);
+	test_close(c_sock);
+
+	k_sleep(TCP_TEARDOWN_TIMEOUT);
+}
+
+void test_v4_handshake_offload_failure(void)
+{
+	int c_sock;
+	int s_sock;
+	int new_sock;
+	struct sockaddr_in c_saddr;
+	struct sockaddr_in s_saddr;
+	struct sockaddr addr;
+	socklen_t addrlen = sizeof(addr);
+	struct pollfd fds;
+	int ret;
+
+	/* A plain TCP server, which drops the connection instead of
+	 * answering the client hello.
+	 */
+	prepare_sock_tls_v4(CONFIG_NET_CONFIG_MY_IPV4_ADDR, ANY_PORT,
+			    &c_sock, &c_saddr, IPPROTO_TLS_1_2);
+	prepare_sock_tcp_v4(CONFIG_NET_CONFIG_MY_IPV4_ADDR, SERVER_PORT,
+			    &s_sock, &s_saddr);
+
+	test_bind(s_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_listen(s_sock);
+
+	test_set_nonblocking(c_sock);
+	test_connect_in_progress(c_sock, (struct sockaddr *)&s_saddr,
+				 sizeof(s_saddr));
+
+	test_accept(s_sock, &new_sock, &addr, &addrlen);
+	test_close(new_sock);
+
+	fds.fd = c_sock;
+	fds.events = POLLOUT;
+	ret = poll(&fds, 1, HANDSHAKE_POLL_TIMEOUT_MS);
+	zassert_equal(ret, 1, "poll failed (%d)", errno);
+	zassert_true(fds.revents & POLLERR, "Handshake failure not reported");
+	zassert_false(fds.revents & POLLOUT, "Failed socket is writable");
+
+	ret = send(c_sock, TEST_STR_SMALL, strlen(TEST_STR_SMALL), 0);
+	zassert_equal(ret, -1, "send should fail");
+
+	test_close(s_sock);
+	test_close(c_sock);
+
+	k_sleep(TCP_TEARDOWN_TIMEOUT);
+}
+
+void test_v4_handshake_offload_close(void)
+{
+	int c_sock;
+	int s_sock;
+	struct sockaddr_in c_saddr;
+	struct sockaddr_in s_saddr;
+	struct pollfd fds;
+	int ret;
+
+	/* A plain TCP server, which never accepts the connection, so the
+	 * client handshake keeps waiting for the server hello.
+	 */
+	prepare_sock_tls_v4(CONFIG_NET_CONFIG_MY_IPV4_ADDR, ANY_PORT,
+			    &c_sock, &c_saddr, IPPROTO_TLS_1_2);
+	prepare_sock_tcp_v4(CONFIG_NET_CONFIG_MY_IPV4_ADDR, SERVER_PORT,
+			    &s_sock, &s_saddr);
+
+	test_bind(s_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_listen(s_sock);
+
+	test_set_nonblocking(c_sock);
+	test_connect_in_progress(c_sock, (struct sockaddr *)&s_saddr,
+				 sizeof(s_saddr));
+
+	fds.fd = c_sock;
+	fds.events = POLLOUT;
+	ret = poll(&fds, 1, 100);
+	zassert_equal(ret, 0, "Handshake should still be in progress");
+
+	test_close(c_sock);
+	test_close(s_sock);
+
+	k_sleep(TCP_TEARDOWN_TIMEOUT);
+}
+#else
+void test_v4_handshake_offload(void)
+{
+	ztest_test_skip();
+}
+
+void test_v4_handshake_offload_failure(void)
+{
+	ztest_test_skip();
+}
+
+void test_v4_handshake_offload_close(void)
+{
+	ztest_test_skip();
+}
+#endif /* CONFIG_NET_SOCKETS_TLS_HANDSHAKE_OFFLOAD */
+
 void test_main(void)
 {
 	if (IS_ENABLED(CONFIG_NET_TC_THREAD_COOPERATIVE)) {
@@ -487,7 +657,10 @@ void test_main(void)
 		ztest_unit_test(test_v4_msg_waitall),
 		ztest_unit_test(test_v6_msg_waitall),
 		ztest_unit_test(test_v4_msg_trunc),
-		ztest_unit_test(test_v6_msg_trunc)
+		ztest_unit_test(test_v6_msg_trunc),
+		ztest_unit_test(test_v4_handshake_offload),
+		ztest_unit_test(test_v4_handshake_offload_failure),
+		ztest_unit_test(test_v4_handshake_offload_close)
 		);
 
 	ztest_run_test_suite(socket_tls);
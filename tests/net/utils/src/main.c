@@ -848,11 +848,136 @@ void test_addr_parse(void)
 #endif
 }
 
+#define CHKSUM_MAX_DATA 67
+
+NET_BUF_POOL_DEFINE(chksum_pool, CHKSUM_MAX_DATA + 1, 32, 0, NULL);
+
+static uint8_t chksum_data[NET_IPV4H_LEN + CHKSUM_MAX_DATA];
+
+/* Reference checksum, summing the data byte pair by byte pair */
+static uint16_t ref_chksum(uint32_t sum, const uint8_t *data, size_t len)
+{
+	size_t i;
+
+	for (i = 0; i < len; i++) {
+		sum += (i % 2) ? data[i] : data[i] << 8;
+	}
+
+	while (sum >> 16) {
+		sum = (sum & 0xffff) + (sum >> 16);
+	}
+
+	return sum;
+}
+
+/* Build an IPv4 packet whose buffers hold chunk bytes after the header,
+ * each one starting reserve bytes after the start of its data area.
+ */
+static struct net_pkt *chksum_pkt(size_t len, size_t chunk, size_t reserve)
+{
+	struct net_pkt *pkt;
+	struct net_buf *buf;
+	size_t pos = 0;
+	size_t size;
+
+	pkt = net_pkt_alloc(K_NO_WAIT);
+	zassert_not_null(pkt, "Cannot allocate pkt");
+
+	net_pkt_set_family(pkt, AF_INET);
+	net_pkt_set_ip_hdr_len(pkt, NET_IPV4H_LEN);
+
+	len += NET_IPV4H_LEN;
+	size = NET_IPV4H_LEN + chunk;
+
+	while (pos < len) {
+		buf = net_buf_alloc(&chksum_pool, K_NO_WAIT);
+		zassert_not_null(buf, "Cannot allocate buf");
+
+		net_buf_reserve(buf, reserve);
+		net_buf_add_mem(buf, chksum_data + pos, MIN(size, len - pos));
+		net_pkt_append_buffer(pkt, buf);
+
+		pos += MIN(size, len - pos);
+		size = chunk;
+	}
+
+	return pkt;
+}
+
+void test_net_calc_chksum(void)
+{
+	static const size_t lens[] = { 0, 1, 2, 7, 64, CHKSUM_MAX_DATA };
+	static const size_t chunks[] = { 1, 2, 3, 5, 8 };
+	struct net_ipv4_hdr *hdr = (struct net_ipv4_hdr *)chksum_data;
+	struct net_pkt *pkt;
+	uint16_t expected;
+	uint16_t sum;
+	int i, j, k;
+
+	for (i = 0; i < sizeof(chksum_data); i++) {
+		chksum_data[i] = i * 37 + 11;
+	}
+
+	hdr->vhl = 0x45;
+	hdr->proto = IPPROTO_UDP;
+
+	for (i = 0; i < ARRAY_SIZE(lens); i++) {
+		/* The pseudo header is made of the addresses, protocol and
+		 * upper layer length.
+		 */
+		sum = ref_chksum(IPPROTO_UDP + lens[i], hdr->src,
+				 2 * sizeof(struct in_addr));
+		sum = ref_chksum(sum, chksum_data + NET_IPV4H_LEN, lens[i]);
+		expected = ~((sum == 0U) ? 0xffff : htons(sum));
+
+		for (j = 0; j < ARRAY_SIZE(chunks); j++) {
+			for (k = 0; k < 4; k++) {
+				pkt = chksum_pkt(lens[i], chunks[j], k);
+
+				zassert_equal(net_calc_chksum(pkt, IPPROTO_UDP),
+					      expected,
+					      "Invalid checksum, len %zu chunk "
+					      "%zu reserve %d", lens[i],
+					      chunks[j], k);
+
+				net_pkt_unref(pkt);
+			}
+		}
+	}
+}
+
+void test_net_chksum_update(void)
+{
+	struct net_ipv4_hdr hdr = {
+		.vhl = 0x45,
+		.ttl = 64,
+		.proto = IPPROTO_UDP,
+		.src = { 192, 0, 2, 1 },
+		.dst = { 192, 0, 2, 2 },
+	};
+	uint16_t old_len;
+	uint32_t len;
+
+	hdr.chksum = htons(~ref_chksum(0, (uint8_t *)&hdr, sizeof(hdr)));
+
+	for (len = 0U; len <= 0xffff; len += 0xff) {
+		old_len = hdr.len;
+		hdr.len = htons(len);
+
+		hdr.chksum = net_chksum_update(hdr.chksum, old_len, hdr.len);
+
+		zassert_equal(ref_chksum(0, (uint8_t *)&hdr, sizeof(hdr)),
+			      0xffff, "Invalid checksum, len %u", len);
+	}
+}
+
 void test_main(void)
 {
 	ztest_test_suite(test_utils_fn,
 			 ztest_user_unit_test(test_net_addr),
-			 ztest_unit_test(test_addr_parse));
+			 ztest_unit_test(test_addr_parse),
+			 ztest_unit_test(test_net_calc_chksum),
+			 ztest_unit_test(test_net_chksum_update));
 
 	ztest_run_test_suite(test_utils_fn);
 }
@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/zephyr.h>
+#include <ztest.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/fs/fs_sys.h>
+
+#define TEST_FS_TYPE	FS_TYPE_EXTERNAL_BASE
+#define TEST_FS_MNTP	"/async"
+#define TEST_FILE	TEST_FS_MNTP"/file"
+#define TEST_FS_MNTP2	"/async2"
+#define TEST_FILE2	TEST_FS_MNTP2"/file"
+#define N_REQS		4
+
+/* Single file mock file system, recording the calls made to it */
+static uint8_t file_data[256];
+static size_t file_len;
+static size_t read_pos;
+static size_t write_limit = sizeof(file_data);
+static int write_calls;
+static int sync_calls;
+static int write_error;
+static bool gate_writes;
+static K_SEM_DEFINE(write_entered, 0, 1);
+static K_SEM_DEFINE(write_gate, 0, 1);
+
+static int mock_open(struct fs_file_t *zfp, const char *name, fs_mode_t flags)
+{
+	zfp->filep = file_data;
+	return 0;
+}
+
+static int mock_close(struct fs_file_t *zfp)
+{
+	zfp->filep = NULL;
+	return 0;
+}
+
+static ssize_t mock_read(struct fs_file_t *zfp, void *ptr, size_t size)
+{
+	size = MIN(size, file_len - read_pos);
+	memcpy(ptr, &file_data[read_pos], size);
+	read_pos += size;
+
+	return size;
+}
+
+static ssize_t mock_write(struct fs_file_t *zfp, const void *ptr, size_t size)
+{
+	write_calls++;
+
+	if (gate_writes) {
+		gate_writes = false;
+		k_sem_give(&write_entered);
+		k_sem_take(&write_gate, K_FOREVER);
+	}
+
+	if (write_error != 0) {
+		return write_error;
+	}
+
+	size = MIN(size, write_limit - file_len);
+	memcpy(&file_data[file_len], ptr, size);
+	file_len += size;
+
+	return size;
+}
+
+static int mock_sync(struct fs_file_t *zfp)
+{
+	sync_calls++;
+	return 0;
+}
+
+static int mock_mount(struct fs_mount_t *mountp)
+{
+	return 0;
+}
+
+static int mock_unmount(struct fs_mount_t *mountp)
+{
+	return 0;
+}
+
+static const struct fs_file_system_t mock_fs = {
+	.open = mock_open,
+	.close = mock_close,
+	.read = mock_read,
+	.write = mock_write,
+	.sync = mock_sync,
+	.mount = mock_mount,
+	.unmount = mock_unmount,
+};
+
+static struct fs_mount_t mnt = {
+	.type = TEST_FS_TYPE,
+	.mnt_point = TEST_FS_MNTP,
+};
+
+static struct fs_mount_t mnt2 = {
+	.type = TEST_FS_TYPE,
+	.mnt_point = TEST_FS_MNTP2,
+};
+
+static struct fs_file_t file;
+static struct fs_async_req reqs[N_REQS];
+static const char *const chunks[N_REQS] = { "one ", "two ", "three ", "four" };
+static int completed;
+
+static void req_done(struct fs_async_req *req)
+{
+	completed++;
+}
+
+static void reset_mock(void)
+{
+	file_len = 0;
+	read_pos = 0;
+	write_limit = sizeof(file_data);
+	write_calls = 0;
+	sync_calls = 0;
+	write_error = 0;
+	completed = 0;
+}
+
+static void async_setup(void)
+{
+	reset_mock();
+	fs_file_t_init(&file);
+	zassert_equal(fs_open(&file, TEST_FILE, FS_O_RDWR), 0, NULL);
+}
+
+static void async_teardown(void)
+{
+	zassert_equal(fs_close(&file), 0, NULL);
+}
+
+/* Queue all chunks while the first write is held inside the file system */
+static void submit_chunks_gated(uint8_t flags)
+{
+	gate_writes = true;
+
+	for (int i = 0; i < N_REQS; i++) {
+		fs_async_req_init(&reqs[i], req_done, NULL);
+		zassert_equal(fs_write_async(&file, chunks[i],
+					     strlen(chunks[i]), flags,
+					     &reqs[i]), 0, NULL);
+		if (i == 0) {
+			k_sem_take(&write_entered, K_FOREVER);
+		}
+	}
+
+	k_sem_give(&write_gate);
+	zassert_equal(fs_async_flush(&file), 0, NULL);
+}
+
+static void test_write_order(void)
+{
+	submit_chunks_gated(0);
+
+	zassert_equal(completed, N_REQS, "not all requests completed");
+	zassert_mem_equal(file_data, "one two three four", file_len, NULL);
+
+	for (int i = 0; i < N_REQS; i++) {
+		zassert_equal(reqs[i].result, strlen(chunks[i]),
+			      "wrong result of request %d", i);
+	}
+
+	if (CONFIG_FILE_SYSTEM_ASYNC_MERGE_SIZE > 0) {
+		zassert_equal(write_calls, 2, "queued writes not merged");
+	} else {
+		zassert_equal(write_calls, N_REQS, NULL);
+	}
+	zassert_equal(sync_calls, 0, NULL);
+}
+
+static void test_write_sync(void)
+{
+	submit_chunks_gated(FS_ASYNC_FLAG_SYNC);
+
+	zassert_equal(completed, N_REQS, "not all requests completed");
+	zassert_equal(sync_calls, write_calls,
+		      "expected one sync per file system write");
+}
+
+static void test_short_write(void)
+{
+	write_limit = 10;
+	submit_chunks_gated(0);
+
+	/* The first write is alone, the other three merged if enabled */
+	zassert_equal(reqs[0].result, 4, NULL);
+	zassert_equal(reqs[1].result, 4, NULL);
+	zassert_equal(reqs[2].result, 2, NULL);
+	zassert_equal(reqs[3].result, 0, NULL);
+}
+
+static void test_write_error(void)
+{
+	write_error = -EIO;
+	submit_chunks_gated(FS_ASYNC_FLAG_SYNC);
+
+	for (int i = 0; i < N_REQS; i++) {
+		zassert_equal(reqs[i].result, -EIO, NULL);
+	}
+	zassert_equal(sync_calls, 0, NULL);
+}
+
+static void test_signal(void)
+{
+	struct k_poll_signal signal;
+	struct k_poll_event event = K_POLL_EVENT_INITIALIZER(
+		K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY, &signal);
+	char buf[8];
+	unsigned int signaled;
+	int result;
+
+	k_poll_signal_init(&signal);
+
+	fs_async_req_init(&reqs[0], NULL, &signal);
+	zassert_equal(fs_write_async(&file, "abc", 3, 0, &reqs[0]), 0, NULL);
+	zassert_equal(k_poll(&event, 1, K_SECONDS(1)), 0, NULL);
+	k_poll_signal_check(&signal, &signaled, &result);
+	zassert_equal(result, 3, NULL);
+
+	event.state = K_POLL_STATE_NOT_READY;
+	fs_async_req_init(&reqs[0], NULL, &signal);
+	zassert_equal(fs_read_async(&file, buf, sizeof(buf), &reqs[0]), 0,
+		      NULL);
+	zassert_equal(k_poll(&event, 1, K_SECONDS(1)), 0, NULL);
+	k_poll_signal_check(&signal, &signaled, &result);
+	zassert_equal(result, 3, NULL);
+	zassert_mem_equal(buf, "abc", 3, NULL);
+
+	event.state = K_POLL_STATE_NOT_READY;
+	fs_async_req_init(&reqs[0], NULL, &signal);
+	zassert_equal(fs_sync_async(&file, &reqs[0]), 0, NULL);
+	zassert_equal(k_poll(&event, 1, K_SECONDS(1)), 0, NULL);
+	zassert_equal(reqs[0].result, 0, NULL);
+	zassert_equal(sync_calls, 1, NULL);
+}
+
+/* A write held on one mount point does not delay the other ones */
+static void test_mount_isolation(void)
+{
+	struct fs_file_t file2;
+	struct fs_async_req req2;
+
+	if (CONFIG_FILE_SYSTEM_ASYNC_WORKERS < 2) {
+		ztest_test_skip();
+	}
+
+	zassert_equal(fs_mount(&mnt2), 0, NULL);
+	fs_file_t_init(&file2);
+	zassert_equal(fs_open(&file2, TEST_FILE2, FS_O_RDWR), 0, NULL);
+
+	gate_writes = true;
+	fs_async_req_init(&reqs[0], req_done, NULL);
+	zassert_equal(fs_write_async(&file, "held", 4, 0, &reqs[0]), 0, NULL);
+	k_sem_take(&write_entered, K_FOREVER);
+
+	fs_async_req_init(&req2, req_done, NULL);
+	zassert_equal(fs_write_async(&file2, "free", 4, 0, &req2), 0, NULL);
+	zassert_equal(fs_async_flush(&file2), 0, NULL);
+	zassert_equal(req2.result, 4, "second mount point blocked");
+	zassert_equal(reqs[0].result, -EINPROGRESS, NULL);
+
+	k_sem_give(&write_gate);
+	zassert_equal(fs_async_flush(&file), 0, NULL);
+	zassert_equal(reqs[0].result, 4, NULL);
+	zassert_equal(completed, 2, NULL);
+
+	zassert_equal(fs_close(&file2), 0, NULL);
+	zassert_equal(fs_unmount(&mnt2), 0, NULL);
+}
+
+static void test_unopened(void)
+{
+	struct fs_file_t closed;
+
+	fs_file_t_init(&closed);
+	fs_async_req_init(&reqs[0], NULL, NULL);
+
+	zassert_equal(fs_write_async(&closed, "abc", 3, 0, &reqs[0]), -EBADF,
+		      NULL);
+	zassert_equal(fs_read_async(&closed, file_data, 3, &reqs[0]), -EBADF,
+		      NULL);
+	zassert_equal(fs_sync_async(&closed, &reqs[0]), -EBADF, NULL);
+	zassert_equal(fs_async_flush(&closed), -EBADF, NULL);
+}
+
+void test_main(void)
+{
+	zassert_equal(fs_register(TEST_FS_TYPE, &mock_fs), 0, NULL);
+	zassert_equal(fs_mount(&mnt), 0, NULL);
+
+	ztest_test_suite(fs_async_test,
+			 ztest_unit_test_setup_teardown(test_write_order,
+							async_setup,
+							async_teardown),
+			 ztest_unit_test_setup_teardown(test_write_sync,
+							async_setup,
+							async_teardown),
+			 ztest_unit_test_setup_teardown(test_short_write,
+							async_setup,
+							async_teardown),
+			 ztest_unit_test_setup_teardown(test_write_error,
+							async_setup,
+							async_teardown),
+			 ztest_unit_test_setup_teardown(test_signal,
+							async_setup,
+							async_teardown),
+			 ztest_unit_test_setup_teardown(test_mount_isolation,
+							async_setup,
+							async_teardown),
+			 ztest_unit_test(test_unopened)
+			 );
+	ztest_run_test_suite(fs_async_test);
+
+	zassert_equal(fs_unmount(&mnt), 0, NULL);
+}